@@ -0,0 +1,60 @@
+//===--- NonAtomicRefCounting.swift - Non-atomic RC for local objects -----===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+import SIL
+
+/// Converts reference counting operations on provably thread-local objects
+/// into non-atomic ones.
+///
+/// An object allocated in this function which does not escape the function can
+/// only ever be referenced from the allocating thread: no other thread can
+/// observe the reference, so its retains and releases need no atomicity. Such
+/// operations are lowered by IRGen to the `swift_nonatomic_*` runtime entry
+/// points, which update the refcount without lock-prefixed instructions.
+///
+/// This catches the objects which StackPromotion and AllocBoxToStack cannot
+/// remove entirely, e.g. allocations of resilient classes, allocations inside
+/// dead-end regions, and boxes whose call chains are not promotable.
+///
+/// Unlike sil-assume-single-threaded, this is a per-object proof and is always
+/// sound: escaping objects keep their atomic operations.
+let nonAtomicRefCounting = FunctionPass(name: "non-atomic-rc") {
+  (function: Function, context: FunctionPassContext) in
+
+  var threadLocalRoots = ValueSet(context)
+  var escapingRoots = ValueSet(context)
+  defer {
+    threadLocalRoots.deinitialize()
+    escapingRoots.deinitialize()
+  }
+
+  for inst in function.instructions {
+    guard let rcInst = inst as? RefCountingInst, rcInst.isAtomic else {
+      continue
+    }
+    let root = rcInst.operand.value.referenceRoot
+    guard root is AllocRefInstBase || root is AllocBoxInst else {
+      continue
+    }
+    if escapingRoots.contains(root) {
+      continue
+    }
+    if !threadLocalRoots.contains(root) {
+      if root.isEscaping(context) {
+        escapingRoots.insert(root)
+        continue
+      }
+      threadLocalRoots.insert(root)
+    }
+    rcInst.setAtomicity(isAtomic: false, context)
+  }
+}
@@ -56,6 +56,11 @@ var cxxSingleSourceLibraries: [String] = cxxSingleSourceLibraryDirs.flatMap {
   getSingleSourceLibraries(subDirectory: $0)
 }
 
+var layoutStringLibraryDirs: [String] = ["layout-strings"]
+var layoutStringLibraries: [String] = layoutStringLibraryDirs.flatMap {
+  getSingleSourceLibraries(subDirectory: $0)
+}
+
 //===---
 // Multi Source Libraries
 //
@@ -89,6 +94,7 @@ products.append(.executable(name: "SwiftBench", targets: ["SwiftBench"]))
 
 products += singleSourceLibraries.map { .library(name: $0, type: .static, targets: [$0]) }
 products += cxxSingleSourceLibraries.map { .library(name: $0, type: .static, targets: [$0]) }
+products += layoutStringLibraries.map { .library(name: $0, type: .static, targets: [$0]) }
 products += multiSourceLibraries.map {
   return .library(name: $0.name, type: .static, targets: [$0.name])
 }
@@ -107,9 +113,10 @@ targets.append(.target(name: "TestsUtils", path: "utils", sources: ["TestsUtils.
 //                                 "-enable-experimental-feature",
 //                                 "LayoutPrespecialization"])]))
 targets.append(.systemLibrary(name: "LibProc", path: "utils/LibProc"))
+targets.append(.systemLibrary(name: "PerfCounters", path: "utils/PerfCounters"))
 targets.append(
   .target(name: "DriverUtils",
-    dependencies: [.target(name: "TestsUtils"), "LibProc"],
+    dependencies: [.target(name: "TestsUtils"), "LibProc", "PerfCounters"],
     path: "utils",
     sources: ["DriverUtils.swift", "ArgParse.swift"]))
 
@@ -120,6 +127,7 @@ swiftBenchDeps.append(.target(name: "ObjectiveCTests"))
 swiftBenchDeps.append(.target(name: "DriverUtils"))
 swiftBenchDeps += singleSourceLibraries.map { .target(name: $0) }
 swiftBenchDeps += cxxSingleSourceLibraries.map { .target(name: $0) }
+swiftBenchDeps += layoutStringLibraries.map { .target(name: $0) }
 swiftBenchDeps += multiSourceLibraries.map { .target(name: $0.name) }
 
 targets.append(
@@ -174,6 +182,32 @@ targets += cxxSingleSourceLibraries.map { name in
                                   "-Xfrontend", "-validate-tbd-against-ir=none"])])
 }
 
+targets += layoutStringLibraries.map { name in
+  if name == "LayoutStringBytecode" {
+    return .target(
+      name: name,
+      dependencies: singleSourceDeps,
+      path: "layout-strings",
+      sources: ["\(name).swift"],
+      swiftSettings: [.unsafeFlags(["-Xfrontend",
+                                    "-enable-experimental-feature",
+                                    "-Xfrontend",
+                                    "LayoutStringValueWitnesses",
+                                    "-Xfrontend",
+                                    "-enable-experimental-feature",
+                                    "-Xfrontend",
+                                    "LayoutStringValueWitnessesInstantiation",
+                                    "-Xfrontend",
+                                    "-enable-layout-string-value-witnesses",
+                                    "-Xfrontend",
+                                    "-enable-layout-string-value-witnesses-instantiation"])])
+  }
+  return .target(name: name,
+      dependencies: singleSourceDeps,
+      path: "layout-strings",
+      sources: ["\(name).swift"])
+}
+
 targets += multiSourceLibraries.map { lib in
   return .target(
     name: lib.name,
@@ -410,6 +410,9 @@ function (swift_benchmark_compile_archopts)
       "-F" "${sdk}/../../../Developer/Library/Frameworks"
       "-I" "${srcdir}/utils/LibProc"
       "-no-link-objc-runtime")
+  else()
+    list(APPEND common_options_driver
+      "-I" "${srcdir}/utils/PerfCounters")
   endif()
   set(bench_library_objects)
   set(bench_library_sibfiles)
@@ -475,6 +478,17 @@ function (swift_benchmark_compile_archopts)
         set(extra_options "-Xfrontend"
                           "-disable-swift-bridge-attr")
       endif()
+      # This module is the layout-string half of the layout-strings benchmark
+      # pair; its twin LayoutStringSpecialized is compiled without the flags.
+      if("${module_name}" STREQUAL "LayoutStringBytecode")
+        set(extra_options "-Xfrontend" "-enable-experimental-feature"
+                          "-Xfrontend" "LayoutStringValueWitnesses"
+                          "-Xfrontend" "-enable-experimental-feature"
+                          "-Xfrontend" "LayoutStringValueWitnessesInstantiation"
+                          "-Xfrontend" "-enable-layout-string-value-witnesses"
+                          "-Xfrontend"
+                          "-enable-layout-string-value-witnesses-instantiation")
+      endif()
       set(objfile "${objdir}/${module_name}.o")
       set(swiftmodule "${objdir}/${module_name}.swiftmodule")
       set(source "${srcdir}/${module_name_path}.swift")
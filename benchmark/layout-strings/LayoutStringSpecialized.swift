@@ -0,0 +1,166 @@
+//===--- LayoutStringSpecialized.swift ------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2023 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+// This module is compiled without layout string value witnesses, so the
+// types below keep their IRGen-specialized witnesses. LayoutStringBytecode
+// defines the same types and workloads with the flag enabled, so the pair
+// measures the interpreted witnesses against the specialized ones shape by
+// shape. Run with
+// SWIFT_DEBUG_ENABLE_LAYOUT_STRING_STATS=1 and read the counters that
+// swift_generic_readLayoutStringWitnessStats reports to confirm which path a
+// module actually takes.
+//
+//===----------------------------------------------------------------------===//
+
+import TestsUtils
+
+let t: [BenchmarkCategory] = [.validation, .runtime]
+
+public let benchmarks = [
+  BenchmarkInfo(name: "LayoutStringSpecialized.CopyDestroy.RefStruct",
+    runFunction: run_copyDestroyRefStruct, tags: t),
+  BenchmarkInfo(name: "LayoutStringSpecialized.Assign.RefStruct",
+    runFunction: run_assignRefStruct, tags: t),
+  BenchmarkInfo(name: "LayoutStringSpecialized.CopyDestroy.NestedStruct",
+    runFunction: run_copyDestroyNestedStruct, tags: t),
+  BenchmarkInfo(name: "LayoutStringSpecialized.Assign.NestedStruct",
+    runFunction: run_assignNestedStruct, tags: t),
+  BenchmarkInfo(name: "LayoutStringSpecialized.CopyDestroy.PayloadEnum",
+    runFunction: run_copyDestroyPayloadEnum, tags: t),
+  BenchmarkInfo(name: "LayoutStringSpecialized.Assign.PayloadEnum",
+    runFunction: run_assignPayloadEnum, tags: t),
+  BenchmarkInfo(name: "LayoutStringSpecialized.CopyDestroy.GenericPair",
+    runFunction: run_copyDestroyGenericPair, tags: t),
+  BenchmarkInfo(name: "LayoutStringSpecialized.Assign.GenericPair",
+    runFunction: run_assignGenericPair, tags: t),
+]
+
+final class Ref {
+  var value: Int
+  init(_ value: Int) { self.value = value }
+}
+
+// A flat mix of native references and trivial fields.
+struct RefStruct {
+  var a: Ref
+  var b: Ref
+  var i: Int
+  var c: Ref
+}
+
+// A multi-payload enum; its witness cannot reduce to plain reference ops.
+enum PayloadEnum {
+  case empty
+  case single(Ref)
+  case pair(Ref, Int)
+}
+
+// Nesting forces the witness to walk inner layouts.
+struct NestedStruct {
+  var first: RefStruct
+  var tag: PayloadEnum
+  var trailing: (Int, Int)
+}
+
+// A generic instantiation; its witnesses come from runtime-instantiated
+// metadata rather than statically emitted code.
+struct GenericPair<T> {
+  var low: T
+  var high: T
+}
+
+let elementCount = 512
+
+// The workloads stay generic so that every copy, assign, and destroy goes
+// through the value witness table of T instead of code specialized for the
+// concrete type.
+
+@inline(never)
+@_semantics("optimize.sil.specialize.generic.never")
+func copyDestroyWorkload<T>(_ value: T, n: Int) {
+  let buffer = UnsafeMutablePointer<T>.allocate(capacity: elementCount)
+  for _ in 0..<n {
+    for i in 0..<elementCount {
+      (buffer + i).initialize(to: value)
+    }
+    buffer.deinitialize(count: elementCount)
+  }
+  buffer.deallocate()
+}
+
+@inline(never)
+@_semantics("optimize.sil.specialize.generic.never")
+func assignWorkload<T>(_ value: T, _ other: T, n: Int) {
+  let buffer = UnsafeMutablePointer<T>.allocate(capacity: elementCount)
+  for i in 0..<elementCount {
+    (buffer + i).initialize(to: value)
+  }
+  for iteration in 0..<n {
+    let next = iteration % 2 == 0 ? other : value
+    for i in 0..<elementCount {
+      (buffer + i).pointee = next
+    }
+  }
+  buffer.deinitialize(count: elementCount)
+  buffer.deallocate()
+}
+
+func makeRefStruct(_ i: Int) -> RefStruct {
+  RefStruct(a: Ref(i), b: Ref(i &+ 1), i: i, c: Ref(i &+ 2))
+}
+
+func makeNestedStruct(_ i: Int) -> NestedStruct {
+  NestedStruct(first: makeRefStruct(i), tag: .single(Ref(i)),
+               trailing: (i, i &+ 1))
+}
+
+@inline(never)
+public func run_copyDestroyRefStruct(n: Int) {
+  copyDestroyWorkload(makeRefStruct(0), n: n)
+}
+
+@inline(never)
+public func run_assignRefStruct(n: Int) {
+  assignWorkload(makeRefStruct(0), makeRefStruct(64), n: n)
+}
+
+@inline(never)
+public func run_copyDestroyNestedStruct(n: Int) {
+  copyDestroyWorkload(makeNestedStruct(0), n: n)
+}
+
+@inline(never)
+public func run_assignNestedStruct(n: Int) {
+  assignWorkload(makeNestedStruct(0), makeNestedStruct(64), n: n)
+}
+
+@inline(never)
+public func run_copyDestroyPayloadEnum(n: Int) {
+  copyDestroyWorkload(PayloadEnum.pair(Ref(0), 1), n: n)
+}
+
+@inline(never)
+public func run_assignPayloadEnum(n: Int) {
+  assignWorkload(PayloadEnum.pair(Ref(0), 1), PayloadEnum.single(Ref(64)),
+                 n: n)
+}
+
+@inline(never)
+public func run_copyDestroyGenericPair(n: Int) {
+  copyDestroyWorkload(GenericPair(low: Ref(0), high: Ref(1)), n: n)
+}
+
+@inline(never)
+public func run_assignGenericPair(n: Int) {
+  assignWorkload(GenericPair(low: Ref(0), high: Ref(1)),
+                 GenericPair(low: Ref(64), high: Ref(65)), n: n)
+}
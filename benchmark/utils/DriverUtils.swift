@@ -21,6 +21,10 @@ import Darwin
 import LibProc
 #endif
 
+#if os(Linux) && canImport(PerfCounters)
+import PerfCounters
+#endif
+
 import TestsUtils
 
 struct MeasurementMetadata {
@@ -33,15 +37,26 @@ struct MeasurementMetadata {
   let yields: Int /// Yield Count
 }
 
+/// Hardware performance counters accumulated over all measured samples.
+/// Counters that could not be counted on this machine are nil.
+struct PerfCounterSample {
+  let instructions: UInt64? /// Retired Instructions
+  let branchMisses: UInt64? /// Branch Mispredictions
+  let loadMisses: UInt64? /// L1 Data Cache Read Misses
+}
+
 struct BenchResults {
   let samples: [Double]
   let meta: MeasurementMetadata?
   let iters: Int
+  let counters: PerfCounterSample?
 
-  init(_ samples: [Double], _ metadata: MeasurementMetadata?, _ iters: Int) {
+  init(_ samples: [Double], _ metadata: MeasurementMetadata?, _ iters: Int,
+       _ counters: PerfCounterSample?) {
     self.samples = samples
     self.meta = metadata
     self.iters = iters
+    self.counters = counters
   }
 }
 
@@ -90,6 +105,10 @@ struct TestConfig {
   // Should we log the measurement metadata?
   let logMeta: Bool
 
+  // Should we sample hardware performance counters?
+  // Only supported on Linux, via perf_event_open(2).
+  let perfCounters: Bool
+
   // Allow running with nondeterministic hashing?
   var allowNondeterministicHashing: Bool
 
@@ -120,6 +139,7 @@ struct TestConfig {
       var verbose: Bool?
       var logMemory: Bool?
       var logMeta: Bool?
+      var perfCounters: Bool?
       var allowNondeterministicHashing: Bool?
       var jsonOutput: Bool?
       var action: TestAction?
@@ -162,6 +182,10 @@ struct TestConfig {
                   help: "log the change in maximum resident set size (MAX_RSS)")
     p.addArgument("--meta", \.logMeta, defaultValue: true,
                   help: "log the metadata (memory usage, context switches)")
+    p.addArgument("--perf-counters", \.perfCounters, defaultValue: true,
+                  help: "sample hardware performance counters\n" +
+                        "(instructions, branch misses, L1d misses)\n" +
+                        "around the measured function; Linux only")
     p.addArgument("--tags", \PartialTestConfig.tags,
                   help: "run tests matching all the specified categories",
                   parser: tags)
@@ -194,6 +218,7 @@ struct TestConfig {
     verbose = c.verbose ?? false
     logMemory = c.logMemory ?? false
     logMeta = c.logMeta ?? false
+    perfCounters = c.perfCounters ?? false
     afterRunSleep = c.afterRunSleep
     action = c.action ?? .run
     allowNondeterministicHashing = c.allowNondeterministicHashing ?? false
@@ -228,6 +253,7 @@ struct TestConfig {
         Verbose: \(verbose)
         LogMemory: \(logMemory)
         LogMeta: \(logMeta)
+        PerfCounters: \(perfCounters)
         SampleTime: \(sampleTime)
         NumIters: \(numIters ?? 0)
         Tests Filter: \(c.tests ?? [])
@@ -350,6 +376,46 @@ extension UInt64 {
   var microseconds: Int { return Int(self / 1000) }
 }
 
+#if os(Linux) && canImport(PerfCounters)
+/// Counts hardware events around the measured function using the Linux
+/// perf_event interface.
+///
+/// Each counter that fails to open (perf_event_paranoid restrictions, a
+/// container without PMU access, an unsupported event) stays closed and is
+/// omitted from the results; the remaining counters still report.
+final class PerfCounterSampler {
+  private let instructions = swift_perf_open_instructions()
+  private let branchMisses = swift_perf_open_branch_misses()
+  private let loadMisses = swift_perf_open_l1d_read_misses()
+
+  private var counters: [CInt] { [instructions, branchMisses, loadMisses] }
+
+  deinit {
+    counters.forEach(swift_perf_counter_close)
+  }
+
+  func reset() { counters.forEach(swift_perf_counter_reset) }
+  func start() { counters.forEach(swift_perf_counter_enable) }
+  func stop() { counters.forEach(swift_perf_counter_disable) }
+
+  /// Read the counts accumulated since the last `reset`.
+  func sample() -> PerfCounterSample? {
+    func value(_ fd: CInt) -> UInt64? {
+      let count = swift_perf_counter_read(fd)
+      return count < 0 ? nil : UInt64(count)
+    }
+    let s = PerfCounterSample(
+      instructions: value(instructions),
+      branchMisses: value(branchMisses),
+      loadMisses: value(loadMisses))
+    if s.instructions == nil && s.branchMisses == nil && s.loadMisses == nil {
+      return nil
+    }
+    return s
+  }
+}
+#endif
+
 /// Performance test runner that measures benchmarks and reports the results.
 final class TestRunner {
   let c: TestConfig
@@ -358,9 +424,15 @@ final class TestRunner {
   let baseline = TestRunner.getResourceUtilization()
   let schedulerQuantum = UInt64(10_000_000) // nanoseconds (== 10ms, macos)
   var yieldCount = 0
+#if os(Linux) && canImport(PerfCounters)
+  let perfCounters: PerfCounterSampler?
+#endif
 
   init(_ config: TestConfig) {
     self.c = config
+#if os(Linux) && canImport(PerfCounters)
+    perfCounters = config.perfCounters ? PerfCounterSampler() : nil
+#endif
     let now = timer.getTime()
     (start, end, lastYield) = (now, now, now)
   }
@@ -473,6 +545,9 @@ final class TestRunner {
     let now = yield()
     (start, end, lastYield) = (now, now, now)
     yieldCount = 0
+#if os(Linux) && canImport(PerfCounters)
+    perfCounters?.reset()
+#endif
   }
 
   /// Time in nanoseconds spent running the last function
@@ -487,7 +562,13 @@ final class TestRunner {
 #endif
 
     startMeasurement()
+#if os(Linux) && canImport(PerfCounters)
+    perfCounters?.start()
+#endif
     fn(numIters)
+#if os(Linux) && canImport(PerfCounters)
+    perfCounters?.stop()
+#endif
     stopMeasurement()
 
 #if SWIFT_RUNTIME_ENABLE_LEAK_CHECKER
@@ -570,7 +651,12 @@ final class TestRunner {
       samples = samples.map { $0 * Double(lf) }
     }
 
-    return BenchResults(samples, collectMetadata(), numIters)
+#if os(Linux) && canImport(PerfCounters)
+    let counters = perfCounters?.sample()
+#else
+    let counters: PerfCounterSample? = nil
+#endif
+    return BenchResults(samples, collectMetadata(), numIters, counters)
   }
 
   func printJSON(index: Int, info: BenchmarkInfo, results: BenchResults?) {
@@ -604,6 +690,11 @@ final class TestRunner {
 	  ]
 	}
       }
+      if let counters = results.counters {
+	if let n = counters.instructions { out.append("\"instructions\":\(n)") }
+	if let n = counters.branchMisses { out.append("\"branch_misses\":\(n)") }
+	if let n = counters.loadMisses { out.append("\"l1d_misses\":\(n)") }
+      }
     }
     print("{ " + out.joined(separator: ", ") + " }")
     fflush(stdout)
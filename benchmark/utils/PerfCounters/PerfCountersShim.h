@@ -0,0 +1,90 @@
+//===--- PerfCountersShim.h -----------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2017 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+// Thin wrappers over the Linux perf_event interface, so the benchmark driver
+// can count retired instructions, branch misses and L1d read misses around
+// the measured workload. perf_event_open(2) has no libc wrapper and its
+// attribute struct is not importable into Swift, hence the shim.
+
+#if defined(__linux__)
+
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+static inline int _swift_perf_event_open(unsigned int type,
+                                         unsigned long long config) {
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.type = type;
+  attr.size = sizeof(attr);
+  attr.config = config;
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  return (int)syscall(__NR_perf_event_open, &attr, /*pid=*/0, /*cpu=*/-1,
+                      /*group_fd=*/-1, /*flags=*/0UL);
+}
+
+// Each opener returns a counter file descriptor, or -1 if the event cannot
+// be counted (perf_event_paranoid, a container without PMU access, an
+// unsupported event, ...).
+
+static inline int swift_perf_open_instructions(void) {
+  return _swift_perf_event_open(PERF_TYPE_HARDWARE,
+                                PERF_COUNT_HW_INSTRUCTIONS);
+}
+
+static inline int swift_perf_open_branch_misses(void) {
+  return _swift_perf_event_open(PERF_TYPE_HARDWARE,
+                                PERF_COUNT_HW_BRANCH_MISSES);
+}
+
+static inline int swift_perf_open_l1d_read_misses(void) {
+  return _swift_perf_event_open(PERF_TYPE_HW_CACHE,
+                                PERF_COUNT_HW_CACHE_L1D |
+                                    (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+}
+
+static inline void swift_perf_counter_reset(int fd) {
+  if (fd >= 0)
+    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+}
+
+static inline void swift_perf_counter_enable(int fd) {
+  if (fd >= 0)
+    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+}
+
+static inline void swift_perf_counter_disable(int fd) {
+  if (fd >= 0)
+    ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+}
+
+/// Returns the current counter value, or -1 if the counter is not open or
+/// cannot be read.
+static inline long long swift_perf_counter_read(int fd) {
+  unsigned long long value;
+  if (fd < 0 || read(fd, &value, sizeof(value)) != (ssize_t)sizeof(value))
+    return -1;
+  return (long long)value;
+}
+
+static inline void swift_perf_counter_close(int fd) {
+  if (fd >= 0)
+    close(fd);
+}
+
+#endif // defined(__linux__)
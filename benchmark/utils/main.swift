@@ -109,6 +109,8 @@ import Integrate
 import IterateData
 import Join
 import KeyPathPerformanceTests
+import LayoutStringBytecode
+import LayoutStringSpecialized
 import LazyFilter
 import LinkedList
 import LuhnAlgoEager
@@ -306,6 +308,8 @@ register(IntegerParsing.benchmarks)
 register(Integrate.benchmarks)
 register(IterateData.benchmarks)
 register(Join.benchmarks)
+register(LayoutStringBytecode.benchmarks)
+register(LayoutStringSpecialized.benchmarks)
 register(LazyFilter.benchmarks)
 register(KeyPathPerformanceTests.benchmarks)
 register(LinkedList.benchmarks)
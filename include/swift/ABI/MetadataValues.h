@@ -2699,6 +2699,9 @@ enum class TaskOptionRecordKind : uint8_t {
   /// Set the initial task executor preference of the task.
   InitialTaskExecutorUnowned = 5,
   InitialTaskExecutorOwned = 6,
+  /// Pre-size the task's initial allocator slab from a caller-provided
+  /// estimate of how much task-local memory the task will use.
+  InitialAllocatorCapacity = 7,
   /// Request a child task for swift_task_run_inline.
   RunInline = UINT8_MAX,
 };
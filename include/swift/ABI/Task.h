@@ -463,7 +463,7 @@ public:
 
     // TODO: Document more how this is used from the `TaskGroupTaskStatusRecord`
 
-    /// The next task in the singly-linked list of child tasks.
+    /// The next task in the linked list of child tasks.
     /// The list must start in a `ChildTaskStatusRecord` registered
     /// with the parent task.
     ///
@@ -472,6 +472,14 @@ public:
     /// WARNING: Access can only be performed by the `Parent` of this task.
     AsyncTask *NextChild = nullptr;
 
+    /// The previous task in the linked list of child tasks, or null if this
+    /// is the first child. Only maintained for children linked into a
+    /// `TaskGroupTaskStatusRecord`, where it makes detaching a completed
+    /// child O(1) rather than a walk of the group's child list.
+    ///
+    /// WARNING: Access can only be performed by the `Parent` of this task.
+    AsyncTask *PrevChild = nullptr;
+
   public:
     ChildFragment(AsyncTask *parent) : Parent(parent) {}
 
@@ -490,6 +498,18 @@ public:
     void setNextChild(AsyncTask *task) {
       NextChild = task;
     }
+
+    AsyncTask *getPrevChild() const {
+      return PrevChild;
+    }
+
+    /// Set the `PrevChild` to the passed task.
+    ///
+    /// WARNING: This must ONLY be invoked from the parent of both
+    /// (this and the passed-in) tasks for thread-safety reasons.
+    void setPrevChild(AsyncTask *task) {
+      PrevChild = task;
+    }
   };
 
   bool hasChildFragment() const {
@@ -190,6 +190,30 @@ public:
   }
 };
 
+/// Task option to pre-size the task's initial allocator slab.
+///
+/// The capacity is an estimate of how many bytes the task will allocate from
+/// its task-local allocator over its lifetime. The runtime co-allocates a
+/// first slab of at least this capacity with the task itself, so a task whose
+/// footprint is estimated correctly never has to grow the allocator slab by
+/// slab. The estimate only affects performance: a task that outgrows it
+/// falls back to normal slab growth, and tasks whose first slab is already
+/// provided by other means ('async let' and inline tasks) ignore it.
+class InitialAllocatorCapacityTaskOptionRecord : public TaskOptionRecord {
+  const size_t Capacity;
+
+public:
+  InitialAllocatorCapacityTaskOptionRecord(size_t capacity)
+      : TaskOptionRecord(TaskOptionRecordKind::InitialAllocatorCapacity),
+        Capacity(capacity) {}
+
+  size_t getCapacity() const { return Capacity; }
+
+  static bool classof(const TaskOptionRecord *record) {
+    return record->getKind() == TaskOptionRecordKind::InitialAllocatorCapacity;
+  }
+};
+
 #if SWIFT_CONCURRENCY_EMBEDDED
 class ResultTypeInfoTaskOptionRecord : public TaskOptionRecord {
  public:
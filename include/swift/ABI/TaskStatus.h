@@ -115,9 +115,9 @@ public:
 /// the task group.  It may also hold references to completed children
 /// which have not yet been found by `next()`.
 ///
-/// The child tasks are stored as an invasive single-linked list, starting
-/// from `FirstChild` and continuing through the `NextChild` pointers of all
-/// the linked children.
+/// The child tasks are stored as an invasive doubly-linked list, starting
+/// from `FirstChild` and continuing through the `NextChild` and `PrevChild`
+/// pointers of all the linked children.
 ///
 /// This list structure should only ever be modified:
 /// - while holding the status record lock of the owning task, so that
@@ -164,6 +164,7 @@ public:
 
     auto oldLastChild = LastChild;
     LastChild = child;
+    child->childFragment()->setPrevChild(oldLastChild);
 
     if (!FirstChild) {
       // This is the first child we ever attach, so store it as FirstChild.
@@ -176,34 +177,25 @@ public:
 
   void detachChild(AsyncTask *child) {
     assert(child && "cannot remove a null child from group");
-    if (FirstChild == child) {
-      FirstChild = getNextChildTask(child);
-      if (FirstChild == nullptr) {
-        LastChild = nullptr;
-      }
-      return;
+    // Unlink the child from the doubly-linked list, i.e.:
+    //     prev -> child -> next
+    // Becomes:
+    //     prev ---------> next
+    auto prev = child->childFragment()->getPrevChild();
+    auto next = getNextChildTask(child);
+
+    if (prev) {
+      prev->childFragment()->setNextChild(next);
+    } else {
+      assert(FirstChild == child);
+      FirstChild = next;
     }
 
-    AsyncTask *prev = FirstChild;
-    // Remove the child from the linked list, i.e.:
-    //     prev -> afterPrev -> afterChild
-    //                 ==
-    //               child   -> afterChild
-    // Becomes:
-    //     prev --------------> afterChild
-    while (prev) {
-      auto afterPrev = getNextChildTask(prev);
-
-      if (afterPrev == child) {
-        auto afterChild = getNextChildTask(child);
-        prev->childFragment()->setNextChild(afterChild);
-        if (child == LastChild) {
-          LastChild = prev;
-        }
-        return;
-      }
-
-      prev = afterPrev;
+    if (next) {
+      next->childFragment()->setPrevChild(prev);
+    } else {
+      assert(LastChild == child);
+      LastChild = prev;
     }
   }
 
@@ -128,6 +128,7 @@ namespace swift {
   struct RequirementMatch;
   class TupleTypeElt;
   class EnumElementDecl;
+  class ProtocolConformanceRef;
   class ProtocolDecl;
   class SubstitutableType;
   class SourceManager;
@@ -535,6 +536,17 @@ public:
     return StringRef(Result.data(), Result.size());
   }
 
+  /// Take a bump allocator for a constraint solver out of the reuse pool,
+  /// or create a fresh one if none is pooled. Keeping a warm allocator
+  /// around avoids re-growing the slab list for every expression that is
+  /// type-checked.
+  llvm::BumpPtrAllocator takeSolverMemory();
+
+  /// Return a constraint solver's bump allocator to the reuse pool once all
+  /// memory allocated from it is dead. The allocator is reset, so only its
+  /// initial slab stays resident.
+  void recycleSolverMemory(llvm::BumpPtrAllocator &&allocator);
+
   template<typename T, typename Vector, typename Set, unsigned N>
   MutableArrayRef<T>
   AllocateCopy(llvm::SetVector<T, Vector, Set, N> setVector,
@@ -1482,6 +1494,30 @@ public:
   /// Each kind and SourceFile has its own cache for a Type.
   Type &getDefaultTypeRequestCache(SourceFile *, KnownProtocolKind);
 
+  /// Look up, and cache for the lifetime of this context, the conformance of
+  /// the given type to one of the ExpressibleBy* literal protocols.
+  ///
+  /// The types that witness literal protocols recur across every expression
+  /// in a compilation, so resolving them once here short-circuits the
+  /// otherwise-uncached module-level lookup each constraint system would
+  /// repeat. The type must not contain solver-allocated types such as type
+  /// variables; the caller is responsible for checking this.
+  ProtocolConformanceRef getLiteralProtocolConformance(
+      Type type, ProtocolDecl *literalProtocol);
+
+  /// Retrieve a uniqued copy of the name that \p print produces for \p decl,
+  /// allocated in this context.
+  ///
+  /// Results are cached by (decl, printKind), where \p printKind is a
+  /// caller-chosen discriminator for the formatting being used so that
+  /// different printing configurations do not collide; \p print is invoked
+  /// only on the first request for a given key. Intended for clients such as
+  /// index emission that print the same names over and over with fixed
+  /// formatting.
+  llvm::StringRef getOrCachePrintedName(
+      const Decl *decl, unsigned printKind,
+      llvm::function_ref<void(llvm::raw_ostream &)> print);
+
   using SILTransformCtors = ArrayRef<SILTransform *(*)(void)>;
 
   /// Register IRGen specific SIL passes such that the SILOptimizer can access
@@ -106,12 +106,9 @@ protected:
     return std::nullopt;
   }
 
-  static std::optional<Fingerprint> getFingerprintIfAny(const Decl *d) {
-    if (const auto *idc = dyn_cast<IterableDeclContext>(d)) {
-      return idc->getBodyFingerprint();
-    }
-    return std::nullopt;
-  }
+  /// Return a fingerprint for \p d that changes only when its interface
+  /// changes, or \c None if no such fingerprint can be computed.
+  static std::optional<Fingerprint> getFingerprintIfAny(const Decl *d);
 };
 
 } // namespace fine_grained_dependencies
@@ -622,7 +622,7 @@ protected:
     IsComputingSemanticMembers : 1
   );
 
-  SWIFT_INLINE_BITFIELD_FULL(ProtocolDecl, NominalTypeDecl, 1+1+1+1+1+1+1+1+1+1+1+1+1+1+1+8,
+  SWIFT_INLINE_BITFIELD_FULL(ProtocolDecl, NominalTypeDecl, 1+1+1+1+1+1+1+1+1+1+1+1+1+1+1+1+8,
     /// Whether the \c RequiresClass bit is valid.
     RequiresClassValid : 1,
 
@@ -667,6 +667,9 @@ protected:
     /// Whether we have a lazy-loaded list of primary associated types.
     HasLazyPrimaryAssociatedTypes : 1,
 
+    /// Whether we have a lazy-loaded list of inherited protocols.
+    HasLazyInheritedProtocols : 1,
+
     /// Whether we've computed the protocol requirements list yet.
     ProtocolRequirementsValid : 1,
 
@@ -5338,6 +5341,10 @@ class ProtocolDecl final : public NominalTypeDecl {
     return Bits.ProtocolDecl.HasLazyPrimaryAssociatedTypes;
   }
 
+  bool hasLazyInheritedProtocols() const {
+    return Bits.ProtocolDecl.HasLazyInheritedProtocols;
+  }
+
   friend class SuperclassDeclRequest;
   friend class SuperclassTypeRequest;
   friend class StructuralRequirementsRequest;
@@ -5614,6 +5621,9 @@ public:
   void setLazyPrimaryAssociatedTypeMembers(LazyMemberLoader *lazyLoader,
                                            uint64_t associatedTypesData);
 
+  void setLazyInheritedProtocols(LazyMemberLoader *lazyLoader,
+                                 uint64_t inheritedProtocolsData);
+
 public:
   // Implement isa/cast/dyncast/etc.
   static bool classof(const Decl *D) {
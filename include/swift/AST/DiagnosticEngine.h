@@ -26,6 +26,7 @@
 #include "swift/Basic/Version.h"
 #include "swift/Localization/LocalizationFormat.h"
 #include "llvm/ADT/BitVector.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/ADT/StringSet.h"
 #include "llvm/Support/Allocator.h"
@@ -1051,6 +1052,13 @@ namespace swift {
     /// Path to diagnostic documentation directory.
     std::string diagnosticDocumentationPath = "";
 
+    /// Educational note paths, rendered on demand and cached per diagnostic
+    /// ID. The paths for a given ID only depend on
+    /// \c diagnosticDocumentationPath, so repeated emissions of the same
+    /// diagnostic reuse the rendered paths.
+    llvm::DenseMap<uint32_t, std::vector<std::string>>
+        educationalNotePathCache;
+
     /// The Swift language version. This is used to limit diagnostic behavior
     /// until a specific language version, e.g. Swift 6.
     version::Version languageVersion;
@@ -1121,6 +1129,7 @@ namespace swift {
 
     void setDiagnosticDocumentationPath(std::string path) {
       diagnosticDocumentationPath = path;
+      educationalNotePathCache.clear();
     }
     StringRef getDiagnosticDocumentationPath() {
       return diagnosticDocumentationPath;
@@ -1377,6 +1386,10 @@ namespace swift {
     /// source buffer was derived, e.g., a macro expansion backtrace.
     std::vector<Diagnostic> getGeneratedSourceBufferNotes(SourceLoc loc);
 
+    /// Retrieve the educational note paths associated with the given
+    /// diagnostic ID, rendering and caching them on first use.
+    ArrayRef<std::string> getEducationalNotePaths(uint32_t diagnosticID);
+
     /// Handle a new diagnostic, which will either be emitted, or added to an
     /// active transaction.
     void handleDiagnostic(Diagnostic &&diag);
@@ -27,8 +27,12 @@
 #include "swift/Basic/Statistic.h"
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/SetVector.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/Support/Error.h"
 #include "llvm/Support/PrettyStackTrace.h"
+#include <chrono>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -145,6 +149,14 @@ class Evaluator {
   /// Whether to dump detailed debug info for cycles.
   bool debugDumpCycles;
 
+  /// Whether to dump cumulative per-request-kind timing when the evaluator
+  /// is destroyed.
+  bool dumpRequestTimers;
+
+  /// If non-zero, warn when evaluating a request takes longer than this
+  /// many milliseconds.
+  unsigned warnLongRequestEvaluation;
+
   /// Used to report statistics about which requests were evaluated, if
   /// non-null.
   UnifiedStatsReporter *stats = nullptr;
@@ -170,6 +182,20 @@ class Evaluator {
 
   evaluator::DependencyRecorder recorder;
 
+  /// Cumulative invocation counts and self time for each request kind,
+  /// keyed by the request's TypeID name. Only populated when
+  /// \c dumpRequestTimers is set.
+  struct RequestTimer {
+    uint64_t Count = 0;
+    uint64_t SelfNanos = 0;
+  };
+  llvm::StringMap<RequestTimer> requestTimers;
+
+  /// For each in-flight timed request, the time already attributed to
+  /// nested requests, so that a request's timer only accumulates time
+  /// spent in the request itself.
+  llvm::SmallVector<uint64_t, 8> nestedRequestNanos;
+
   /// Retrieve the request function for the given zone and request IDs.
   AbstractRequestFunction *getAbstractRequestFunction(uint8_t zoneID,
                                                       uint8_t requestID) const;
@@ -188,6 +214,8 @@ public:
   /// diagnostics through the given diagnostics engine.
   Evaluator(DiagnosticEngine &diags, const LangOptions &opts);
 
+  ~Evaluator();
+
   /// For last-ditch diagnostics, get a good approximate source location for
   /// the thing we're currently type checking by searching for a request whose
   /// source location matches the predicate.
@@ -327,6 +355,21 @@ private:
   /// \c activeRequests stack.
   void finishedRequest(const ActiveRequest &request);
 
+  /// Begin timing a request, if request timing or long-request warnings
+  /// are enabled.
+  ///
+  /// \returns the start time, or \c std::nullopt if timing is disabled.
+  std::optional<std::chrono::steady_clock::time_point> beginRequestTiming();
+
+  /// Finish timing a request begun with \c beginRequestTiming, attributing
+  /// its self time to \p requestName and warning at \p loc if the elapsed
+  /// time exceeds \c warnLongRequestEvaluation.
+  void endRequestTiming(std::chrono::steady_clock::time_point startTime,
+                        llvm::StringRef requestName, SourceLoc loc);
+
+  /// Dump the cumulative per-request-kind timers recorded so far.
+  void dumpTimers(llvm::raw_ostream &out) const;
+
   /// Produce the result of the request without caching.
   template<typename Request, typename Fn>
   typename Request::OutputType
@@ -346,8 +389,14 @@ private:
 
     recorder.beginRequest<Request>();
 
+    auto timingStart = beginRequestTiming();
+
     auto result = getRequestFunction<Request>()(request, *this);
 
+    if (timingStart)
+      endRequestTiming(*timingStart, TypeID<Request>::getName(),
+                       activeReq.getNearestLoc());
+
     recorder.endRequest<Request>(request);
 
     handleDependencySourceRequest<Request>(request);
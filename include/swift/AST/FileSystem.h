@@ -53,6 +53,48 @@ withOutputPath(DiagnosticEngine &diags, llvm::vfs::OutputBackend &Backend,
   }
   return failed;
 }
+
+/// A variant of \c withOutputPath for outputs that can be very large, such as
+/// textual SIL or AST dumps.
+///
+/// \c withOutputPath only writes a file when its contents changed, which
+/// requires buffering the entire output in memory for the comparison; a SIL
+/// dump of a large module can run to gigabytes. This variant streams the
+/// output to disk incrementally with bounded memory, at the cost of always
+/// rewriting the file (and thus refreshing its timestamp) when the contents
+/// are unchanged.
+///
+/// \returns true if there were any errors, either from the filesystem
+/// operations or from \p action returning true.
+inline bool
+withStreamingOutputPath(DiagnosticEngine &diags,
+                        llvm::vfs::OutputBackend &Backend,
+                        StringRef outputPath,
+                        llvm::function_ref<bool(raw_ostream &)> action) {
+  assert(!outputPath.empty());
+  llvm::vfs::OutputConfig config;
+  config.setAtomicWrite();
+
+  auto outputFile = Backend.createFile(outputPath, config);
+  if (!outputFile) {
+    diags.diagnose(SourceLoc(), diag::error_opening_output, outputPath,
+                   toString(outputFile.takeError()));
+    return true;
+  }
+
+  bool failed = action(*outputFile);
+  // If there is an error, discard output. Otherwise keep the output file.
+  if (auto error = failed ? outputFile->discard() : outputFile->keep()) {
+    // Don't diagnose discard error.
+    if (failed)
+      consumeError(std::move(error));
+    else
+      diags.diagnose(SourceLoc(), diag::error_closing_output, outputPath,
+                     toString(std::move(error)));
+    return true;
+  }
+  return failed;
+}
 } // end namespace swift
 
 #endif // SWIFT_AST_FILESYSTEM_H
@@ -230,6 +230,20 @@ public:
               SmallVectorImpl<Decl*> &Results,
               llvm::function_ref<bool(DeclAttributes)> matchAttributes) const;
 
+  /// Returns whether this file may contain operator declarations.
+  ///
+  /// Conservatively returns \c true by default; subclasses that can cheaply
+  /// prove the absence of operator declarations, such as Clang modules and
+  /// serialized modules with empty operator tables, override this to let
+  /// operator lookup skip them entirely.
+  virtual bool maybeHasOperatorDeclarations() const { return true; }
+
+  /// Returns whether this file may contain precedence group declarations.
+  ///
+  /// Conservatively returns \c true by default, like
+  /// \c maybeHasOperatorDeclarations().
+  virtual bool maybeHasPrecedenceGroupDecls() const { return true; }
+
   /// Finds all operator decls in this file.
   ///
   /// This does a simple local lookup, not recursively looking through imports.
@@ -382,6 +396,10 @@ public:
          ObjCSelector selector,
          SmallVectorImpl<AbstractFunctionDecl *> &results) const override;
 
+  bool maybeHasOperatorDeclarations() const override { return false; }
+
+  bool maybeHasPrecedenceGroupDecls() const override { return false; }
+
   Identifier
   getDiscriminatorForPrivateDecl(const Decl *D) const override {
     llvm_unreachable("no private values in the Builtin module");
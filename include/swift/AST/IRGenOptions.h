@@ -352,6 +352,10 @@ public:
   /// Whether we should embed the bitcode file.
   IRGenEmbedMode EmbedMode : 2;
 
+  /// Whether to embed the module's serialized SIL in the object file, for
+  /// tools that perform late, link-time optimization over SIL.
+  unsigned EmbedSIL : 1;
+
   IRGenLLVMLTOKind LLVMLTOKind : 2;
 
   SwiftAsyncFramePointerKind SwiftAsyncFramePointer : 2;
@@ -396,6 +400,13 @@ public:
   /// The path to load legacy type layouts from.
   StringRef ReadLegacyTypeInfoPath;
 
+  /// The path to a file listing the mangled names of generic type
+  /// specializations, one per line, whose metadata should be statically
+  /// specialized in addition to the specializations known to be used in
+  /// source. Typically produced from a profile of the hottest
+  /// swift_getGenericMetadata requests.
+  StringRef PrespecializeGenericMetadataListPath;
+
   /// Should we try to build incrementally by not emitting an object file if it
   /// has the same IR hash as the module that we are preparing to emit?
   ///
@@ -538,7 +549,8 @@ public:
         Playground(false), EmitStackPromotionChecks(false),
         UseSingleModuleLLVMEmission(false), FunctionSections(false),
         PrintInlineTree(false), AlwaysCompile(false),
-        EmbedMode(IRGenEmbedMode::None), LLVMLTOKind(IRGenLLVMLTOKind::None),
+        EmbedMode(IRGenEmbedMode::None), EmbedSIL(false),
+        LLVMLTOKind(IRGenLLVMLTOKind::None),
         SwiftAsyncFramePointer(SwiftAsyncFramePointerKind::Auto),
         HasValueNamesSetting(false), ValueNames(false),
         ReflectionMetadata(ReflectionMetadataMode::Runtime),
@@ -72,6 +72,8 @@ public:
   uint64_t associatedTypesData = 0;
   /// The context data used for loading the list of primary associated types.
   uint64_t primaryAssociatedTypesData = 0;
+  /// The context data used for loading the list of inherited protocols.
+  uint64_t inheritedProtocolsData = 0;
 };
 
 /// A class that can lazily load members from a serialized format.
@@ -120,6 +122,11 @@ public:
   loadPrimaryAssociatedTypes(const ProtocolDecl *proto, uint64_t contextData,
                              SmallVectorImpl<AssociatedTypeDecl *> &assocTypes) = 0;
 
+  /// Loads the inherited protocols of a protocol.
+  virtual void
+  loadInheritedProtocols(const ProtocolDecl *proto, uint64_t contextData,
+                         SmallVectorImpl<ProtocolDecl *> &inherited) = 0;
+
   /// Returns the replaced decl for a given @_dynamicReplacement(for:) attribute.
   virtual ValueDecl *
   loadDynamicallyReplacedFunctionDecl(const DynamicReplacementAttr *DRA,
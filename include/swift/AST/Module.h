@@ -1088,6 +1088,17 @@ public:
   /// The order of the results is not guaranteed to be meaningful.
   void getLocalTypeDecls(SmallVectorImpl<TypeDecl*> &Results) const;
 
+  /// Returns whether any file of this module may contain operator decls.
+  ///
+  /// This is a cheap conservative check that lets operator lookup skip
+  /// modules that are known not to declare any operators, e.g Clang modules,
+  /// without deserializing anything.
+  bool maybeHasOperatorDeclarations() const;
+
+  /// Returns whether any file of this module may contain precedence group
+  /// decls, analogously to \c maybeHasOperatorDeclarations().
+  bool maybeHasPrecedenceGroupDecls() const;
+
   /// Finds all operator decls of this module.
   ///
   /// This does a simple local lookup, not recursively looking through imports.
@@ -37,6 +37,7 @@
 #include "llvm/Support/Error.h"
 #include "llvm/Support/Mutex.h"
 #include "llvm/Support/PrefixMapper.h"
+#include "llvm/Support/RWMutex.h"
 #include "llvm/Support/VirtualFileSystem.h"
 #include <optional>
 #include <string>
@@ -1009,8 +1010,10 @@ class SwiftDependencyScanningService {
   /// which they were used
   std::vector<std::string> AllContextHashes;
 
-  /// Shared state mutual-exclusivity lock
-  mutable llvm::sys::SmartMutex<true> ScanningServiceGlobalLock;
+  /// Shared state lock. Scanning threads perform far more context-hash
+  /// lookups than context registrations, so readers take a shared lock
+  /// and only registration of a new scanning context takes it exclusive.
+  mutable llvm::sys::SmartRWMutex<true> ScanningServiceGlobalLock;
 
   /// Retrieve the dependencies map that corresponds to the given dependency
   /// kind.
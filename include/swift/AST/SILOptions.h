@@ -132,6 +132,14 @@ public:
   /// this optimization, the module also needs -allow-non-resilient-access.
   bool EnableSerializePackage = false;
 
+  /// Treat the package's class hierarchy as closed for devirtualization.
+  /// A class method defined in another module of the same package can then
+  /// be considered effectively final if no loaded module overrides it. This
+  /// is only sound when all modules of the package are co-built, and it only
+  /// applies to defining modules that serialize their package SIL
+  /// (-package-cmo) so their v-tables are visible to clients.
+  bool EnablePackageWideDevirtualization = false;
+
   /// Enables the emission of stack protectors in functions.
   bool EnableStackProtection = true;
 
@@ -224,9 +232,21 @@ public:
   /// Path to the profdata file to be used for PGO, or the empty string.
   std::string UseProfile = "";
 
+  /// Path to a file listing the mangled names of all symbols referenced from
+  /// outside the module being compiled, or the empty string. When non-empty,
+  /// dead function elimination may remove public functions that are not
+  /// named in the list.
+  std::string ExternallyUsedSymbolsFile = "";
+
   /// Emit a mapping of profile counters for use in coverage.
   bool EmitProfileCoverageMapping = false;
 
+  /// Restrict profile instrumentation to function entry and error branch
+  /// counters. The full coverage mapping is still emitted, so the remaining
+  /// regions are reported with zero counts, but the counter increments on hot
+  /// paths that dominate instrumentation overhead are omitted.
+  bool EmitSparseProfileCounters = false;
+
   bool emitTBD = false;
 
   /// Should we use a pass pipeline passed in via a json file? Null by default.
@@ -142,6 +142,16 @@ private:
   /// This is set during type checking.
   TypeRefinementContext *TRC = nullptr;
 
+  /// The innermost TypeRefinementContext returned by the most recent
+  /// availability query in this file, or null.
+  ///
+  /// Availability queries cluster heavily in the scope currently being type
+  /// checked, so the previous result is usually the right subtree to search
+  /// next, saving a descent from the root. This is purely a cache: the node
+  /// is owned by the TRC tree and the tree only ever grows, so the pointer
+  /// never dangles and a miss just restarts the search at \c TRC.
+  TypeRefinementContext *LastQueriedTRC = nullptr;
+
   /// Either the class marked \@NS/UIApplicationMain or the synthesized FuncDecl
   /// that calls main on the type marked @main.
   ValueDecl *MainDecl = nullptr;
@@ -747,6 +757,14 @@ public:
   /// Set the root refinement context for the file.
   void setTypeRefinementContext(TypeRefinementContext *TRC);
 
+  /// Get the refinement context returned by the most recent availability
+  /// query in this file, or null if there has been none yet.
+  TypeRefinementContext *getLastQueriedTypeRefinementContext() const;
+
+  /// Record the refinement context found by an availability query so the
+  /// next query can start its search there.
+  void setLastQueriedTypeRefinementContext(TypeRefinementContext *TRC);
+
   /// Whether this file can compute an interface hash.
   bool hasInterfaceHash() const {
     return ParsingOpts.contains(ParsingFlags::EnableInterfaceHash);
@@ -13,6 +13,7 @@
 #ifndef SWIFT_BASIC_FILESYSTEM_H
 #define SWIFT_BASIC_FILESYSTEM_H
 
+#include "llvm/ADT/IntrusiveRefCntPtr.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/MemoryBuffer.h"
@@ -76,6 +77,23 @@ namespace swift {
   areFilesDifferent(const llvm::Twine &source, const llvm::Twine &destination,
                     bool allowDestinationErrors);
 
+  /// Hints to the operating system that the files at \p paths will be read
+  /// soon, so that it can begin fetching them into the page cache while the
+  /// caller is still busy reading earlier files. This is purely advisory:
+  /// paths that cannot be opened are silently ignored, and platforms without
+  /// a readahead facility treat this as a no-op.
+  void prefetchFiles(llvm::ArrayRef<llvm::StringRef> paths);
+
+  /// Wraps \p base in a file system that memoizes \c status and \c getRealPath
+  /// results, including failures, for the lifetime of the wrapper.
+  ///
+  /// This assumes the underlying files do not change while the wrapper is in
+  /// use, so it is only suitable for compilation-scoped file systems.
+  /// Sandboxed builds that route every search path through a symlink forest
+  /// otherwise repeat the same stats many thousands of times per job.
+  llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> createStatCachingFileSystem(
+      llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> base);
+
   namespace vfs {
     llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>>
     getFileOrSTDIN(llvm::vfs::FileSystem &FS,
@@ -363,6 +363,16 @@ namespace swift {
     /// Whether to dump debug info for request evaluator cycles.
     bool DebugDumpCycles = false;
 
+    /// Whether to dump cumulative per-request-kind timing for the request
+    /// evaluator when the evaluator is destroyed.
+    bool DumpRequestTimers = false;
+
+    /// If non-zero, warn when evaluating a request takes longer than this
+    /// many milliseconds.
+    ///
+    /// Intended for debugging purposes only.
+    unsigned WarnLongRequestEvaluation = 0;
+
     /// Disable SIL substituted function types.
     bool DisableSubstSILFunctionTypes = false;
 
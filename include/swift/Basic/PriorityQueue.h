@@ -110,6 +110,21 @@ public:
     } while(runHead);
   }
 
+  /// Add a chain of nodes of mixed priorities that is in LIFO order
+  /// (newest node first), such as the incoming chain popped off an atomic
+  /// push stack.
+  ///
+  /// Each node is prepended to its priority bucket, so traversing the chain
+  /// newest-first leaves every bucket in FIFO order without a separate
+  /// reversal pass over the chain.
+  void enqueueContentsOfReversed(Node lifoHead) {
+    while (lifoHead) {
+      Node next = NodeTraits::getNext(lifoHead);
+      prependNode(NodeTraits::getPriorityIndex(lifoHead), lifoHead);
+      lifoHead = next;
+    }
+  }
+
   Node dequeue() {
     if (!head) {
       return head;
@@ -146,6 +161,25 @@ private:
     }
     tails[priorityIndex] = runTail;
   }
+
+  void prependNode(int priorityIndex, Node newNode) {
+    if (!tails[priorityIndex])
+      tails[priorityIndex] = newNode;
+    // Link the node in after the tail of the nearest non-empty
+    // higher-priority bucket, making it the first node of its own bucket.
+    for (int i = priorityIndex - 1;; i--) {
+      if (i < 0) {
+        NodeTraits::setNext(newNode, head);
+        head = newNode;
+        return;
+      }
+      if (tails[i]) {
+        NodeTraits::setNext(newNode, NodeTraits::getNext(tails[i]));
+        NodeTraits::setNext(tails[i], newNode);
+        return;
+      }
+    }
+  }
 };
 
 } // end namespace swift
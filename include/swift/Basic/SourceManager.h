@@ -18,6 +18,7 @@
 #include "clang/Basic/FileManager.h"
 #include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/DenseSet.h"
+#include "llvm/ADT/SmallVector.h"
 #include "llvm/Support/SourceMgr.h"
 #include <map>
 #include <optional>
@@ -148,6 +149,11 @@ private:
   /// buffer ID.
   mutable BufferLocCache LocCache;
 
+  /// Per-buffer offsets of the start of each line, built once by scanning
+  /// the whole buffer for newlines and then shared by every consumer that
+  /// resolves locations in that buffer (diagnostics, ASTScope, coverage...).
+  mutable llvm::DenseMap<unsigned, std::vector<unsigned>> LineStartOffsetsCache;
+
   std::optional<unsigned> findBufferContainingLocInternal(SourceLoc Loc) const;
 
 public:
@@ -423,7 +429,7 @@ public:
     assert(Loc.isValid());
     int LineOffset = getLineOffset(Loc);
     int l, c;
-    std::tie(l, c) = LLVMSourceMgr.getLineAndColumn(Loc.Value, BufferID);
+    std::tie(l, c) = getLineAndColumnInBuffer(Loc, BufferID);
     assert(LineOffset+l > 0 && "bogus line offset");
     return { LineOffset + l, c };
   }
@@ -436,9 +442,35 @@ public:
   std::pair<unsigned, unsigned>
   getLineAndColumnInBuffer(SourceLoc Loc, unsigned BufferID = 0) const {
     assert(Loc.isValid());
-    return LLVMSourceMgr.getLineAndColumn(Loc.Value, BufferID);
+    if (BufferID == 0)
+      BufferID = findBufferContainingLoc(Loc);
+    return getLineAndColumnForOffset(BufferID,
+                                     getLocOffsetInBuffer(Loc, BufferID));
   }
 
+  /// Returns the offset at which each line of the given buffer begins,
+  /// computing and caching the index on first use. Line \c N (1-based)
+  /// begins at offset \c Result[N-1].
+  llvm::ArrayRef<unsigned> getLineStartOffsets(unsigned BufferID) const;
+
+  /// Returns the 1-based line and column for the given offset in the given
+  /// buffer using the cached line index.
+  ///
+  /// This does not respect \c #sourceLocation directives.
+  std::pair<unsigned, unsigned>
+  getLineAndColumnForOffset(unsigned BufferID, unsigned Offset) const;
+
+  /// Resolves many locations from one buffer against the cached line index
+  /// in a single call, appending a 1-based (line, column) pair to \p Result
+  /// for each location in order. This is cheaper than resolving the
+  /// locations one by one when many of them land on the same or neighboring
+  /// lines.
+  ///
+  /// This does not respect \c #sourceLocation directives.
+  void getLineAndColumnsInBuffer(
+      unsigned BufferID, llvm::ArrayRef<SourceLoc> Locs,
+      llvm::SmallVectorImpl<std::pair<unsigned, unsigned>> &Result) const;
+
   /// Returns the column for the given source location in the given buffer.
   unsigned getColumnInBuffer(SourceLoc Loc, unsigned BufferID) const;
 
@@ -49,6 +49,18 @@
 //    - Opens $dir/stats-$timestamp-$name-$random.json for writing
 //    - Calls llvm::PrintStatisticsJSON(ostream) and/or its own writer
 //
+//  - If -stream-stats-events was passed, also appends fixed-layout binary
+//    counter records to $dir/stats.swiftstats while the frontend runs, so
+//    counters from many concurrent jobs can be followed live from a single
+//    file (see utils/follow-stats-stream.py) rather than collected by
+//    parsing one JSON file per process exit.
+//
+//  - If -trace-stats-chrome was passed, also records one completed span per
+//    FrontendStatsTracer and writes $dir/chrometrace-$timestamp-$name.json
+//    in Chrome trace-event format on exit, so the time-ordered hierarchy of
+//    frontend phases can be viewed as a flamegraph in chrome://tracing,
+//    Perfetto or speedscope.
+//
 // Generally we make one of these per-process: either early in the life of the
 // driver, or early in the life of the frontend.
 
@@ -57,6 +69,10 @@ namespace clang {
   class SourceManager;
 }
 
+namespace llvm {
+  class raw_fd_ostream;
+}
+
 namespace swift {
 
 class Decl;
@@ -128,6 +144,18 @@ public:
     const TraceFormatter *Formatter;
   };
 
+  // One completed FrontendStatsTracer span, recorded when the tracer exits.
+  // Tracers nest strictly, so start/duration pairs on a single thread are
+  // enough for trace viewers to rebuild the phase hierarchy.
+  struct FrontendStatsSpan
+  {
+    uint64_t StartUSec;
+    uint64_t DurationUSec;
+    StringRef EventName;
+    const void *Entity;
+    const TraceFormatter *Formatter;
+  };
+
   // We only write fine-grained trace entries when the user passed
   // -trace-stats-events, but we recycle the same FrontendStatsTracers to give
   // us some free recursion-save phase timings whenever -trace-stats-dir is
@@ -149,6 +177,9 @@ private:
   SmallString<128> StatsFilename;
   SmallString<128> TraceFilename;
   SmallString<128> ProfileDirname;
+  SmallString<128> StreamFilename;
+  SmallString<128> ChromeTraceFilename;
+  std::string StreamAuxName;
   llvm::TimeRecord StartedTime;
   std::thread::id MainThreadID;
 
@@ -161,18 +192,26 @@ private:
   std::optional<AlwaysOnFrontendCounters> FrontendCounters;
   std::optional<AlwaysOnFrontendCounters> LastTracedFrontendCounters;
   std::optional<std::vector<FrontendStatsEvent>> FrontendStatsEvents;
+  std::optional<std::vector<FrontendStatsSpan>> FrontendStatsSpans;
 
   // These are unique_ptr so we can use incomplete types here.
   std::unique_ptr<RecursionSafeTimers> RecursiveTimers;
   std::unique_ptr<StatsProfilers> EventProfilers;
   std::unique_ptr<StatsProfilers> EntityProfilers;
 
+  // Open append-mode stream for -stream-stats-events, shared between all
+  // frontends writing into the same -stats-output-dir; plus the time we last
+  // appended a record, used to rate-limit sampling.
+  std::unique_ptr<llvm::raw_fd_ostream> StatsStream;
+  uint64_t LastStreamedUSec = 0;
+
   /// Whether we are currently flushing statistics and should not therefore
   /// record any additional stats until we've finished.
   bool IsFlushingTracesAndProfiles;
 
   void publishAlwaysOnStatsToLLVM();
   void printAlwaysOnStatsAndTimers(raw_ostream &OS);
+  void streamAlwaysOnStats(bool IsFinal);
 
   UnifiedStatsReporter(StringRef ProgramName,
                        StringRef AuxName,
@@ -181,7 +220,9 @@ private:
                        clang::SourceManager *CSM,
                        bool TraceEvents,
                        bool ProfileEvents,
-                       bool ProfileEntities);
+                       bool ProfileEntities,
+                       bool StreamEvents,
+                       bool ChromeTraceEvents);
 public:
   UnifiedStatsReporter(StringRef ProgramName,
                        StringRef ModuleName,
@@ -194,7 +235,9 @@ public:
                        clang::SourceManager *CSM=nullptr,
                        bool TraceEvents=false,
                        bool ProfileEvents=false,
-                       bool ProfileEntities=false);
+                       bool ProfileEntities=false,
+                       bool StreamEvents=false,
+                       bool ChromeTraceEvents=false);
   ~UnifiedStatsReporter();
 
   AlwaysOnDriverCounters &getDriverCounters();
@@ -110,6 +110,14 @@ class TaskQueue {
   /// The number of tasks to execute in parallel.
   unsigned NumberOfParallelTasks;
 
+  /// An optional bound, in bytes, on the total memory predicted to be in use
+  /// by executing tasks. If nonzero, the TaskQueue stops launching new tasks
+  /// whenever the running average of the maximum resident set sizes observed
+  /// for finished tasks predicts that one more task would exceed the budget,
+  /// even if fewer than NumberOfParallelTasks tasks are executing. 0 if
+  /// unlimited.
+  uint64_t MemoryBudget;
+
   /// Optional place to count I/O and subprocess events.
   UnifiedStatsReporter *Stats;
 
@@ -120,8 +128,11 @@ public:
   /// be run in parallel. If 0, the TaskQueue will choose the most appropriate
   /// number of parallel tasks for the current system.
   /// \param USR Optional stats reporter to count I/O and subprocess events.
+  /// \param MemoryBudget if nonzero, a bound, in bytes, on the total memory
+  /// predicted to be in use by executing tasks.
   TaskQueue(unsigned NumberOfParallelTasks = 0,
-            UnifiedStatsReporter *USR = nullptr);
+            UnifiedStatsReporter *USR = nullptr,
+            uint64_t MemoryBudget = 0);
   virtual ~TaskQueue();
 
   // TODO: remove once -Wdocumentation stops warning for \param, \returns on
@@ -196,6 +207,10 @@ public:
   /// parallel
   unsigned getNumberOfParallelTasks() const;
 
+  /// \returns the bound, in bytes, on the total memory predicted to be in use
+  /// by executing tasks, or 0 if unlimited
+  uint64_t getMemoryBudget() const { return MemoryBudget; }
+
   /// Adds a task to the TaskQueue.
   ///
   /// \param ExecPath the path to the executable which the task should execute
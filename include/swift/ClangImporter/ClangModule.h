@@ -89,6 +89,11 @@ public:
          ObjCSelector selector,
          SmallVectorImpl<AbstractFunctionDecl *> &results) const override;
 
+  /// Clang modules cannot declare Swift operators or precedence groups.
+  virtual bool maybeHasOperatorDeclarations() const override { return false; }
+
+  virtual bool maybeHasPrecedenceGroupDecls() const override { return false; }
+
   virtual bool shouldCollectDisplayDecls() const override;
 
   virtual void getTopLevelDecls(SmallVectorImpl<Decl*> &results) const override;
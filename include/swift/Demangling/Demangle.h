@@ -660,6 +660,15 @@ using SymbolicResolver =
 /// symbolic references.
 ManglingErrorOr<std::string> mangleNode(NodePointer root, SymbolicResolver resolver);
 
+/// Remangle a demangled parse tree, allocating from \p Factory.
+///
+/// Sharing the factory which owns the node tree avoids a separate allocation
+/// for the remangler's temporaries and output.
+/// The returned string is owned by \p Factory. This means \p Factory must stay
+/// alive as long as the returned string is used.
+ManglingErrorOr<llvm::StringRef> mangleNode(NodePointer root,
+                                            NodeFactory &Factory);
+
 /// Remangle a demangled parse tree, using a callback to resolve
 /// symbolic references.
 ///
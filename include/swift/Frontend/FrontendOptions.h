@@ -235,6 +235,14 @@ public:
   /// entity.
   bool ProfileEntities = false;
 
+  /// Stream binary counter records to a shared file in StatsOutputDir while
+  /// compiling, for live monitoring across many jobs.
+  bool StreamStats = false;
+
+  /// Write a Chrome trace-event JSON file of hierarchical frontend phase
+  /// spans to StatsOutputDir, for flamegraph-style viewing.
+  bool TraceStatsChrome = false;
+
   /// Emit parseable-output directly from the frontend, instead of relying
   /// the driver to emit it. This is used in context where frontend jobs are executed by
   /// clients other than the driver.
@@ -322,6 +330,15 @@ public:
   /// Should we enable the dependency verifier for all primary files known to this frontend?
   bool EnableIncrementalDependencyVerifier = false;
 
+  /// Cache file status and symlink resolution results for the duration of
+  /// the compilation. Assumes the inputs do not change while the compiler is
+  /// running.
+  bool EnableFileSystemStatCache = false;
+
+  /// If non-zero, warn when the memory retained by the AST and SIL arenas
+  /// exceeds this many megabytes.
+  unsigned MemoryWatermarkMB = 0;
+
   /// The path of the swift-frontend executable.
   std::string MainExecutablePath;
 
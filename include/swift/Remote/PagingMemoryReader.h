@@ -0,0 +1,153 @@
+//===--- PagingMemoryReader.h - Page-caching MemoryReader -------*- C++ -*-===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2017 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+//  This file declares an implementation of MemoryReader that serves small
+//  reads from an LRU cache of pages bulk-fetched through another reader.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef SWIFT_REMOTE_PAGINGMEMORYREADER_H
+#define SWIFT_REMOTE_PAGINGMEMORYREADER_H
+
+#include "swift/Remote/MemoryReader.h"
+
+#include <list>
+#include <unordered_map>
+
+namespace swift {
+namespace remote {
+
+/// A memory reader that wraps another reader and caches its contents in
+/// fixed-size pages.
+///
+/// Metadata and reflection walks issue many small, clustered reads; over a
+/// slow transport (a network debug connection, a core file served remotely)
+/// the per-read round-trip dominates. This reader turns each cache miss into
+/// one page-sized bulk fetch through the underlying reader and serves
+/// subsequent reads of nearby fields from the cached page.
+///
+/// The cache reflects target memory at the time each page was fetched. If
+/// the inspected process can run between queries, call invalidateCache()
+/// whenever it may have mutated memory.
+class PagingMemoryReader : public MemoryReader {
+  std::shared_ptr<MemoryReader> Base;
+
+  uint64_t PageSize;
+  size_t MaxPages;
+
+  struct Page {
+    uint64_t BaseAddress;
+    std::unique_ptr<uint8_t[]> Bytes;
+  };
+
+  /// Most-recently-used pages first; bounded by MaxPages.
+  std::list<Page> Pages;
+  std::unordered_map<uint64_t, std::list<Page>::iterator> PagesByAddress;
+
+  /// Returns the cached page containing \p pageAddress, fetching and
+  /// inserting it on a miss. Returns null if the underlying reader cannot
+  /// provide the whole page.
+  const Page *getPage(uint64_t pageAddress) {
+    auto known = PagesByAddress.find(pageAddress);
+    if (known != PagesByAddress.end()) {
+      Pages.splice(Pages.begin(), Pages, known->second);
+      return &*known->second;
+    }
+
+    auto bytes = std::make_unique<uint8_t[]>(PageSize);
+    if (!Base->readBytes(RemoteAddress(pageAddress), bytes.get(), PageSize))
+      return nullptr;
+
+    if (Pages.size() >= MaxPages) {
+      PagesByAddress.erase(Pages.back().BaseAddress);
+      Pages.pop_back();
+    }
+    Pages.push_front(Page{pageAddress, std::move(bytes)});
+    PagesByAddress.insert({pageAddress, Pages.begin()});
+    return &Pages.front();
+  }
+
+public:
+  explicit PagingMemoryReader(std::shared_ptr<MemoryReader> Base,
+                              uint64_t PageSize = 4096,
+                              size_t MaxPages = 256)
+      : Base(std::move(Base)), PageSize(PageSize), MaxPages(MaxPages) {
+    assert(this->Base && "No underlying reader");
+    assert((PageSize & (PageSize - 1)) == 0 && "Page size must be a power of two");
+  }
+
+  /// Drop all cached pages, e.g. after the inspected process has run.
+  void invalidateCache() {
+    Pages.clear();
+    PagesByAddress.clear();
+  }
+
+  bool queryDataLayout(DataLayoutQueryType type, void *inBuffer,
+                       void *outBuffer) override {
+    return Base->queryDataLayout(type, inBuffer, outBuffer);
+  }
+
+  RemoteAddress getSymbolAddress(const std::string &name) override {
+    return Base->getSymbolAddress(name);
+  }
+
+  bool readString(RemoteAddress address, std::string &dest) override {
+    // The string length is not known up front, so let the underlying reader
+    // use whatever length-probing mechanism it has.
+    return Base->readString(address, dest);
+  }
+
+  bool readBytes(RemoteAddress address, uint8_t *dest,
+                 uint64_t size) override {
+    uint64_t addr = address.getAddressData();
+    while (size > 0) {
+      uint64_t pageAddress = addr & ~(PageSize - 1);
+      const Page *page = getPage(pageAddress);
+      if (!page) {
+        // The whole page is not readable, e.g. because the range ends near
+        // an unmapped region. Fall back to an uncached read of exactly the
+        // bytes requested.
+        return Base->readBytes(RemoteAddress(addr), dest, size);
+      }
+      uint64_t offset = addr - pageAddress;
+      uint64_t chunk = std::min(size, PageSize - offset);
+      memcpy(dest, page->Bytes.get() + offset, chunk);
+      addr += chunk;
+      dest += chunk;
+      size -= chunk;
+    }
+    return true;
+  }
+
+  RemoteAbsolutePointer resolvePointer(RemoteAddress address,
+                                       uint64_t readValue) override {
+    return Base->resolvePointer(address, readValue);
+  }
+
+  std::optional<RemoteAbsolutePointer>
+  resolvePointerAsSymbol(RemoteAddress address) override {
+    return Base->resolvePointerAsSymbol(address);
+  }
+
+  RemoteAbsolutePointer getSymbol(RemoteAddress address) override {
+    return Base->getSymbol(address);
+  }
+
+  RemoteAbsolutePointer getDynamicSymbol(RemoteAddress address) override {
+    return Base->getDynamicSymbol(address);
+  }
+};
+
+} // end namespace remote
+} // end namespace swift
+
+#endif // SWIFT_REMOTE_PAGINGMEMORYREADER_H
@@ -538,6 +538,12 @@ public:
     std::unordered_map<std::string, RemoteRef<FieldDescriptor>>
         FieldTypeInfoCache;
 
+    /// Mangled names known to have no field descriptor, along with the
+    /// number of reflection infos that had been registered when the lookup
+    /// failed. A recorded miss stays valid until more reflection infos are
+    /// added.
+    std::unordered_map<std::string, size_t> NegativeFieldTypeInfoCache;
+
     /// Cache for normalized reflection name lookups.
     std::unordered_map<uint64_t /* remote address */,
                        std::optional<std::string>>
@@ -943,6 +943,12 @@ void swift_job_run_on_serial_and_task_executor(Job *job,
 SWIFT_EXPORT_FROM(swift_Concurrency) SWIFT_CC(swift)
 AsyncTask *swift_task_getCurrent(void);
 
+/// Print the retained contents of the in-memory task trace ring buffers to
+/// stderr. Intended to be called from hang or crash handlers; safe to call
+/// at any time, though entries may be overwritten while the dump runs.
+SWIFT_EXPORT_FROM(swift_Concurrency) SWIFT_CC(swift)
+void swift_task_dumpTraceBuffer(void);
+
 /// Return the current thread's active executor reference.
 SWIFT_EXPORT_FROM(swift_Concurrency) SWIFT_CC(swift)
 SerialExecutorRef swift_task_getCurrentExecutor(void);
@@ -96,20 +96,51 @@ private:
     }
   };
   
+  /// The number of stripes the reader count is split over. Each stripe lives
+  /// on its own cache line, so snapshot acquisition on different cores does
+  /// not bounce a single line back and forth. The writer sums all stripes
+  /// when checking for active readers; correctness does not depend on which
+  /// stripe a reader picks, only that it releases the one it acquired.
+  static const unsigned NumReaderStripes = 8;
+
+  struct alignas(64) ReaderCountStripe {
+    std::atomic<size_t> Count{0};
+  };
+
   size_t Capacity;
-  std::atomic<size_t> ReaderCount;
+  std::atomic<size_t> ElementCount{0};
+  ReaderCountStripe ReaderCounts[NumReaderStripes];
   std::atomic<Storage *> Elements;
   Mutex WriterLock;
   ConcurrentFreeListNode *FreeList{nullptr};
 
-  void incrementReaders() {
-    ReaderCount.fetch_add(1, std::memory_order_acquire);
+  /// Pick a reader-count stripe for the calling thread. Distinct threads have
+  /// distinct stacks, so hashing a stack address spreads contending threads
+  /// over the stripes without needing thread-local state.
+  unsigned currentReaderStripe() {
+    char marker;
+    auto addr = reinterpret_cast<uintptr_t>(&marker);
+    return (addr >> 16) % NumReaderStripes;
   }
-  
-  void decrementReaders() {
-    ReaderCount.fetch_sub(1, std::memory_order_release);
+
+  unsigned incrementReaders() {
+    auto stripe = currentReaderStripe();
+    ReaderCounts[stripe].Count.fetch_add(1, std::memory_order_acquire);
+    return stripe;
   }
-  
+
+  void decrementReaders(unsigned stripe) {
+    ReaderCounts[stripe].Count.fetch_sub(1, std::memory_order_release);
+  }
+
+  bool hasActiveReaders(std::memory_order order) {
+    for (auto &stripe : ReaderCounts)
+      if (stripe.Count.load(order) != 0)
+        return true;
+    return false;
+  }
+
+
   void deallocateFreeList() {
     ConcurrentFreeListNode::freeAll(&FreeList, [](void *ptr) {
       reinterpret_cast<Storage *>(ptr)->deallocate();
@@ -121,17 +152,21 @@ public:
     ConcurrentReadableArray *Array;
     const ElemTy *Start;
     size_t Count;
-    
-    Snapshot(ConcurrentReadableArray *array, const ElemTy *start, size_t count)
-      : Array(array), Start(start), Count(count) {}
-    
+    unsigned ReaderStripe;
+
+    Snapshot(ConcurrentReadableArray *array, const ElemTy *start, size_t count,
+             unsigned readerStripe)
+      : Array(array), Start(start), Count(count), ReaderStripe(readerStripe) {}
+
     Snapshot(const Snapshot &other)
-      : Array(other.Array), Start(other.Start), Count(other.Count) {
-      Array->incrementReaders();
+      : Array(other.Array), Start(other.Start), Count(other.Count),
+        ReaderStripe(other.ReaderStripe) {
+      Array->ReaderCounts[ReaderStripe].Count.fetch_add(
+          1, std::memory_order_acquire);
     }
-    
+
     ~Snapshot() {
-      Array->decrementReaders();
+      Array->decrementReaders(ReaderStripe);
     }
 
     // These are marked as ref-qualified (the &) to make sure they can't be
@@ -152,10 +187,10 @@ public:
   ConcurrentReadableArray(ConcurrentReadableArray &&) = delete;
   ConcurrentReadableArray &operator=(const ConcurrentReadableArray &) = delete;
   
-  ConcurrentReadableArray() : Capacity(0), ReaderCount(0), Elements(nullptr) {}
-  
+  ConcurrentReadableArray() : Capacity(0), Elements(nullptr) {}
+
   ~ConcurrentReadableArray() {
-    assert(ReaderCount.load(std::memory_order_acquire) == 0 &&
+    assert(!hasActiveReaders(std::memory_order_acquire) &&
            "deallocating ConcurrentReadableArray with outstanding snapshots");
     deallocateFreeList();
   }
@@ -182,24 +217,33 @@ public:
     
     new(&storage->data()[count]) ElemTy(elem);
     storage->Count.store(count + 1, std::memory_order_release);
-    
+    ElementCount.store(count + 1, std::memory_order_release);
+
     // The standard says that std::memory_order_seq_cst only applies to
     // read-modify-write operations, so we need an explicit fence:
     std::atomic_thread_fence(std::memory_order_seq_cst);
-    if (ReaderCount.load(std::memory_order_relaxed) == 0)
+    if (!hasActiveReaders(std::memory_order_relaxed))
       deallocateFreeList();
   }
 
+  /// Return the number of elements without registering as a reader. Unlike
+  /// snapshot().count(), this touches no shared line that other readers
+  /// write. The result may be immediately stale, the same as for a count
+  /// obtained through a snapshot.
+  size_t count() {
+    return ElementCount.load(std::memory_order_acquire);
+  }
+
   Snapshot snapshot() {
-    incrementReaders();
+    auto stripe = incrementReaders();
     auto *storage = Elements.load(SWIFT_MEMORY_ORDER_CONSUME);
     if (storage == nullptr) {
-      return Snapshot(this, nullptr, 0);
+      return Snapshot(this, nullptr, 0, stripe);
     }
-    
+
     auto count = storage->Count.load(std::memory_order_acquire);
     const auto *ptr = storage->data();
-    return Snapshot(this, ptr, count);
+    return Snapshot(this, ptr, count, stripe);
   }
 };
 
@@ -752,7 +796,23 @@ public:
   /// indices and elements.
   void clear() {
     typename MutexTy::ScopedLock guard(WriterLock);
+    clearLocked();
+  }
 
+  /// Clear the hash table as in `clear()`, but only if \p shouldClear returns
+  /// true. The predicate is evaluated with the writer lock held, so it is
+  /// ordered with respect to all insertions: any in-flight getOrInsert has
+  /// completed before the predicate runs.
+  template <class F> void clearIf(const F &shouldClear) {
+    typename MutexTy::ScopedLock guard(WriterLock);
+    if (!shouldClear())
+      return;
+    clearLocked();
+  }
+
+private:
+  /// Implementation of clearing, to be called with the writer lock held.
+  void clearLocked() {
     IndexStorage indices = Indices.load(std::memory_order_relaxed);
     auto *elements = Elements.load(std::memory_order_relaxed);
 
@@ -853,6 +913,7 @@ struct StableAddressConcurrentReadableHashMap
 private:
   // Clearing would require deallocating elements, which we don't support.
   void clear() = delete;
+  template <class F> void clearIf(const F &) = delete;
 };
 
 } // end namespace swift
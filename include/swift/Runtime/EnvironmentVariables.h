@@ -59,6 +59,10 @@ SWIFT_RUNTIME_STDLIB_SPI bool concurrencyEnableCooperativeQueues();
 // Concurrency library can call.
 SWIFT_RUNTIME_STDLIB_SPI bool concurrencyValidateUncheckedContinuations();
 
+// Wrapper around SWIFT_DEBUG_TASK_TRACE_BUFFER that the Concurrency library
+// can call.
+SWIFT_RUNTIME_STDLIB_SPI bool concurrencyTaskTraceBufferEnabled();
+
 // Wrapper around SWIFT_IS_CURRENT_EXECUTOR_LEGACY_MODE_OVERRIDE that the
 // Concurrency library can call.
 SWIFT_RUNTIME_STDLIB_SPI const char *concurrencyIsCurrentExecutorLegacyModeOverride();
@@ -1073,6 +1073,25 @@ const Metadata *_swift_instantiateCheckedGenericMetadata(
     const void * const *genericArgs,
     size_t genericArgsSize);
 
+/// Prewarm the runtime's type metadata and protocol conformance caches for
+/// one entry of a manifest of mangled type names recorded in a previous run.
+///
+/// Instantiates the complete type metadata for the given mangled type name,
+/// populating the generic metadata caches for the type and everything it
+/// transitively depends on. If \p protocol is not null, additionally performs
+/// a conformance check so that the conformance cache is populated as well.
+///
+/// All of the caches involved are safe for concurrent access, so a manifest
+/// can be replayed on a background thread while the rest of the program runs;
+/// later lookups on hot paths then hit the warmed caches.
+///
+/// Returns false if the type name did not resolve in this run, e.g. because
+/// the manifest is stale.
+SWIFT_RUNTIME_EXPORT SWIFT_CC(swift)
+bool swift_prewarmMetadataCaches(const char *typeNameStart,
+                                 size_t typeNameLength,
+                                 const ProtocolDescriptor *protocol);
+
 #pragma clang diagnostic pop
 
 } // end namespace swift
@@ -36,6 +36,11 @@ bool calleesAreStaticallyKnowable(SILModule &module, SILDeclRef decl);
 /// be reached by calling the function represented by Decl?
 bool calleesAreStaticallyKnowable(SILModule &module, ValueDecl *vd);
 
+/// Whether \p vd is defined in another module of the same package that was
+/// built with -package-cmo, and package-wide devirtualization is enabled, so
+/// all possible overrides of \p vd are visible to this compilation.
+bool isDeclInCoBuiltPackageModule(SILModule &module, const ValueDecl *vd);
+
 /// CalleeList is a data structure representing the list of potential
 /// callees at a particular apply site. It also has a query that
 /// allows a client to determine whether the list is incomplete in the
@@ -161,6 +161,19 @@ public:
     return availability;
   }
 
+  /// Returns the specialized function type previously derived from this
+  /// attribute by the generic specializer, or null if none has been cached.
+  CanSILFunctionType getCachedSpecializedType() const {
+    return cachedSpecializedType;
+  }
+
+  /// Caches the specialized function type derived from this attribute, so
+  /// that later apply sites can reject a non-matching prespecialization
+  /// candidate without rebuilding its ReabstractionInfo.
+  void setCachedSpecializedType(CanSILFunctionType type) {
+    cachedSpecializedType = type;
+  }
+
   void print(llvm::raw_ostream &OS) const;
 
 private:
@@ -168,6 +181,7 @@ private:
   bool exported;
   GenericSignature specializedSignature;
   GenericSignature unerasedSpecializedSignature;
+  CanSILFunctionType cachedSpecializedType;
   llvm::SmallVector<Type, 2> typeErasedParams;
   Identifier spiGroup;
   AvailabilityContext availability;
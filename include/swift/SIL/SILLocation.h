@@ -126,6 +126,8 @@ protected:
 
 private:
   friend class SILInstruction;
+  /// For uniquing ExtendedASTNodeLocs in the module.
+  friend class SILModule;
 
   /// Each kind corresponds to a union member in `Storage`.
   enum StorageKind : uint8_t {
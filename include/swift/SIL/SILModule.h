@@ -316,6 +316,12 @@ private:
   llvm::DenseMap<std::pair<Decl *, VarDecl *>, unsigned> fieldIndices;
   llvm::DenseMap<EnumElementDecl *, unsigned> enumCaseIndices;
 
+  /// Uniquing map for the ExtendedASTNodeLocs referenced by SILLocations
+  /// whose diagnostic and debug locations differ. Keyed by the opaque values
+  /// of the two AST node fields.
+  llvm::DenseMap<std::pair<void *, void *>, SILLocation::ExtendedASTNodeLoc *>
+      ExtendedASTNodeLocs;
+
   /// The stage of processing this module is at.
   SILStage Stage;
 
@@ -495,6 +501,16 @@ public:
 
   unsigned getCaseIndex(EnumElementDecl *enumElement);
 
+  /// Return a uniqued ExtendedASTNodeLoc with the given diagnostic and
+  /// debugging AST nodes. The nodes live in the module's bump allocator and
+  /// the optimizer creates them in bulk, so sharing them cuts SIL memory.
+  ///
+  /// Only use this for locations that are never mutated in place (see
+  /// \c SILLocation::pointToEnd()).
+  SILLocation::ExtendedASTNodeLoc *
+  getOrCreateExtendedASTNodeLoc(SILLocation::ASTNodeTy primary,
+                                SILLocation::ASTNodeTy forDebugging);
+
   /// Called by SILBuilder whenever a new instruction is created and inserted.
   void notifyAddedInstruction(SILInstruction *inst);
 
@@ -1011,6 +1027,12 @@ public:
   /// Allocate memory for an instruction using the module's internal allocator.
   void *allocateInst(unsigned Size, unsigned Align) const;
 
+  /// An approximation of the memory retained by this module's allocator,
+  /// used for memory watermark reporting.
+  size_t getTotalMemory() const {
+    return sizeof(*this) + BPA.getTotalMemory();
+  }
+
   /// Called before \p I is removed from its basic block and scheduled for
   /// deletion.
   void willDeleteInstruction(SILInstruction *I);
@@ -63,6 +63,9 @@ public:
     return ProfileCounterRef(node, Kind::ErrorBranch);
   }
 
+  /// Retrieve the kind of counter reference.
+  Kind getKind() const { return RefKind; }
+
   /// Retrieve the corresponding location of the counter.
   SILLocation getLocation() const;
 
@@ -94,6 +97,8 @@ private:
 
   bool EmitCoverageMapping;
 
+  bool SparseCounters;
+
   SILCoverageMap *CovMap = nullptr;
 
   StringRef CurrentFileName;
@@ -112,8 +117,10 @@ private:
 
   std::vector<std::tuple<std::string, uint64_t, std::string>> CoverageData;
 
-  SILProfiler(SILModule &M, SILDeclRef forDecl, bool EmitCoverageMapping)
-      : M(M), forDecl(forDecl), EmitCoverageMapping(EmitCoverageMapping) {}
+  SILProfiler(SILModule &M, SILDeclRef forDecl, bool EmitCoverageMapping,
+              bool SparseCounters)
+      : M(M), forDecl(forDecl), EmitCoverageMapping(EmitCoverageMapping),
+        SparseCounters(SparseCounters) {}
 
 public:
   static SILProfiler *create(SILModule &M, SILDeclRef Ref);
@@ -151,6 +158,12 @@ public:
     return RegionCounterMap.contains(ref);
   }
 
+  /// Whether an increment should be emitted for the given counter reference.
+  /// With sparse instrumentation, only the function entry counter and error
+  /// branch counters are incremented; the remaining counter slots are still
+  /// reserved so the coverage mapping is unaffected.
+  bool shouldEmitIncrementFor(ProfileCounterRef ref);
+
 private:
   /// Map counters to ASTNodes and set them up for profiling the function.
   void assignRegionCounters();
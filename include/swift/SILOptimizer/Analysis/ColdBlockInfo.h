@@ -17,6 +17,7 @@
 #include "swift/SIL/SILValue.h"
 
 namespace swift {
+class CondBranchInst;
 class DominanceAnalysis;
 class SILBasicBlock;
 
@@ -47,6 +48,8 @@ class ColdBlockInfo {
 
   BranchHint getBranchHint(SILValue Cond, int recursionDepth);
 
+  BranchHint getProfileHint(const CondBranchInst *CBI);
+
   bool isSlowPath(const SILBasicBlock *FromBB, const SILBasicBlock *ToBB,
                   int recursionDepth);
 
@@ -19,6 +19,8 @@
 #ifndef SWIFT_SILOPTIMIZER_ANALYSIS_EPILOGUEARCANALYSIS_H
 #define SWIFT_SILOPTIMIZER_ANALYSIS_EPILOGUEARCANALYSIS_H
 
+#include "swift/SIL/BasicBlockBits.h"
+#include "swift/SIL/NodeBits.h"
 #include "swift/SIL/SILValue.h"
 #include "swift/SIL/SILArgument.h"
 #include "swift/SILOptimizer/Analysis/Analysis.h"
@@ -59,6 +61,9 @@ public:
 private:
   SILPassManager *PM;
 
+  /// The function we are finding epilogue ARC instructions in.
+  SILFunction *F;
+
   /// Current post-order we are using.
   LazyFunctionInfo<PostOrderAnalysis, PostOrderFunctionInfo> PO;
 
@@ -79,8 +84,9 @@ private:
   /// The epilogue retains or releases.
   llvm::SmallSetVector<SILInstruction *, 1> EpilogueARCInsts; 
 
-  /// The exit blocks of the function.
-  llvm::SmallPtrSet<SILBasicBlock *, 2> ExitBlocks;
+  /// The exit blocks of the function, tracked as a dense per-block bit.
+  /// Points to a set that only lives for the duration of \c run.
+  BasicBlockSet *ExitBlocks = nullptr;
 
   /// Returns the EpilogueARCBlockState for \p BB. If \p BB is unreachable,
   /// returns None
@@ -105,7 +111,7 @@ private:
 
   /// Return true if this is a function exit block.
   bool isExitBlock(SILBasicBlock *BB) {
-    return ExitBlocks.count(BB);
+    return ExitBlocks->contains(BB);
   }
 
   /// Return true if this is a retain instruction.
@@ -132,20 +138,26 @@ public:
   /// Constructor.
   EpilogueARCContext(SILFunction *F, PostOrderAnalysis *PO, SILPassManager *PM,
                      RCIdentityAnalysis *RCIA)
-      : PM(PM), PO(F, PO), RCFI(F, RCIA) {}
+      : PM(PM), F(F), PO(F, PO), RCFI(F, RCIA) {}
 
   /// Run the data flow to find the epilogue retains or releases.
   bool run(EpilogueARCKind NewKind, SILValue NewArg) {
     Kind = NewKind;
     Arg = NewArg;
 
-    // Initialize the epilogue arc data flow context.
+    // The exit block set only lives for the duration of the dataflow; it
+    // cannot be a member because this context is cached across passes while
+    // block bitfields must be stack-scoped within a function.
+    BasicBlockSet exitBlocks(F);
+    ExitBlocks = &exitBlocks;
+
+    // Initialize the epilogue arc data flow context, converge the data flow
+    // and, lastly, find the epilogue ARC instructions.
     initializeDataflow();
-    // Converge the data flow.
-    if (!convergeDataflow())
-      return false;
-    // Lastly, find the epilogue ARC instructions.
-    return computeEpilogueARC();
+    bool Result = convergeDataflow() && computeEpilogueARC();
+
+    ExitBlocks = nullptr;
+    return Result;
   }
 
   /// Reset the epilogue arc instructions. 
@@ -156,8 +168,6 @@ public:
   void reset() {
     IndexToStateMap.clear();
     EpilogueARCInsts.clear();
-    ExitBlocks.clear();
-    EpilogueARCInsts.clear();
   }
 
   /// Initialize the data flow.
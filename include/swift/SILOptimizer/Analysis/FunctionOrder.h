@@ -38,9 +38,16 @@ private:
   // The callee analysis we use to determine the callees at each call site.
   BasicCalleeAnalysis *BCA;
 
+  /// The DFS number and minimum reachable DFS number (Tarjan's "low-link")
+  /// for a visited function, kept together so each function costs a single
+  /// hash lookup.
+  struct DFSNumbers {
+    unsigned Num;
+    unsigned MinNum;
+  };
+
   unsigned NextDFSNum;
-  llvm::DenseMap<SILFunction *, unsigned> DFSNum;
-  llvm::DenseMap<SILFunction *, unsigned> MinDFSNum;
+  llvm::DenseMap<SILFunction *, DFSNumbers> DFSInfo;
   llvm::SmallSetVector<SILFunction *, 4> DFSStack;
 
 public:
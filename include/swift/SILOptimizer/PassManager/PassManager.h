@@ -26,6 +26,7 @@
 #include "llvm/Support/ErrorHandling.h"
 #include <vector>
 #include <bitset>
+#include <optional>
 
 #ifndef SWIFT_SILOPTIMIZER_PASSMANAGER_PASSMANAGER_H
 #define SWIFT_SILOPTIMIZER_PASSMANAGER_PASSMANAGER_H
@@ -242,6 +243,10 @@ class SILPassManager {
   unsigned maxNumSubpassesToRun = UINT_MAX;
   unsigned breakBeforePassCount = UINT_MAX;
 
+  /// The wall-clock time at which non-mandatory passes stop running, if
+  /// -sil-opt-max-time is given.
+  std::optional<llvm::sys::TimePoint<>> deadline;
+
   /// For invoking Swift passes.
   SwiftPassInvocation swiftPassInvocation;
 
@@ -253,6 +258,16 @@ class SILPassManager {
   /// A completed-passes mask for each function.
   llvm::DenseMap<SILFunction *, CompletedPasses> CompletedPassesMap;
 
+  /// Monotonically increases whenever any pass reports a change to the
+  /// module, including function creation and deletion.
+  unsigned ModuleChangeGeneration = 0;
+
+  /// For each module pass kind, the value of \c ModuleChangeGeneration at
+  /// the end of its most recent run that didn't change anything. A module
+  /// pass whose recorded generation still matches is proven idle and can
+  /// be skipped, mirroring the completed-passes mask for function passes.
+  llvm::DenseMap<unsigned, unsigned> IdleModulePasses;
+
   /// Stores for each function the number of levels of specializations it is
   /// derived from an original function. E.g. if a function is a signature
   /// optimized specialization of a generic specialization, it has level 2.
@@ -335,6 +350,7 @@ public:
         AP->invalidate();
 
     CurrentPassHasInvalidated = true;
+    ++ModuleChangeGeneration;
 
     // Assume that all functions have changed. Clear all masks of all functions.
     CompletedPassesMap.clear();
@@ -369,6 +385,7 @@ public:
         AP->invalidate(F, K);
     
     CurrentPassHasInvalidated = true;
+    ++ModuleChangeGeneration;
     // Any change let all passes run again.
     CompletedPassesMap[F].reset();
   }
@@ -382,6 +399,7 @@ public:
         AP->invalidateFunctionTables();
 
     CurrentPassHasInvalidated = true;
+    ++ModuleChangeGeneration;
 
     // Assume that all functions have changed. Clear all masks of all functions.
     CompletedPassesMap.clear();
@@ -395,6 +413,7 @@ public:
         AP->notifyWillDeleteFunction(F);
 
     CurrentPassHasInvalidated = true;
+    ++ModuleChangeGeneration;
     // Any change let all passes run again.
     CompletedPassesMap[F].reset();
   }
@@ -457,6 +476,13 @@ private:
   void parsePassesToRunCount(StringRef countsStr);
   void parseBreakBeforePassCount(StringRef countsStr);
 
+  /// Returns true if the -sil-opt-max-time deadline has passed. Passes which
+  /// checkpoint their work with \p continueWithNextSubpassRun stop at the
+  /// granularity of sub-passes, all other passes at pass boundaries.
+  bool passedDeadline() const {
+    return deadline && std::chrono::system_clock::now() > *deadline;
+  }
+
   bool doPrintBefore(SILTransform *T, SILFunction *F);
 
   bool doPrintAfter(SILTransform *T, SILFunction *F, bool PassChangedSIL);
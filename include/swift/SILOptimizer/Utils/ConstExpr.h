@@ -29,6 +29,7 @@
 #include "swift/SIL/ApplySite.h"
 #include "swift/SIL/SILBasicBlock.h"
 #include "llvm/ADT/SmallPtrSet.h"
+#include <memory>
 
 namespace swift {
 class ASTContext;
@@ -36,8 +37,10 @@ class Operand;
 class SILFunction;
 class SILModule;
 class SILNode;
+class SubstitutionMap;
 class SymbolicValue;
 class SymbolicValueAllocator;
+class ConstExprCallCache;
 class ConstExprFunctionState;
 class UnknownReason;
 
@@ -59,6 +62,12 @@ class ConstExprEvaluator {
   /// provided to the clients.
   llvm::SmallPtrSet<SILFunction *, 2> calledFunctions;
 
+  /// Memoized results of calls evaluated by this evaluator, keyed by callee,
+  /// substitutions, and constant argument values. Created lazily on the first
+  /// memoizable call. The cached values live in this evaluator's allocator,
+  /// so the cache must not outlive it.
+  std::unique_ptr<ConstExprCallCache> callResultCache;
+
   void operator=(const ConstExprEvaluator &) = delete;
 
 public:
@@ -92,6 +101,24 @@ public:
   void computeConstantValues(ArrayRef<SILValue> values,
                              SmallVectorImpl<SymbolicValue> &results);
 
+  /// If a call to \p callee with the given substitutions and constant
+  /// \p arguments was evaluated before by this evaluator, set \p result to the
+  /// memoized result and return true.
+  bool lookupMemoizedCallResult(SILFunction *callee,
+                                SubstitutionMap substitutionMap,
+                                ArrayRef<SymbolicValue> arguments,
+                                SymbolicValue &result);
+
+  /// Memoize \p result as the outcome of calling \p callee with the given
+  /// substitutions and constant \p arguments. Values that carry memory
+  /// identity (addresses, arrays, closures) are never memoized, since sharing
+  /// them between call sites could alias mutable state. Memoization is also
+  /// disabled when callee tracking is enabled, because a cache hit would not
+  /// replay the transitive callees of the memoized evaluation.
+  void memoizeCallResult(SILFunction *callee, SubstitutionMap substitutionMap,
+                         ArrayRef<SymbolicValue> arguments,
+                         SymbolicValue result);
+
   void recordCalledFunctionIfEnabled(SILFunction *callee) {
     if (trackCallees) {
       calledFunctions.insert(callee);
@@ -39,8 +39,14 @@ enum class InlineSelection {
 };
 
 /// Check if this ApplySite is eligible for inlining. If so, return the callee.
-SILFunction *getEligibleFunction(FullApplySite AI,
-                                 InlineSelection WhatToInline);
+///
+/// If \p selfRecursionCache is non-null it is used to memoize whether a
+/// callee contains self-recursive calls, so that repeated apply sites of the
+/// same callee don't rescan its body.
+SILFunction *
+getEligibleFunction(FullApplySite AI, InlineSelection WhatToInline,
+                    llvm::DenseMap<SILFunction *, bool> *selfRecursionCache
+                        = nullptr);
 
 // Returns true if this is a pure call, i.e. the callee has no side-effects
 // and all arguments are constants.
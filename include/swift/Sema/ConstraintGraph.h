@@ -427,12 +427,26 @@ private:
   /// classes until a fixed point is reached.
   bool contractEdges();
 
+  /// Allocate memory for a graph node from the constraint system's
+  /// allocator, reusing the allocation of a previously removed node if one
+  /// is available.
+  void *allocateNode();
+
+  /// Destroy the given node and keep its allocation for reuse.
+  void deallocateNode(ConstraintGraphNode *node);
+
   /// The constraint system.
   ConstraintSystem &CS;
 
   /// The type variables in this graph, in stable order.
   std::vector<TypeVariableType *> TypeVariables;
 
+  /// Allocations of removed graph nodes, kept for reuse. Nodes are created
+  /// and destroyed frequently as solver scopes are pushed and popped, and
+  /// their memory comes from the constraint system's arena, so freed nodes
+  /// are recycled here rather than accumulating in the arena.
+  SmallVector<void *, 4> FreedNodes;
+
   /// Constraints that are "orphaned" because they contain no type variables.
   SmallVector<Constraint *, 4> OrphanedConstraints;
 
@@ -47,6 +47,8 @@
 #include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/ilist.h"
 #include "llvm/Support/ErrorHandling.h"
+#include "llvm/Support/MathExtras.h"
+#include "llvm/Support/MemAlloc.h"
 #include "llvm/Support/Timer.h"
 #include "llvm/Support/raw_ostream.h"
 #include <cstddef>
@@ -2132,6 +2134,139 @@ struct DeclReferenceType {
   Type thrownErrorTypeOnAccess;
 };
 
+/// A slab-based bump-pointer arena for objects whose lifetime is tied to
+/// a solver scope.
+///
+/// Solver scopes are pushed and popped in strict LIFO order while the
+/// solver explores disjunction and binding choices, which means all of
+/// the memory allocated along a failed branch can be reclaimed by
+/// rewinding the bump pointer instead of deallocating each object
+/// individually.
+class SolverScopeArena {
+  /// The size of each slab of memory, large enough to accommodate
+  /// thousands of scopes before a new slab has to be allocated.
+  static const size_t SlabSize = 1 << 16;
+
+  /// The slabs of memory allocated so far, in allocation order. The
+  /// last slab is the one currently being bump-allocated from.
+  SmallVector<char *, 4> Slabs;
+
+  /// For each slab except the current one, the value of \c CurPtr at
+  /// the point the next slab was brought in, so that rewinding across
+  /// a slab boundary can restore it.
+  SmallVector<char *, 4> SavedPtrs;
+
+  /// The first free byte in the current slab.
+  char *CurPtr = nullptr;
+
+  /// The end of the current slab.
+  char *End = nullptr;
+
+  /// A single cached slab kept around after rewinding to avoid
+  /// allocator churn when the solver repeatedly crosses a slab
+  /// boundary while backtracking.
+  char *SpareSlab = nullptr;
+
+  SolverScopeArena(const SolverScopeArena &) = delete;
+  SolverScopeArena &operator=(const SolverScopeArena &) = delete;
+
+  /// Bring in a new slab to satisfy an allocation that doesn't fit
+  /// into the current one.
+  void growSlab();
+
+public:
+  SolverScopeArena() = default;
+  ~SolverScopeArena();
+
+  /// Allocate \c bytes of memory from the arena. The result is aligned
+  /// suitably for any object type.
+  void *allocate(size_t bytes) {
+    bytes = llvm::alignTo(bytes, alignof(std::max_align_t));
+    assert(bytes <= SlabSize && "allocation doesn't fit into a slab");
+    if (LLVM_UNLIKELY(!CurPtr || size_t(End - CurPtr) < bytes))
+      growSlab();
+
+    char *result = CurPtr;
+    CurPtr += bytes;
+    return result;
+  }
+
+  /// Reclaim the memory of the most recent live allocation, together
+  /// with everything allocated after it, by rewinding the bump pointer.
+  ///
+  /// Allocations must be reclaimed in strict LIFO order.
+  void deallocate(void *ptr);
+};
+
+/// A chunked LIFO trail of solver undo records.
+///
+/// Unlike a vector, growing the trail never relocates existing records,
+/// and pushing and popping are constant-time and allocation-free except
+/// when a fresh chunk has to be brought in. A single spare chunk is kept
+/// around after popping across a chunk boundary so that the solver doesn't
+/// churn the allocator while backtracking back and forth near a boundary.
+template <typename RecordT, unsigned ChunkCapacity = 256>
+class SolverTrail {
+  static_assert(std::is_trivially_destructible<RecordT>::value,
+                "trail records are discarded without running destructors");
+
+  /// The chunks allocated so far, in allocation order. All chunks other
+  /// than the last are full.
+  SmallVector<RecordT *, 4> Chunks;
+
+  /// A single cached chunk kept around after popping across a chunk
+  /// boundary.
+  RecordT *Spare = nullptr;
+
+  /// The number of records in the last chunk. When there are no chunks,
+  /// this is ChunkCapacity so that the first push brings one in.
+  unsigned TopIndex = ChunkCapacity;
+
+  SolverTrail(const SolverTrail &) = delete;
+  SolverTrail &operator=(const SolverTrail &) = delete;
+
+public:
+  SolverTrail() = default;
+
+  ~SolverTrail() {
+    for (RecordT *chunk : Chunks)
+      free(chunk);
+    free(Spare);
+  }
+
+  bool empty() const { return Chunks.empty(); }
+
+  /// Push a record onto the trail.
+  void push(const RecordT &record) {
+    if (LLVM_UNLIKELY(TopIndex == ChunkCapacity)) {
+      RecordT *chunk = Spare;
+      Spare = nullptr;
+      if (!chunk)
+        chunk = static_cast<RecordT *>(
+            llvm::safe_malloc(sizeof(RecordT) * ChunkCapacity));
+      Chunks.push_back(chunk);
+      TopIndex = 0;
+    }
+    ::new (static_cast<void *>(&Chunks.back()[TopIndex++])) RecordT(record);
+  }
+
+  /// Pop the most recently pushed record off the trail and return it.
+  RecordT pop() {
+    assert(!Chunks.empty() && TopIndex > 0 && "popping off an empty trail");
+    RecordT record = Chunks.back()[--TopIndex];
+    if (LLVM_UNLIKELY(TopIndex == 0)) {
+      // Retire the emptied chunk, keeping it as the spare. Any chunk
+      // before it is full again.
+      if (Spare)
+        free(Chunks.pop_back_val());
+      else
+        Spare = Chunks.pop_back_val();
+      TopIndex = ChunkCapacity;
+    }
+    return record;
+  }
+};
+
 /// Describes a system of constraints on type variables, the
 /// solution of which assigns concrete types to each of the type variables.
 /// Constraint systems are typically generated given an (untyped) expression.
@@ -2265,6 +2400,18 @@ private:
                  std::pair<VarDecl *, BraceStmt *>>
       BuilderTransformedBodies;
 
+  /// The *global* set of all functions for which applying a particular result
+  /// builder failed, along with the unhandled construct responsible for the
+  /// failure.
+  ///
+  /// Only successful transforms are recorded in \c BuilderTransformedBodies;
+  /// remembering the failures as well keeps repeated solver attempts from
+  /// synthesizing (and immediately discarding) the same transformed body,
+  /// which is allocated in the permanent arena, over and over.
+  llvm::SmallDenseMap<std::pair<AnyFunctionRef, NominalTypeDecl *>,
+                      SkipUnhandledConstructInResultBuilder::UnhandledNode>
+      UnsupportedBuilderTransforms;
+
   /// Arguments after the code completion token that were thus ignored (i.e.
   /// assigned fresh type variables) for type checking.
   llvm::SetVector<Expr *> IgnoredArguments;
@@ -2544,6 +2691,18 @@ private:
     /// Refers to the innermost partial solution scope.
     SolverScope *PartialSolutionScope = nullptr;
 
+    /// The arena used for \c SolverScope objects, which are created
+    /// and destroyed in strict LIFO order as the solver explores and
+    /// abandons branches.
+    SolverScopeArena ScopeArena;
+
+    /// Allocate a new solver scope from the scope arena.
+    SolverScope *allocateScope();
+
+    /// Destroy a scope produced by \c allocateScope and return its
+    /// memory to the arena with a single pointer reset.
+    void reclaimScope(SolverScope *scope);
+
     // Statistics
     #define CS_STATISTIC(Name, Description) unsigned Name = 0;
     #include "ConstraintSolverStats.def"
@@ -2589,10 +2748,8 @@ private:
       scope->scopeNumber = NumStatesExplored++;
 
       CS.incrementScopeCounter();
-      auto scopeInfo =
-        std::make_tuple(scope, retiredConstraints.begin(),
-                        generatedConstraints.size());
-      scopes.push_back(scopeInfo);
+      scopes.push({scope, retiredConstraints.begin(),
+                   static_cast<unsigned>(generatedConstraints.size())});
     }
 
     /// Restore all of the retired/generated constraints to the state
@@ -2609,24 +2766,16 @@ private:
       if (countScopesExplored == 1)
         CS.incrementLeafScopes();
 
-      SolverScope *savedScope;
-      // The position of last retired constraint before given scope.
-      ConstraintList::iterator lastRetiredPos;
-      // The original number of generated constraints before given scope.
-      unsigned numGenerated;
-
-      std::tie(savedScope, lastRetiredPos, numGenerated) =
-        scopes.pop_back_val();
-
-      assert(savedScope == scope && "Scope rollback not in LIFO order!");
+      auto record = scopes.pop();
+      assert(record.Scope == scope && "Scope rollback not in LIFO order!");
 
       // Restore all of the retired constraints.
-      CS.InactiveConstraints.splice(CS.InactiveConstraints.end(),
-                                    retiredConstraints,
-                                    retiredConstraints.begin(), lastRetiredPos);
+      CS.InactiveConstraints.splice(
+          CS.InactiveConstraints.end(), retiredConstraints,
+          retiredConstraints.begin(), record.LastRetiredPos);
 
       // And remove all of the generated constraints.
-      auto genStart = generatedConstraints.begin() + numGenerated,
+      auto genStart = generatedConstraints.begin() + record.NumGenerated,
            genEnd = generatedConstraints.end();
       for (auto genI = genStart; genI != genEnd; ++genI) {
         CS.InactiveConstraints.erase(ConstraintList::iterator(*genI));
@@ -2696,13 +2845,21 @@ private:
     /// The current set of generated constraints.
     SmallVector<Constraint *, 4> generatedConstraints;
 
-    /// The collection which holds association between solver scope
-    /// and position of the last retired constraint and number of
-    /// constraints generated before registration of given scope,
-    /// this helps to rollback all of the constraints retired/generated
-    /// each of the registered scopes correct (LIFO) order.
-    llvm::SmallVector<
-      std::tuple<SolverScope *, ConstraintList::iterator, unsigned>, 4> scopes;
+    /// Per-scope record of the constraint bookkeeping to restore when the
+    /// scope is rolled back.
+    struct ScopeRecord {
+      /// The registered scope itself, for LIFO-order verification.
+      SolverScope *Scope;
+      /// The position of the last retired constraint before the scope.
+      ConstraintList::iterator LastRetiredPos;
+      /// The number of generated constraints before the scope.
+      unsigned NumGenerated;
+    };
+
+    /// The trail of records for each registered scope, used to rollback
+    /// all of the constraints retired/generated by each scope in the
+    /// correct (LIFO) order.
+    SolverTrail<ScopeRecord> scopes;
 
     SmallVector<Constraint *, 4> disabledConstraints;
     SmallVector<Constraint *, 4> favoredConstraints;
@@ -3429,6 +3586,27 @@ public:
     return result->second;
   }
 
+  void setUnsupportedResultBuilderElement(
+      AnyFunctionRef fn, NominalTypeDecl *builder,
+      SkipUnhandledConstructInResultBuilder::UnhandledNode unhandled) {
+    assert(builder->getAttrs().hasAttribute<ResultBuilderAttr>());
+    assert(unhandled);
+
+    auto existing =
+        UnsupportedBuilderTransforms.insert({{fn, builder}, unhandled});
+    assert(existing.second && "Duplicate failed result builder transform");
+    (void)existing;
+  }
+
+  std::optional<SkipUnhandledConstructInResultBuilder::UnhandledNode>
+  getUnsupportedResultBuilderElement(AnyFunctionRef fn,
+                                     NominalTypeDecl *builder) const {
+    auto result = UnsupportedBuilderTransforms.find({fn, builder});
+    if (result == UnsupportedBuilderTransforms.end())
+      return std::nullopt;
+    return result->second;
+  }
+
   void setCaseLabelItemInfo(const CaseLabelItem *item, CaseLabelItemInfo info) {
     assert(item != nullptr);
     assert(caseLabelItems.count(item) == 0);
@@ -17,6 +17,8 @@
 #include "swift/AST/Module.h"
 #include "swift/AST/ModuleLoader.h"
 #include "swift/AST/SearchPathOptions.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/StringSet.h"
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/PrefixMapper.h"
 #include "llvm/TargetParser/Triple.h"
@@ -84,6 +86,30 @@ class SerializedModuleLoaderBase : public ModuleLoader {
 
   SmallVector<std::unique_ptr<ModuleFile>, 2> OrphanedModuleFiles;
 
+  /// Cached directory listings used to answer module file probes, keyed by
+  /// directory path. \c None records a directory that does not exist.
+  ///
+  /// Looking up a module probes every remaining search path, so most probes
+  /// are misses; answering them from a listing of the enclosing directory
+  /// that is read only once costs a single filesystem round trip per
+  /// directory rather than one per candidate path. Like the module search
+  /// path lookup table, this assumes the contents of the search paths do not
+  /// change during the compilation.
+  llvm::StringMap<std::optional<llvm::StringSet<>>> DirectoryListings;
+
+  /// The filesystem the cached directory listings were read from.
+  const llvm::vfs::FileSystem *DirectoryListingFS = nullptr;
+
+  /// Whether \p path may exist, according to a cached listing of its parent
+  /// directory.
+  ///
+  /// Returns \c false only if the parent directory is known not to contain
+  /// an entry with this filename; any open or stat of the path would fail
+  /// with \c no_such_file_or_directory. Returns \c true if the file is
+  /// listed or the directory could not be listed, so a positive answer must
+  /// still be verified by actually accessing the file.
+  bool maybeFileExists(llvm::vfs::FileSystem &FS, StringRef path);
+
 protected:
   ASTContext &Ctx;
   ModuleLoadingMode LoadMode;
@@ -486,6 +512,10 @@ public:
       SmallVectorImpl<Decl*> &Results,
       llvm::function_ref<bool(DeclAttributes)> matchAttributes) const override;
 
+  virtual bool maybeHasOperatorDeclarations() const override;
+
+  virtual bool maybeHasPrecedenceGroupDecls() const override;
+
   virtual void
   getOperatorDecls(SmallVectorImpl<OperatorDecl *> &results) const override;
 
@@ -245,6 +245,8 @@ inline tls_key_t tls_get_key(tls_key k) {
     return __PTK_FRAMEWORK_SWIFT_KEY5;
   case tls_key::observation_transaction:
     return __PTK_FRAMEWORK_SWIFT_KEY6;
+  case tls_key::concurrency_trace_buffer:
+    return __PTK_FRAMEWORK_SWIFT_KEY7;
   }
 }
 
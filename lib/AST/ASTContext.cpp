@@ -78,6 +78,7 @@
 #include "llvm/Support/VersionTuple.h"
 #include "llvm/Support/VirtualOutputBackend.h"
 #include "llvm/Support/VirtualOutputBackends.h"
+#include "llvm/Support/raw_ostream.h"
 #include <algorithm>
 #include <memory>
 #include <queue>
@@ -279,6 +280,12 @@ struct ASTContext::Implementation {
   llvm::StringMap<Identifier::Aligner, llvm::BumpPtrAllocator&>
   IdentifierTable;
 
+  /// A small direct-mapped cache in front of IdentifierTable, storing the
+  /// null-terminated key data of recently interned identifiers. Parsing
+  /// interns the same handful of identifiers over and over, and a hit here
+  /// skips the table's byte-wise hashing and probing entirely.
+  std::array<const char *, 512> IdentifierCache = {};
+
   /// The declaration of Swift.AssignmentPrecedence.
   PrecedenceGroupDecl *AssignmentPrecedence = nullptr;
 
@@ -489,6 +496,17 @@ struct ASTContext::Implementation {
   llvm::DenseMap<SourceFile *, std::array<Type, NumKnownProtocols>>
       DefaultTypeRequestCaches;
 
+  /// Pre-resolved conformances of types to the ExpressibleBy* literal
+  /// protocols, keyed by canonical type. Populated lazily by
+  /// getLiteralProtocolConformance().
+  llvm::DenseMap<std::pair<TypeBase *, const ProtocolDecl *>,
+                 ProtocolConformanceRef>
+      LiteralProtocolConformances;
+
+  /// Interned printed names for declarations, keyed by declaration and a
+  /// caller-chosen formatting discriminator; see getOrCachePrintedName().
+  llvm::DenseMap<std::pair<const Decl *, unsigned>, StringRef> PrintedNames;
+
   /// Mapping from property declarations to the backing variable types.
   llvm::DenseMap<const VarDecl *, Type> PropertyWrapperBackingVarTypes;
 
@@ -655,6 +673,10 @@ struct ASTContext::Implementation {
   /// The current constraint solver arena, if any.
   std::unique_ptr<ConstraintSolverArena> CurrentConstraintSolverArena;
 
+  /// A spare bump allocator kept warm for the next constraint solver.
+  /// \see ASTContext::takeSolverMemory
+  std::optional<llvm::BumpPtrAllocator> SpareSolverAllocator;
+
   Arena &getArena(AllocationArena arena) {
     switch (arena) {
     case AllocationArena::Permanent:
@@ -716,6 +738,23 @@ ConstraintCheckerArenaRAII::~ConstraintCheckerArenaRAII() {
     (ASTContext::Implementation::ConstraintSolverArena *)Data);
 }
 
+llvm::BumpPtrAllocator ASTContext::takeSolverMemory() {
+  auto &spare = getImpl().SpareSolverAllocator;
+  if (!spare)
+    return llvm::BumpPtrAllocator();
+
+  llvm::BumpPtrAllocator result = std::move(*spare);
+  spare.reset();
+  return result;
+}
+
+void ASTContext::recycleSolverMemory(llvm::BumpPtrAllocator &&allocator) {
+  // Drop everything but the initial slab, so the pool's resident memory
+  // stays bounded no matter how large an expression was solved.
+  allocator.Reset();
+  getImpl().SpareSolverAllocator = std::move(allocator);
+}
+
 static ModuleDecl *createBuiltinModule(ASTContext &ctx) {
   auto M = ModuleDecl::create(ctx.getIdentifier(BUILTIN_NAME), ctx);
   M->addFile(*new (ctx) BuiltinUnit(*M));
@@ -851,6 +890,8 @@ void ASTContext::Implementation::dump(llvm::raw_ostream &os) const {
   SIZE_AND_BYTES(DefaultTypeWitnesses);
   SIZE_AND_BYTES(DefaultAssociatedConformanceWitnesses);
   SIZE_AND_BYTES(DefaultTypeRequestCaches);
+  SIZE_AND_BYTES(LiteralProtocolConformances);
+  SIZE_AND_BYTES(PrintedNames);
   SIZE_AND_BYTES(PropertyWrapperBackingVarTypes);
   SIZE_AND_BYTES(OriginalWrappedProperties);
   SIZE_AND_BYTES(BuiltinInitWitness);
@@ -937,8 +978,21 @@ Identifier ASTContext::getIdentifier(StringRef Str) const {
   if (Str.data() == nullptr)
     return Identifier(nullptr);
 
+  // Probe the direct-mapped cache first. llvm::hash_value hashes a word at
+  // a time, so a hit costs far less than the table's byte-wise hash, and
+  // strncmp stops at the cached key's terminating null, so a shorter cached
+  // key is never read past its end.
+  auto &impl = getImpl();
+  size_t slot = llvm::hash_value(Str) & (impl.IdentifierCache.size() - 1);
+  if (const char *cached = impl.IdentifierCache[slot]) {
+    if (strncmp(cached, Str.data(), Str.size()) == 0 &&
+        cached[Str.size()] == '\0')
+      return Identifier(cached);
+  }
+
   auto pair = std::make_pair(Str, Identifier::Aligner());
-  auto I = getImpl().IdentifierTable.insert(pair).first;
+  auto I = impl.IdentifierTable.insert(pair).first;
+  impl.IdentifierCache[slot] = I->getKeyData();
   return Identifier(I->getKeyData());
 }
 
@@ -6398,6 +6452,42 @@ Type &ASTContext::getDefaultTypeRequestCache(SourceFile *SF,
   return getImpl().DefaultTypeRequestCaches[SF][size_t(kind)];
 }
 
+ProtocolConformanceRef ASTContext::getLiteralProtocolConformance(
+    Type type, ProtocolDecl *literalProtocol) {
+  assert(!type->hasTypeVariable() && !type->hasPlaceholder() &&
+         "solver-allocated types must not be cached on the ASTContext");
+  auto &conformances = getImpl().LiteralProtocolConformances;
+
+  std::pair<TypeBase *, const ProtocolDecl *> key(
+      type->getCanonicalType().getPointer(), literalProtocol);
+  auto known = conformances.find(key);
+  if (known != conformances.end())
+    return known->second;
+
+  auto conformance =
+      ModuleDecl::lookupConformance(type, literalProtocol,
+                                    /*allowMissing=*/true);
+  conformances.insert({key, conformance});
+  return conformance;
+}
+
+StringRef ASTContext::getOrCachePrintedName(
+    const Decl *decl, unsigned printKind,
+    llvm::function_ref<void(llvm::raw_ostream &)> print) {
+  auto &names = getImpl().PrintedNames;
+  auto key = std::make_pair(decl, printKind);
+  auto known = names.find(key);
+  if (known != names.end())
+    return known->second;
+
+  SmallString<128> scratch;
+  llvm::raw_svector_ostream os(scratch);
+  print(os);
+  auto result = AllocateCopy(os.str());
+  names.insert({key, result});
+  return result;
+}
+
 Type ASTContext::getSideCachedPropertyWrapperBackingPropertyType(
     VarDecl *var) const {
   return getImpl().PropertyWrapperBackingVarTypes[var];
@@ -620,11 +620,13 @@ std::string ASTMangler::mangleSILDifferentiabilityWitness(StringRef originalName
     Demangler demangler;
     auto *node = mangleSILDifferentiabilityWitnessAsNode(
         originalName, kind, config, demangler);
-    auto mangling = mangleNode(node);
+    // Remangle into the demangler's arena so the node tree, the remangler's
+    // temporaries and the output share one allocator.
+    auto mangling = mangleNode(node, demangler);
     if (!mangling.isSuccess()) {
       llvm_unreachable("unexpected mangling failure");
     }
-    return mangling.result();
+    return mangling.result().str();
   }
   beginManglingWithoutPrefix();
   appendOperator(originalName);
@@ -13,14 +13,19 @@
 #include "swift/AST/AbstractSourceFileDepGraphFactory.h"
 
 // may not all be needed
+#include "swift/AST/ASTContext.h"
+#include "swift/AST/Decl.h"
 #include "swift/AST/DiagnosticEngine.h"
 #include "swift/AST/DiagnosticsFrontend.h"
 #include "swift/AST/FileSystem.h"
 #include "swift/AST/FineGrainedDependencies.h"
+#include "swift/AST/SourceFile.h"
 #include "swift/Basic/Assertions.h"
 #include "swift/Basic/FileSystem.h"
 #include "swift/Basic/LLVM.h"
 #include "swift/Basic/ReferenceDependencyKeys.h"
+#include "swift/Basic/SourceManager.h"
+#include "swift/Parse/Lexer.h"
 #include "llvm/ADT/MapVector.h"
 #include "llvm/ADT/SetVector.h"
 #include "llvm/ADT/SmallVector.h"
@@ -76,6 +81,55 @@ void AbstractSourceFileDepGraphFactory::addADefinedDecl(
   g.addArc(g.getSourceFileNodePair().getInterface(), nodePair.getInterface());
 }
 
+std::optional<Fingerprint>
+AbstractSourceFileDepGraphFactory::getFingerprintIfAny(const Decl *d) {
+  if (const auto *idc = dyn_cast<IterableDeclContext>(d)) {
+    return idc->getBodyFingerprint();
+  }
+
+  // For the remaining kinds of declarations, hash the source text of the
+  // declaration's interface. Like a type-body fingerprint, an unchanged
+  // fingerprint here lets the driver stop an interface change to one
+  // top-level declaration from cascading to the users of every other
+  // declaration in the same file. Bodies are excluded below, mirroring the
+  // parser's exclusion of body tokens from interface hashes, so that a
+  // body-only change leaves the fingerprint alone.
+  auto *SF = d->getDeclContext()->getParentSourceFile();
+  if (!SF || !SF->hasInterfaceHash())
+    return std::nullopt;
+
+  const Decl *rangeDecl = d;
+  SourceLoc bodyStart;
+  if (const auto *AFD = dyn_cast<AbstractFunctionDecl>(d)) {
+    // Body tokens are covered by the function's own body fingerprint.
+    const auto bodyRange = AFD->getBodySourceRange();
+    if (bodyRange.isValid())
+      bodyStart = bodyRange.Start;
+  } else if (const auto *VD = dyn_cast<VarDecl>(d)) {
+    // The pattern binding holds the initializer, which can change the
+    // variable's inferred interface type, so hash the whole binding.
+    if (const auto *PBD = VD->getParentPatternBinding())
+      rangeDecl = PBD;
+    // Accessor bodies, on the other hand, cannot.
+    const auto bracesRange = VD->getBracesRange();
+    if (bracesRange.isValid())
+      bodyStart = bracesRange.Start;
+  }
+
+  const auto range = rangeDecl->getSourceRangeIncludingAttrs();
+  if (range.isInvalid())
+    return std::nullopt;
+
+  const auto &SM = d->getASTContext().SourceMgr;
+  const auto charRange =
+      bodyStart.isValid()
+          ? CharSourceRange(SM, range.Start, bodyStart)
+          : Lexer::getCharSourceRangeFromSourceRange(SM, range);
+  auto hasher = StableHasher::defaultHasher();
+  hasher.combine(SM.extractText(charRange));
+  return Fingerprint{std::move(hasher)};
+}
+
 void AbstractSourceFileDepGraphFactory::addAUsedDecl(
     const DependencyKey &defKey, const DependencyKey &useKey) {
   auto *defNode = g.findExistingNodeOrCreateIfNew(defKey, std::nullopt,
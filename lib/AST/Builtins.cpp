@@ -2310,10 +2310,47 @@ llvm::Intrinsic::ID swift::getLLVMIntrinsicID(StringRef InName) {
     NameS.push_back(C == '_' ? '.' : C);
 
   const char *Name = NameS.c_str();
-  ArrayRef<const char *> NameTable(&IntrinsicNameTable[1],
-                                   TargetInfos[1].Offset);
+
+  // Find the name table segment to search. Target-specific intrinsics
+  // ("llvm.aarch64.*", "llvm.x86.*", ...) live in per-target segments after
+  // the target-independent segment, which is first and has an empty name.
+  StringRef Target = StringRef(Name + strlen("llvm.")).split('.').first;
+  const IntrinsicTargetInfo *TI = &TargetInfos[0];
+  for (const auto &Candidate : TargetInfos) {
+    if (Candidate.Name == Target) {
+      TI = &Candidate;
+      break;
+    }
+  }
+
+  ArrayRef<const char *> NameTable(&IntrinsicNameTable[1] + TI->Offset,
+                                   TI->Count);
   int Idx = Intrinsic::lookupLLVMIntrinsicByName(NameTable, Name);
-  return static_cast<Intrinsic::ID>(Idx + 1);
+  if (Idx == -1)
+    return Intrinsic::not_intrinsic;
+  return static_cast<Intrinsic::ID>(TI->Offset + Idx + 1);
+}
+
+/// Return the target prefix of the given intrinsic, e.g. "aarch64" for
+/// "llvm.aarch64.neon.addp", or an empty string for target-independent
+/// intrinsics.
+static StringRef getIntrinsicTargetPrefix(llvm::Intrinsic::ID ID) {
+  size_t Idx = ID - 1;
+  for (const auto &TI : TargetInfos)
+    if (Idx >= TI.Offset && Idx < TI.Offset + TI.Count)
+      return TI.Name;
+  return StringRef();
+}
+
+/// Check whether the given intrinsic is either target-independent or
+/// specific to the target we are compiling for, so that e.g. NEON
+/// intrinsics don't name-resolve when compiling for x86.
+static bool intrinsicAvailableOnTarget(llvm::Intrinsic::ID ID,
+                                       const llvm::Triple &Triple) {
+  StringRef Prefix = getIntrinsicTargetPrefix(ID);
+  if (Prefix.empty())
+    return true;
+  return Prefix == llvm::Triple::getArchTypePrefix(Triple.getArch());
 }
 
 llvm::Intrinsic::ID
@@ -2603,12 +2640,16 @@ ValueDecl *swift::getBuiltinValueDecl(ASTContext &Context, Identifier Id) {
   StringRef OperationName = getBuiltinBaseName(Context, Id.str(), Types);
 
   // If this is the name of an LLVM intrinsic, cons up a swift function with a
-  // type that matches the IR types.
+  // type that matches the IR types. Target-specific intrinsics are only
+  // visible when compiling for a matching target.
   if (llvm::Intrinsic::ID ID = getLLVMIntrinsicID(OperationName)) {
-    SmallVector<Type, 8> ArgElts;
-    Type ResultTy;
-    if (getSwiftFunctionTypeForIntrinsic(ID, Types, Context, ArgElts, ResultTy))
-      return getBuiltinFunction(Id, ArgElts, ResultTy);
+    if (intrinsicAvailableOnTarget(ID, Context.LangOpts.Target)) {
+      SmallVector<Type, 8> ArgElts;
+      Type ResultTy;
+      if (getSwiftFunctionTypeForIntrinsic(ID, Types, Context, ArgElts,
+                                           ResultTy))
+        return getBuiltinFunction(Id, ArgElts, ResultTy);
+    }
   }
 
   // If this starts with fence, we have special suffixes to handle.
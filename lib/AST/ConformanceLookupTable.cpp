@@ -763,6 +763,15 @@ ConformanceLookupTable::Ordering ConformanceLookupTable::compareConformances(
 bool ConformanceLookupTable::resolveConformances(ProtocolDecl *protocol) {
   // Find any entries that are superseded by other entries.
   ConformanceEntries &entries = Conformances[protocol];
+
+  // If no entries were added since the last resolution for this protocol,
+  // the surviving entries are already mutually non-superseding and the
+  // quadratic comparison below would find nothing new.
+  auto resolvedCount = ResolvedEntryCounts.find(protocol);
+  if (resolvedCount != ResolvedEntryCounts.end() &&
+      resolvedCount->second == entries.size())
+    return false;
+
   llvm::SmallPtrSet<DeclContext *, 4> knownConformances;
   bool anySuperseded = false;
   for (auto entry : entries) {
@@ -819,6 +828,7 @@ bool ConformanceLookupTable::resolveConformances(ProtocolDecl *protocol) {
                   entries.end());
   }
 
+  ResolvedEntryCounts[protocol] = entries.size();
   return anySuperseded;
 }
 
@@ -358,6 +358,13 @@ class ConformanceLookupTable : public ASTAllocated<ConformanceLookupTable> {
   /// The conformance table.
   ConformanceTable Conformances;
 
+  /// The number of conformance entries for each protocol at the time the
+  /// supersession analysis in \c resolveConformances() last completed.
+  ///
+  /// Entries are only ever appended between runs, so an unchanged count
+  /// means re-running the analysis would find nothing new.
+  llvm::SmallDenseMap<ProtocolDecl *, unsigned, 4> ResolvedEntryCounts;
+
   typedef llvm::SmallVector<ProtocolDecl *, 2> ProtocolList;
 
   /// List of all of the protocols to which a given context declares
@@ -6655,6 +6655,7 @@ ProtocolDecl::ProtocolDecl(DeclContext *DC, SourceLoc ProtocolLoc,
   Bits.ProtocolDecl.HasLazyAssociatedTypes = false;
   Bits.ProtocolDecl.HasRequirementSignature = false;
   Bits.ProtocolDecl.HasLazyRequirementSignature = false;
+  Bits.ProtocolDecl.HasLazyInheritedProtocols = false;
   Bits.ProtocolDecl.ProtocolRequirementsValid = false;
   setTrailingWhereClause(TrailingWhere);
 }
@@ -6937,6 +6938,18 @@ ProtocolDecl::setLazyAssociatedTypeMembers(
   Bits.ProtocolDecl.HasLazyAssociatedTypes = true;
 }
 
+void
+ProtocolDecl::setLazyInheritedProtocols(
+    LazyMemberLoader *lazyLoader, uint64_t inheritedProtocolsData) {
+  assert(!areInheritedProtocolsValid());
+  assert(!Bits.ProtocolDecl.HasLazyInheritedProtocols);
+
+  auto contextData = static_cast<LazyProtocolData *>(
+      getASTContext().getOrCreateLazyContextData(this, lazyLoader));
+  contextData->inheritedProtocolsData = inheritedProtocolsData;
+  Bits.ProtocolDecl.HasLazyInheritedProtocols = true;
+}
+
 void
 ProtocolDecl::setLazyPrimaryAssociatedTypeMembers(
     LazyMemberLoader *lazyLoader, uint64_t associatedTypesData) {
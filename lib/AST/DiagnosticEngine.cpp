@@ -1576,6 +1576,16 @@ void DiagnosticEngine::emitDiagnostic(const Diagnostic &diagnostic) {
   ArrayRef<Diagnostic> childNotes = diagnostic.getChildNotes();
   std::vector<Diagnostic> extendedChildNotes;
 
+  // With no consumers attached (e.g. while diagnostics are suppressed),
+  // there is nothing to render. Just thread the diagnostics through the
+  // state machine so that error and suppression tracking stay consistent.
+  if (Consumers.empty()) {
+    (void)state.determineBehavior(diagnostic);
+    for (auto &childNote : childNotes)
+      emitDiagnostic(childNote);
+    return;
+  }
+
   if (auto info = diagnosticInfoForDiagnostic(diagnostic)) {
     // If the diagnostic location is within a buffer containing generated
     // source code, add child notes showing where the generation occurred.
@@ -1604,28 +1614,50 @@ void DiagnosticEngine::emitDiagnostic(const Diagnostic &diagnostic) {
     }
     info->ChildDiagnosticInfo = childInfoPtrs;
 
-    SmallVector<std::string, 1> educationalNotePaths;
-    auto associatedNotes = educationalNotes[(uint32_t)diagnostic.getID()];
-    while (associatedNotes && *associatedNotes) {
-      SmallString<128> notePath(getDiagnosticDocumentationPath());
-      llvm::sys::path::append(notePath, *associatedNotes);
-      educationalNotePaths.push_back(notePath.str().str());
-      ++associatedNotes;
-    }
-    info->EducationalNotePaths = educationalNotePaths;
+    info->EducationalNotePaths =
+        getEducationalNotePaths((uint32_t)diagnostic.getID());
 
     for (auto &consumer : Consumers) {
       consumer->handleDiagnostic(SourceMgr, *info);
     }
+
+    // For compatibility with DiagnosticConsumers which don't know about child
+    // notes, also deliver each child note as a top-level diagnostic. These can
+    // be ignored by consumers which do take advantage of the grouping. Reuse
+    // the DiagnosticInfo already computed above rather than re-deriving the
+    // location, message, and behavior of every note.
+    for (auto &child : childInfo) {
+      for (auto &consumer : Consumers) {
+        consumer->handleDiagnostic(SourceMgr, child);
+      }
+    }
+    return;
   }
 
-  // For compatibility with DiagnosticConsumers which don't know about child
-  // notes. These can be ignored by consumers which do take advantage of the
-  // grouping.
+  // The parent diagnostic was ignored; process the child notes through the
+  // normal path so that note suppression tracking stays consistent.
   for (auto &childNote : childNotes)
     emitDiagnostic(childNote);
 }
 
+ArrayRef<std::string>
+DiagnosticEngine::getEducationalNotePaths(uint32_t diagnosticID) {
+  auto known = educationalNotePathCache.find(diagnosticID);
+  if (known != educationalNotePathCache.end())
+    return known->second;
+
+  std::vector<std::string> paths;
+  auto associatedNotes = educationalNotes[diagnosticID];
+  while (associatedNotes && *associatedNotes) {
+    SmallString<128> notePath(getDiagnosticDocumentationPath());
+    llvm::sys::path::append(notePath, *associatedNotes);
+    paths.push_back(notePath.str().str());
+    ++associatedNotes;
+  }
+  return educationalNotePathCache.insert({diagnosticID, std::move(paths)})
+      .first->second;
+}
+
 DiagnosticKind DiagnosticEngine::declaredDiagnosticKindFor(const DiagID id) {
   return storedDiagnosticInfos[(unsigned)id].kind;
 }
@@ -17,14 +17,18 @@
 #include "swift/AST/Evaluator.h"
 #include "swift/AST/DeclContext.h"
 #include "swift/AST/DiagnosticEngine.h"
+#include "swift/AST/DiagnosticsCommon.h"
 #include "swift/AST/TypeCheckRequests.h" // for ResolveMacroRequest
 #include "swift/Basic/Assertions.h"
 #include "swift/Basic/LangOptions.h"
 #include "swift/Basic/Range.h"
 #include "swift/Basic/SourceManager.h"
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/StringExtras.h"
 #include "llvm/Support/Debug.h"
+#include "llvm/Support/Format.h"
 #include "llvm/Support/SaveAndRestore.h"
+#include <cinttypes>
 #include <vector>
 
 using namespace swift;
@@ -59,8 +63,69 @@ void Evaluator::registerRequestFunctions(
 Evaluator::Evaluator(DiagnosticEngine &diags, const LangOptions &opts)
     : diags(diags),
       debugDumpCycles(opts.DebugDumpCycles),
+      dumpRequestTimers(opts.DumpRequestTimers),
+      warnLongRequestEvaluation(opts.WarnLongRequestEvaluation),
       recorder(opts.RecordRequestReferences) {}
 
+Evaluator::~Evaluator() {
+  if (dumpRequestTimers)
+    dumpTimers(llvm::errs());
+}
+
+std::optional<std::chrono::steady_clock::time_point>
+Evaluator::beginRequestTiming() {
+  if (!dumpRequestTimers && warnLongRequestEvaluation == 0)
+    return std::nullopt;
+
+  nestedRequestNanos.push_back(0);
+  return std::chrono::steady_clock::now();
+}
+
+void Evaluator::endRequestTiming(
+    std::chrono::steady_clock::time_point startTime,
+    llvm::StringRef requestName, SourceLoc loc) {
+  auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - startTime).count();
+
+  // Attribute only the time not already charged to nested requests, so
+  // that the per-kind timers sum to the total evaluation time.
+  uint64_t nestedNanos = nestedRequestNanos.pop_back_val();
+  if (dumpRequestTimers) {
+    auto &timer = requestTimers[requestName];
+    ++timer.Count;
+    timer.SelfNanos += elapsed - nestedNanos;
+  }
+
+  // Charge the full elapsed time to the enclosing request, if any.
+  if (!nestedRequestNanos.empty())
+    nestedRequestNanos.back() += elapsed;
+
+  if (warnLongRequestEvaluation != 0) {
+    unsigned elapsedMS = elapsed / 1000000;
+    if (elapsedMS >= warnLongRequestEvaluation) {
+      diags.diagnose(loc, diag::debug_long_request, requestName, elapsedMS,
+                     warnLongRequestEvaluation);
+    }
+  }
+}
+
+void Evaluator::dumpTimers(llvm::raw_ostream &out) const {
+  std::vector<const llvm::StringMapEntry<RequestTimer> *> entries;
+  entries.reserve(requestTimers.size());
+  for (const auto &entry : requestTimers)
+    entries.push_back(&entry);
+  llvm::sort(entries, [](const auto *lhs, const auto *rhs) {
+    return lhs->second.SelfNanos > rhs->second.SelfNanos;
+  });
+
+  out << "===REQUEST TIMERS===\n";
+  for (const auto *entry : entries) {
+    out << llvm::format("%10.3fms %10" PRIu64 "  ",
+                        entry->second.SelfNanos / 1e6, entry->second.Count)
+        << entry->getKey() << "\n";
+  }
+}
+
 SourceLoc Evaluator::getInnermostSourceLoc(
     llvm::function_ref<bool(SourceLoc)> fn) {
   for (auto request : llvm::reverse(activeRequests)) {
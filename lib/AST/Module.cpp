@@ -1392,6 +1392,18 @@ void SourceFile::getTopLevelDecls(SmallVectorImpl<Decl*> &Results) const {
   Results.append(decls.begin(), decls.end());
 }
 
+bool ModuleDecl::maybeHasOperatorDeclarations() const {
+  return llvm::any_of(getFiles(), [](const FileUnit *file) {
+    return file->maybeHasOperatorDeclarations();
+  });
+}
+
+bool ModuleDecl::maybeHasPrecedenceGroupDecls() const {
+  return llvm::any_of(getFiles(), [](const FileUnit *file) {
+    return file->maybeHasPrecedenceGroupDecls();
+  });
+}
+
 void ModuleDecl::getOperatorDecls(
     SmallVectorImpl<OperatorDecl *> &results) const {
   // For a parsed module, we can check the source cache on the module rather
@@ -3495,12 +3507,31 @@ void SourceFile::addDelayedFunction(AbstractFunctionDecl *AFD) {
 }
 
 void SourceFile::typeCheckDelayedFunctions() {
+  // Process the queue in waves. Checking a body may delay additional
+  // functions, which then form the next wave.
+  unsigned start = 0;
+  while (start < DelayedFunctions.size()) {
+    unsigned end = DelayedFunctions.size();
+
+    // First force the interface of every function in the wave. Once the
+    // interfaces are in place, the bodies in the wave only depend on
+    // already-computed state, which keeps the body-checking loop free of
+    // interleaved interface requests and makes it a candidate for
+    // eventually being distributed over a work queue.
+    for (unsigned i = start; i < end; i++) {
+      auto *AFD = DelayedFunctions[i];
+      assert(!AFD->getDeclContext()->isLocalContext());
+      (void) AFD->getInterfaceType();
+    }
+
+    // Now check the bodies.
+    for (unsigned i = start; i < end; i++) {
+      auto *AFD = DelayedFunctions[i];
+      AFD->getTypecheckedBody();
+      (void) AFD->getCaptureInfo();
+    }
 
-  for (unsigned i = 0; i < DelayedFunctions.size(); i++) {
-    auto *AFD = DelayedFunctions[i];
-    assert(!AFD->getDeclContext()->isLocalContext());
-    AFD->getTypecheckedBody();
-    (void) AFD->getCaptureInfo();
+    start = end;
   }
 
   DelayedFunctions.clear();
@@ -3677,6 +3708,17 @@ TypeRefinementContext *SourceFile::getTypeRefinementContext() const {
 
 void SourceFile::setTypeRefinementContext(TypeRefinementContext *Root) {
   TRC = Root;
+  LastQueriedTRC = nullptr;
+}
+
+TypeRefinementContext *
+SourceFile::getLastQueriedTypeRefinementContext() const {
+  return LastQueriedTRC;
+}
+
+void SourceFile::setLastQueriedTypeRefinementContext(
+    TypeRefinementContext *Result) {
+  LastQueriedTRC = Result;
 }
 
 ArrayRef<OpaqueTypeDecl *> SourceFile::getOpaqueReturnTypeDecls() {
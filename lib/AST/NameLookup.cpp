@@ -3339,6 +3339,19 @@ InheritedProtocolsRequest::evaluate(Evaluator &evaluator,
                                     ProtocolDecl *PD) const {
   auto &ctx = PD->getASTContext();
 
+  // For deserialized protocols, the semantic inherited list was serialized
+  // as-is; load it from the module file on first query instead of eagerly
+  // pulling in the whole inheritance closure at deserialization time.
+  if (PD->hasLazyInheritedProtocols()) {
+    auto contextData = static_cast<LazyProtocolData *>(
+        ctx.getOrCreateLazyContextData(PD, nullptr));
+
+    SmallVector<ProtocolDecl *, 2> loaded;
+    contextData->loader->loadInheritedProtocols(
+        PD, contextData->inheritedProtocolsData, loaded);
+    return ctx.AllocateCopy(loaded);
+  }
+
   llvm::SmallSetVector<ProtocolDecl *, 2> inherited;
 
   assert(!PD->wasDeserialized());
@@ -28,6 +28,16 @@
 using namespace swift;
 using namespace swift::namelookup;
 
+/// Returns whether \p mod may declare any decls of the kind being looked up,
+/// allowing lookup to skip modules that are known not to declare any
+/// operators or precedence groups without issuing a request for each name.
+template <typename T>
+static bool maybeHasDeclsOfInterest(const ModuleDecl *mod) {
+  if (std::is_same<T, PrecedenceGroupDecl>::value)
+    return mod->maybeHasPrecedenceGroupDecls();
+  return mod->maybeHasOperatorDeclarations();
+}
+
 template <typename T>
 static TinyPtrVector<T *> lookupOperatorImpl(
     DeclContext *moduleDC, Identifier name,
@@ -41,6 +51,9 @@ static TinyPtrVector<T *> lookupOperatorImpl(
     TinyPtrVector<T *> results;
     for (auto &import : getAllImports(moduleDC)) {
       auto *mod = import.importedModule;
+      if (!maybeHasDeclsOfInterest<T>(mod))
+        continue;
+
       lookupDirect(OperatorLookupDescriptor::forModule(mod, name), results);
     }
 
@@ -89,6 +102,9 @@ static TinyPtrVector<T *> lookupOperatorImpl(
       if (!includePrivate && !isExported)
         continue;
 
+      if (!maybeHasDeclsOfInterest<T>(mod))
+        continue;
+
       lookupDirect(OperatorLookupDescriptor::forModule(mod, name), results);
     }
     return !results.empty();
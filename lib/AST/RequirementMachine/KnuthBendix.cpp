@@ -355,6 +355,10 @@ RewriteSystem::performKnuthBendix(unsigned maxRuleCount,
   std::vector<CriticalPair> resolvedCriticalPairs;
   std::vector<RewriteLoop> resolvedLoops;
 
+  // The number of rules that have already been cross-scanned for overlaps
+  // against each other by a previous pass of the loop below.
+  unsigned scannedRuleCount = 0;
+
   do {
     ruleCount = Rules.size();
 
@@ -398,6 +402,15 @@ RewriteSystem::performKnuthBendix(unsigned maxRuleCount,
               return;
           }
 
+          // If both rules already existed during the previous pass, any
+          // overlap between them was found then: rule left hand sides are
+          // immutable and the trie only grows, so the pair is either in
+          // CheckedOverlaps already or was skipped for a reason that still
+          // holds (the simplified flags are never cleared). Don't probe the
+          // set again for such pairs.
+          if (i < scannedRuleCount && j < scannedRuleCount)
+            return;
+
           // We don't have to consider the same pair of rules more than once,
           // since those critical pairs were already resolved.
           if (!CheckedOverlaps.insert(std::make_pair(i, j)).second)
@@ -443,6 +456,8 @@ RewriteSystem::performKnuthBendix(unsigned maxRuleCount,
       }
     }
 
+    scannedRuleCount = Rules.size();
+
     ASSERT(ruleCount == Rules.size());
 
     simplifyLeftHandSides();
@@ -157,6 +157,24 @@ SubstitutionMap SubstitutionMap::getCanonical(bool canonicalizeSignature) const
   auto sig = getGenericSignature();
   if (canonicalizeSignature) sig = sig.getCanonicalSignature();
 
+  // If the signature is unchanged and every replacement type and conformance
+  // is already canonical, this map is its own canonical form. Returning it
+  // directly avoids rebuilding the replacement arrays and re-hashing them
+  // against the uniquing table, which dominates when large, already-canonical
+  // maps are canonicalized repeatedly.
+  if (sig.getPointer() == getGenericSignature().getPointer()) {
+    bool alreadyCanonical =
+        llvm::all_of(getReplacementTypes(),
+                     [](Type replacementTy) {
+                       return replacementTy->isCanonical();
+                     }) &&
+        llvm::all_of(getConformances(), [](ProtocolConformanceRef conf) {
+          return conf.isCanonical();
+        });
+    if (alreadyCanonical)
+      return *this;
+  }
+
   SmallVector<Type, 4> replacementTypes;
   for (Type replacementType : getReplacementTypes()) {
     replacementTypes.push_back(replacementType->getCanonicalType());
@@ -177,6 +195,12 @@ SubstitutionMap SubstitutionMap::get(GenericSignature genericSig,
   if (!genericSig)
     return SubstitutionMap();
 
+  // Looking up every parameter of a map's own signature reproduces the map;
+  // skip the rebuild.
+  if (genericSig.getPointer() ==
+      substitutions.getGenericSignature().getPointer())
+    return substitutions;
+
   return SubstitutionMap::get(genericSig,
            [&](SubstitutableType *type) -> Type {
              return substitutions.lookupSubstitution(
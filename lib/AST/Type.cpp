@@ -582,18 +582,30 @@ void TypeBase::getTypeVariables(
     SmallPtrSetImpl<TypeVariableType *> &typeVariables) {
   // If we know we don't have any type variables, we're done.
   if (hasTypeVariable()) {
-    auto addTypeVariables = [&](Type type) -> bool {
-      if (auto tv = dyn_cast<TypeVariableType>(type.getPointer())) {
-        typeVariables.insert(tv);
-      }
+    // Walk the types, collecting type variables along the way. The cached
+    // recursive properties let us skip any subtree that does not contain a
+    // type variable, so the walk only descends along paths that lead to one.
+    class Walker : public TypeWalker {
+      SmallPtrSetImpl<TypeVariableType *> &typeVariables;
 
-      return false;
+    public:
+      explicit Walker(SmallPtrSetImpl<TypeVariableType *> &typeVariables)
+          : typeVariables(typeVariables) {}
+
+      Action walkToTypePre(Type ty) override {
+        if (!ty->hasTypeVariable())
+          return Action::SkipNode;
+
+        if (auto tv = dyn_cast<TypeVariableType>(ty.getPointer()))
+          typeVariables.insert(tv);
+
+        return Action::Continue;
+      }
     };
 
-    // Use Type::findIf() to walk the types, finding type variables along the
-    // way.
-    getCanonicalType().findIf(addTypeVariables);
-    Type(this).findIf(addTypeVariables);
+    Walker walker(typeVariables);
+    getCanonicalType().walk(walker);
+    Type(this).walk(walker);
     assert((!typeVariables.empty() || hasError()) &&
            "Did not find type variables!");
   }
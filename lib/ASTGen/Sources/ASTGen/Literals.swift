@@ -30,6 +30,21 @@ extension ASTGenVisitor {
     let stringLiteralKind = node.stringLiteralKind ?? .singleLine
     let delimiterLength = node.delimiterLength
 
+    // Fast path: a single-line literal without escape sequences has exactly
+    // the segment text as its value. Borrow it from the syntax arena instead
+    // of building a 'String'; 'createParsed' copies it into the 'ASTContext'.
+    if stringLiteralKind == .singleLine, node.segments.count == 1,
+      case .stringSegment(let seg) = node.segments.first!,
+      !seg.hasError,
+      !seg.content.rawText.contains(UInt8(ascii: "\\"))
+    {
+      return .createParsed(
+        self.ctx,
+        value: seg.content.rawText.bridged,
+        loc: self.generateSourceLoc(node)
+      )
+    }
+
     var value: String = ""
     for case .stringSegment(let seg) in node.segments where !seg.hasError {
       seg.appendUnescapedLiteralValue(
@@ -219,16 +234,14 @@ extension ASTGenVisitor {
   }
 
   func generate(integerLiteralExpr node: IntegerLiteralExprSyntax) -> BridgedIntegerLiteralExpr {
-    // FIXME: Avoid 'String' instantiation
+    // The token text is borrowed directly from the syntax arena;
+    // 'createParsed' copies it into the 'ASTContext'.
     // FIXME: Strip '_'.
-    var segment = node.literal.text
-    return segment.withBridgedString { bridgedSegment in
-      return .createParsed(
-        ctx,
-        value: bridgedSegment,
-        loc: self.generateSourceLoc(node.literal)
-      )
-    }
+    return .createParsed(
+      ctx,
+      value: node.literal.rawText.bridged,
+      loc: self.generateSourceLoc(node.literal)
+    )
   }
 
   func generate(booleanLiteralExpr node: BooleanLiteralExprSyntax) -> BridgedBooleanLiteralExpr {
@@ -15,6 +15,7 @@
 #include "swift/Basic/Assertions.h"
 #include "clang/Basic/FileManager.h"
 #include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/ADT/Twine.h"
 #include "llvm/Support/Errc.h"
@@ -23,8 +24,16 @@
 #include "llvm/Support/Process.h"
 #include "llvm/Support/Signals.h"
 #include "llvm/Support/VirtualFileSystem.h"
+#include <limits>
+#include <mutex>
 #include <optional>
 
+#if defined(__APPLE__) || (defined(__unix__) && !defined(__CYGWIN__))
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 using namespace swift;
 
 namespace {
@@ -273,6 +282,98 @@ std::error_code swift::moveFileIfDifferent(const llvm::Twine &source,
   llvm_unreachable("Unhandled FileDifference in switch");
 }
 
+void swift::prefetchFiles(llvm::ArrayRef<llvm::StringRef> paths) {
+#if defined(__APPLE__) || (defined(__unix__) && !defined(__CYGWIN__))
+  for (llvm::StringRef path : paths) {
+    llvm::SmallString<256> nameBuf = path;
+    int fd = ::open(nameBuf.c_str(), O_RDONLY);
+    if (fd < 0)
+      continue;
+#if defined(__APPLE__)
+    struct stat statBuf;
+    if (::fstat(fd, &statBuf) == 0 && statBuf.st_size > 0) {
+      struct radvisory advice;
+      advice.ra_offset = 0;
+      advice.ra_count = static_cast<int>(
+          std::min<off_t>(statBuf.st_size, std::numeric_limits<int>::max()));
+      (void)::fcntl(fd, F_RDADVISE, &advice);
+    }
+#elif defined(POSIX_FADV_WILLNEED)
+    (void)::posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+#endif
+    llvm::sys::Process::SafelyCloseFileDescriptor(fd);
+  }
+#endif
+}
+
+namespace {
+/// A proxy file system that memoizes \c status and \c getRealPath results,
+/// including failures. Entries are keyed by the path as it was requested;
+/// repeated queries through the same search paths resolve to the same
+/// spelling, so canonicalizing keys up front would only add work.
+class StatCachingFileSystem : public llvm::vfs::ProxyFileSystem {
+  std::mutex Mtx;
+  llvm::StringMap<llvm::ErrorOr<llvm::vfs::Status>> StatusCache;
+  llvm::StringMap<llvm::ErrorOr<std::string>> RealPathCache;
+
+public:
+  explicit StatCachingFileSystem(
+      llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> base)
+      : ProxyFileSystem(std::move(base)) {}
+
+  llvm::ErrorOr<llvm::vfs::Status> status(const llvm::Twine &path) override {
+    llvm::SmallString<256> pathStorage;
+    llvm::StringRef pathRef = path.toStringRef(pathStorage);
+
+    std::lock_guard<std::mutex> lock(Mtx);
+    auto known = StatusCache.find(pathRef);
+    if (known != StatusCache.end())
+      return known->second;
+    auto result = ProxyFileSystem::status(path);
+    StatusCache.insert({pathRef, result});
+    return result;
+  }
+
+  std::error_code getRealPath(const llvm::Twine &path,
+                              llvm::SmallVectorImpl<char> &output) override {
+    llvm::SmallString<256> pathStorage;
+    llvm::StringRef pathRef = path.toStringRef(pathStorage);
+
+    std::lock_guard<std::mutex> lock(Mtx);
+    auto known = RealPathCache.find(pathRef);
+    if (known == RealPathCache.end()) {
+      llvm::SmallString<256> resolved;
+      if (auto error = ProxyFileSystem::getRealPath(path, resolved)) {
+        known = RealPathCache.insert({pathRef, error}).first;
+      } else {
+        known =
+            RealPathCache.insert({pathRef, resolved.str().str()}).first;
+      }
+    }
+    if (!known->second)
+      return known->second.getError();
+    output.assign(known->second->begin(), known->second->end());
+    return std::error_code();
+  }
+
+  std::error_code
+  setCurrentWorkingDirectory(const llvm::Twine &path) override {
+    // Relative paths are keyed as spelled, so a directory change invalidates
+    // everything cached so far.
+    std::lock_guard<std::mutex> lock(Mtx);
+    StatusCache.clear();
+    RealPathCache.clear();
+    return ProxyFileSystem::setCurrentWorkingDirectory(path);
+  }
+};
+} // end anonymous namespace
+
+llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem>
+swift::createStatCachingFileSystem(
+    llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> base) {
+  return llvm::makeIntrusiveRefCnt<StatCachingFileSystem>(std::move(base));
+}
+
 llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>>
 swift::vfs::getFileOrSTDIN(llvm::vfs::FileSystem &FS,
                            const llvm::Twine &Filename,
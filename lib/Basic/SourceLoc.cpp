@@ -21,6 +21,8 @@
 #include "llvm/Support/Signals.h"
 #include "llvm/Support/raw_ostream.h"
 
+#include <algorithm>
+
 using namespace swift;
 
 void SourceManager::verifyAllBuffers() const {
@@ -343,6 +345,62 @@ unsigned SourceManager::getByteDistance(SourceLoc Start, SourceLoc End) const {
   return End.Value.getPointer() - Start.Value.getPointer();
 }
 
+llvm::ArrayRef<unsigned>
+SourceManager::getLineStartOffsets(unsigned BufferID) const {
+  auto &LineStarts = LineStartOffsetsCache[BufferID];
+  if (LineStarts.empty()) {
+    // Line 1 starts at offset 0; every later line starts one past a newline.
+    // StringRef::find lowers to memchr, so the scan is vectorized, and the
+    // buffer is only walked once no matter how many consumers resolve
+    // locations in it.
+    StringRef Buffer = getEntireTextForBuffer(BufferID);
+    LineStarts.push_back(0);
+    for (size_t Pos = Buffer.find('\n'); Pos != StringRef::npos;
+         Pos = Buffer.find('\n', Pos + 1))
+      LineStarts.push_back(Pos + 1);
+  }
+  return LineStarts;
+}
+
+std::pair<unsigned, unsigned>
+SourceManager::getLineAndColumnForOffset(unsigned BufferID,
+                                         unsigned Offset) const {
+  auto LineStarts = getLineStartOffsets(BufferID);
+  // The containing line is the last one that starts at or before the offset.
+  auto It = std::upper_bound(LineStarts.begin(), LineStarts.end(), Offset);
+  unsigned Line = It - LineStarts.begin();
+  return {Line, Offset - LineStarts[Line - 1] + 1};
+}
+
+void SourceManager::getLineAndColumnsInBuffer(
+    unsigned BufferID, llvm::ArrayRef<SourceLoc> Locs,
+    llvm::SmallVectorImpl<std::pair<unsigned, unsigned>> &Result) const {
+  auto LineStarts = getLineStartOffsets(BufferID);
+  unsigned NumLines = LineStarts.size();
+  Result.reserve(Result.size() + Locs.size());
+
+  // Batches tend to be roughly in source order, so try the line of the
+  // previous hit and its successor before falling back to binary search.
+  unsigned Line = 1;
+  auto lineContains = [&](unsigned L, unsigned Offset) {
+    return LineStarts[L - 1] <= Offset &&
+           (L == NumLines || Offset < LineStarts[L]);
+  };
+  for (SourceLoc Loc : Locs) {
+    assert(Loc.isValid());
+    unsigned Offset = getLocOffsetInBuffer(Loc, BufferID);
+    if (!lineContains(Line, Offset)) {
+      if (Line < NumLines && lineContains(Line + 1, Offset)) {
+        Line += 1;
+      } else {
+        Line = std::upper_bound(LineStarts.begin(), LineStarts.end(), Offset) -
+               LineStarts.begin();
+      }
+    }
+    Result.push_back({Line, Offset - LineStarts[Line - 1] + 1});
+  }
+}
+
 unsigned SourceManager::getColumnInBuffer(SourceLoc Loc,
                                           unsigned BufferID) const {
   assert(Loc.isValid());
@@ -795,8 +853,16 @@ ArrayRef<unsigned> SourceManager::getAncestors(
 static bool isBeforeInSource(
     const SourceManager &sourceMgr, SourceLoc firstLoc, SourceLoc secondLoc,
     bool allowEqual) {
-  // If the two locations are in the same source buffer, compare their pointers.
+  // If the two locations are in the same source buffer, compare their
+  // pointers. Checking whether the second location lies within the first
+  // location's buffer avoids resolving its buffer ID; this is the common case
+  // for clients such as ASTScope lookup that compare many locations within a
+  // single file.
   unsigned firstBufferID = sourceMgr.findBufferContainingLoc(firstLoc);
+  if (sourceMgr.getRangeForBuffer(firstBufferID).contains(secondLoc)) {
+    return sourceMgr.isBeforeInBuffer(firstLoc, secondLoc) ||
+        (allowEqual && firstLoc == secondLoc);
+  }
   unsigned secondBufferID = sourceMgr.findBufferContainingLoc(secondLoc);
   if (firstBufferID == secondBufferID) {
     return sourceMgr.isBeforeInBuffer(firstLoc, secondLoc) ||
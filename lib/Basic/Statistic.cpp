@@ -17,7 +17,9 @@
 #include "clang/Basic/SourceManager.h"
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/Config/config.h"
+#include "llvm/Support/Endian.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/JSON.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/Process.h"
 #include "llvm/Support/SaveAndRestore.h"
@@ -99,12 +101,64 @@ makeTraceFileName(StringRef ProgramName,
   return makeFileName("trace", ProgramName, AuxName, "csv");
 }
 
+static std::string
+makeChromeTraceFileName(StringRef ProgramName,
+                        StringRef AuxName) {
+  return makeFileName("chrometrace", ProgramName, AuxName, "json");
+}
+
 static std::string
 makeProfileDirName(StringRef ProgramName,
                    StringRef AuxName) {
   return makeFileName("profile", ProgramName, AuxName, "dir");
 }
 
+// The -stream-stats-events format is a sequence of fixed-layout,
+// little-endian, 8-byte-aligned records appended to a single
+// stats.swiftstats file shared by every process writing into the same
+// -stats-output-dir. Each record is emitted with one buffered write so
+// O_APPEND keeps records from concurrent frontends intact. The layout is:
+//
+//   u32  magic 'SWS1'
+//   u32  FNV-1a hash of the counter-name schema
+//   u64  wall time in microseconds since the unix epoch
+//   u32  pid
+//   u32  flags (bit 0 set on the final record a process writes)
+//   u32  number of i64 counters that follow
+//   u32  length of the aux-name string
+//   i64  counters, in swift/Basic/Statistics.def FRONTEND_STATISTIC order
+//   ...  aux-name bytes, zero-padded to a multiple of 8
+//
+// Counter names are not repeated per record; they are written once to a
+// stats-schema.txt sidecar, one name per line in record order, which readers
+// cross-check against the schema hash.
+
+static const uint32_t StatsStreamMagic = 0x31535753; // 'SWS1', little-endian
+static const uint32_t StatsStreamFlagFinal = 1;
+static const uint64_t StatsStreamPeriodUSec = 100000; // min usec between samples
+
+static ArrayRef<const char *> getFrontendCounterNames() {
+  static const char *Names[] = {
+#define FRONTEND_STATISTIC(TY, NAME) #TY "." #NAME,
+#include "swift/Basic/Statistics.def"
+#undef FRONTEND_STATISTIC
+  };
+  return Names;
+}
+
+static uint32_t getStatsStreamSchemaHash() {
+  uint32_t H = 2166136261u;
+  for (auto *Name : getFrontendCounterNames()) {
+    for (const char *C = Name; *C; ++C) {
+      H ^= (uint8_t)*C;
+      H *= 16777619u;
+    }
+    H ^= (uint8_t)'\n';
+    H *= 16777619u;
+  }
+  return H;
+}
+
 // LLVM's statistics-reporting machinery is sensitive to filenames containing
 // YAML-quote-requiring characters, which occur surprisingly often in the wild;
 // we only need a recognizable and likely-unique name for a target here, not an
@@ -321,7 +375,9 @@ UnifiedStatsReporter::UnifiedStatsReporter(StringRef ProgramName,
                                            clang::SourceManager *CSM,
                                            bool TraceEvents,
                                            bool ProfileEvents,
-                                           bool ProfileEntities)
+                                           bool ProfileEntities,
+                                           bool StreamEvents,
+                                           bool ChromeTraceEvents)
   : UnifiedStatsReporter(ProgramName,
                          auxName(ModuleName,
                                  InputName,
@@ -330,7 +386,8 @@ UnifiedStatsReporter::UnifiedStatsReporter(StringRef ProgramName,
                                  OptType),
                          Directory,
                          SM, CSM,
-                         TraceEvents, ProfileEvents, ProfileEntities)
+                         TraceEvents, ProfileEvents, ProfileEntities,
+                         StreamEvents, ChromeTraceEvents)
 {
 }
 
@@ -341,12 +398,17 @@ UnifiedStatsReporter::UnifiedStatsReporter(StringRef ProgramName,
                                            clang::SourceManager *CSM,
                                            bool TraceEvents,
                                            bool ProfileEvents,
-                                           bool ProfileEntities)
+                                           bool ProfileEntities,
+                                           bool StreamEvents,
+                                           bool ChromeTraceEvents)
   : currentProcessExitStatusSet(false),
     currentProcessExitStatus(EXIT_FAILURE),
     StatsFilename(Directory),
     TraceFilename(Directory),
     ProfileDirname(Directory),
+    StreamFilename(Directory),
+    ChromeTraceFilename(Directory),
+    StreamAuxName(AuxName),
     StartedTime(llvm::TimeRecord::getCurrentTime()),
     MainThreadID(std::this_thread::get_id()),
     Timer(std::make_unique<NamedRegionTimer>(AuxName,
@@ -360,15 +422,43 @@ UnifiedStatsReporter::UnifiedStatsReporter(StringRef ProgramName,
   path::append(StatsFilename, makeStatsFileName(ProgramName, AuxName));
   path::append(TraceFilename, makeTraceFileName(ProgramName, AuxName));
   path::append(ProfileDirname, makeProfileDirName(ProgramName, AuxName));
+  path::append(StreamFilename, "stats.swiftstats");
+  path::append(ChromeTraceFilename,
+               makeChromeTraceFileName(ProgramName, AuxName));
   EnableStatistics(/*PrintOnExit=*/false);
-  if (TraceEvents || ProfileEvents || ProfileEntities)
+  if (TraceEvents || ProfileEvents || ProfileEntities || StreamEvents ||
+      ChromeTraceEvents)
     LastTracedFrontendCounters.emplace();
   if (TraceEvents)
     FrontendStatsEvents.emplace();
+  if (ChromeTraceEvents)
+    FrontendStatsSpans.emplace();
   if (ProfileEvents)
     EventProfilers =std::make_unique<StatsProfilers>();
   if (ProfileEntities)
     EntityProfilers =std::make_unique<StatsProfilers>();
+  if (StreamEvents) {
+    std::error_code EC;
+    StatsStream = std::make_unique<raw_fd_ostream>(
+        StreamFilename, EC, fs::OF_Append);
+    if (EC) {
+      llvm::errs() << "Error opening -stream-stats-events file '"
+                   << StreamFilename << "' for writing\n";
+      StatsStream.reset();
+    } else {
+      // Write the column-name sidecar once per directory; losing the race to
+      // another process (or a previous build) is fine.
+      SmallString<128> SchemaFilename(Directory);
+      path::append(SchemaFilename, "stats-schema.txt");
+      int SchemaFD;
+      if (!fs::openFileForWrite(SchemaFilename, SchemaFD, fs::CD_CreateNew,
+                                fs::OF_Text)) {
+        raw_fd_ostream Schema(SchemaFD, /*shouldClose=*/true);
+        for (auto *Name : getFrontendCounterNames())
+          Schema << Name << '\n';
+      }
+    }
+  }
 }
 
 void UnifiedStatsReporter::recordJobMaxRSS(long rss) {
@@ -478,6 +568,46 @@ UnifiedStatsReporter::printAlwaysOnStatsAndTimers(raw_ostream &OS) {
   OS.flush();
 }
 
+void
+UnifiedStatsReporter::streamAlwaysOnStats(bool IsFinal) {
+  if (!StatsStream || !FrontendCounters)
+    return;
+
+  auto Dur = std::chrono::system_clock::now().time_since_epoch();
+  uint64_t NowUSec =
+      std::chrono::duration_cast<std::chrono::microseconds>(Dur).count();
+  if (!IsFinal && NowUSec - LastStreamedUSec < StatsStreamPeriodUSec)
+    return;
+  LastStreamedUSec = NowUSec;
+
+  auto NumCounters = getFrontendCounterNames().size();
+  uint32_t AuxLen = StreamAuxName.size();
+
+  // Build the whole record in a local buffer and emit it with a single
+  // buffered write, so concurrent appenders do not interleave records.
+  SmallString<1024> Buf;
+  raw_svector_ostream OS(Buf);
+  using namespace llvm::support;
+  endian::Writer LE(OS, little);
+  LE.write(StatsStreamMagic);
+  LE.write(getStatsStreamSchemaHash());
+  LE.write(NowUSec);
+  LE.write(uint32_t(Process::getProcessId()));
+  LE.write(uint32_t(IsFinal ? StatsStreamFlagFinal : 0));
+  LE.write(uint32_t(NumCounters));
+  LE.write(AuxLen);
+  auto &C = getFrontendCounters();
+#define FRONTEND_STATISTIC(TY, NAME) LE.write(int64_t(C.NAME));
+#include "swift/Basic/Statistics.def"
+#undef FRONTEND_STATISTIC
+  OS << StreamAuxName;
+  while (Buf.size() % 8 != 0)
+    OS << '\0';
+
+  StatsStream->write(Buf.data(), Buf.size());
+  StatsStream->flush();
+}
+
 FrontendStatsTracer::FrontendStatsTracer(
     UnifiedStatsReporter *Reporter, StringRef EventName, const void *Entity,
     const UnifiedStatsReporter::TraceFormatter *Formatter)
@@ -644,8 +774,18 @@ UnifiedStatsReporter::saveAnyFrontendStatsEvents(
 #undef FRONTEND_STATISTIC
   }
 
+  if (FrontendStatsSpans && !IsEntry) {
+    auto StartUS = uint64_t(1000000.0 * T.SavedTime.getProcessTime());
+    auto NowUS = uint64_t(1000000.0 * Now.getProcessTime());
+    FrontendStatsSpans->push_back(
+        {StartUS, NowUS - StartUS, T.EventName, T.Entity, T.Formatter});
+  }
+
   // Save all counters (changed or otherwise).
   Last = Curr;
+
+  // Append a (rate-limited) sample record for live monitoring.
+  streamAlwaysOnStats(/*IsFinal=*/false);
 }
 
 UnifiedStatsReporter::TraceFormatter::~TraceFormatter() {}
@@ -721,6 +861,7 @@ UnifiedStatsReporter::~UnifiedStatsReporter()
 #else
   printAlwaysOnStatsAndTimers(ostream);
 #endif
+  streamAlwaysOnStats(/*IsFinal=*/true);
   flushTracesAndProfiles();
 }
 
@@ -759,6 +900,39 @@ UnifiedStatsReporter::flushTracesAndProfiles() {
     }
   }
 
+  if (FrontendStatsSpans) {
+    std::error_code EC;
+    raw_fd_ostream jstream(ChromeTraceFilename, EC,
+                           fs::OF_Append | fs::OF_Text);
+    if (EC) {
+      llvm::errs() << "Error opening -trace-stats-chrome file '"
+                   << ChromeTraceFilename << "' for writing\n";
+      return;
+    }
+    // The trace-event "JSON array format": one complete ("ph":"X") event per
+    // span. Viewers rebuild nesting from ts/dur on a given pid/tid pair.
+    auto Pid = Process::getProcessId();
+    jstream << "[";
+    const char *delim = "\n";
+    for (auto const &S : *FrontendStatsSpans) {
+      SmallString<64> Name(S.EventName);
+      if (S.Formatter && S.Entity) {
+        raw_svector_ostream NOS(Name);
+        NOS << ' ';
+        S.Formatter->traceName(S.Entity, NOS);
+      }
+      jstream << delim
+              << "{\"name\": " << llvm::json::Value(Name.str())
+              << ", \"cat\": \"swift\", \"ph\": \"X\""
+              << ", \"ts\": " << S.StartUSec
+              << ", \"dur\": " << S.DurationUSec
+              << ", \"pid\": " << Pid
+              << ", \"tid\": 0}";
+      delim = ",\n";
+    }
+    jstream << "\n]\n";
+  }
+
   if (EventProfilers || EntityProfilers) {
     std::error_code EC = llvm::sys::fs::create_directories(ProfileDirname);
     if (EC) {
@@ -793,6 +967,7 @@ UnifiedStatsReporter::flushTracesAndProfiles() {
   }
   LastTracedFrontendCounters.reset();
   FrontendStatsEvents.reset();
+  FrontendStatsSpans.reset();
   EventProfilers.reset();
   EntityProfilers.reset();
 }
@@ -48,8 +48,10 @@ void TaskProcessInformation::provideMapping(json::Output &out) {
 }
 
 TaskQueue::TaskQueue(unsigned NumberOfParallelTasks,
-                     UnifiedStatsReporter *USR)
+                     UnifiedStatsReporter *USR,
+                     uint64_t MemoryBudget)
   : NumberOfParallelTasks(NumberOfParallelTasks),
+    MemoryBudget(MemoryBudget),
     Stats(USR){}
 
 TaskQueue::~TaskQueue() = default;
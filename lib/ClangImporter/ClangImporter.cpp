@@ -93,6 +93,7 @@
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/FileCollector.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Mutex.h"
 #include "llvm/Support/Memory.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/VirtualFileSystem.h"
@@ -922,10 +923,40 @@ importer::addCommonInvocationArguments(
   }
 }
 
+/// Identity of a PCH file that previously passed deep validation.
+///
+/// The PCH filename encodes a hash of the invocation that produced it (see
+/// \c ClangImporter::getPCHFilename), so filename plus size plus modification
+/// time is enough to recognize the same validated file again.
+struct ValidatedPCHIdentity {
+  uint64_t Size;
+  llvm::sys::TimePoint<> ModTime;
+};
+
+static llvm::sys::SmartMutex<true> ValidatedPCHsMutex;
+static llvm::StringMap<ValidatedPCHIdentity> ValidatedPCHs;
+
 bool ClangImporter::canReadPCH(StringRef PCHFilename) {
-  if (!llvm::sys::fs::exists(PCHFilename))
+  llvm::sys::fs::file_status status;
+  if (llvm::sys::fs::status(PCHFilename, status) ||
+      !llvm::sys::fs::exists(status))
     return false;
 
+  // Successive importer setups in the same process (e.g. back-to-back
+  // SourceKit requests) re-validate the same PCH with a full ASTReader pass,
+  // stat'ing every input header each time. Once a given file has validated
+  // successfully, trust it for as long as it is unchanged on disk; a rebuilt
+  // PCH gets a new modification time and is validated afresh. Failed
+  // validations are never cached, so a rebuild is picked up immediately.
+  {
+    llvm::sys::SmartScopedLock<true> lock(ValidatedPCHsMutex);
+    auto known = ValidatedPCHs.find(PCHFilename);
+    if (known != ValidatedPCHs.end() &&
+        known->second.Size == status.getSize() &&
+        known->second.ModTime == status.getLastModificationTime())
+      return true;
+  }
+
   // FIXME: The following attempts to do an initial ReadAST invocation to verify
   // the PCH, without causing trouble for the existing CompilerInstance.
   // Look into combining creating the ASTReader along with verification + update
@@ -988,8 +1019,12 @@ bool ClangImporter::canReadPCH(StringRef PCHFilename) {
   auto result = Reader.ReadAST(PCHFilename, clang::serialization::MK_PCH,
                                clang::SourceLocation(), failureCapabilities);
   switch (result) {
-  case clang::ASTReader::Success:
+  case clang::ASTReader::Success: {
+    llvm::sys::SmartScopedLock<true> lock(ValidatedPCHsMutex);
+    ValidatedPCHs[PCHFilename] = {status.getSize(),
+                                  status.getLastModificationTime()};
     return true;
+  }
   case clang::ASTReader::Failure:
   case clang::ASTReader::Missing:
   case clang::ASTReader::OutOfDate:
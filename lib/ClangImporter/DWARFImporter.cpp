@@ -62,6 +62,10 @@ public:
       ObjCSelector selector,
       SmallVectorImpl<AbstractFunctionDecl *> &results) const override {}
 
+  virtual bool maybeHasOperatorDeclarations() const override { return false; }
+
+  virtual bool maybeHasPrecedenceGroupDecls() const override { return false; }
+
   virtual void
   getTopLevelDecls(SmallVectorImpl<Decl *> &results) const override {}
 
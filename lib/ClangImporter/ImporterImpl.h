@@ -1703,6 +1703,12 @@ public:
     llvm_unreachable("unimplemented for ClangImporter");
   }
 
+  void loadInheritedProtocols(
+      const ProtocolDecl *decl, uint64_t contextData,
+      SmallVectorImpl<ProtocolDecl *> &inherited) override {
+    llvm_unreachable("unimplemented for ClangImporter");
+  }
+
   template <typename DeclTy, typename ...Targs>
   DeclTy *createDeclWithClangNode(ClangNode ClangN, AccessLevel access,
                                   Targs &&... Args) {
@@ -60,6 +60,11 @@ bool SubstitutionEntry::identifierEquals(Node *lhs, Node *rhs) {
 }
 
 bool SubstitutionEntry::deepEquals(Node *lhs, Node *rhs) const {
+  // Shared subtrees are common when remangling a tree which was built
+  // programmatically. For them, node identity answers the question without
+  // walking the subtree.
+  if (lhs == rhs)
+    return true;
   if (!lhs->isSimilarTo(rhs))
     return false;
 
@@ -163,10 +168,13 @@ SubstitutionEntry RemanglerBase::entryForNode(Node *node,
     }
   }
 
-  // Hash table is full at this hash value
+  // The hash table is full at this hash value. Evict the entry at the first
+  // probe position so that repeatedly queried nodes stay cached instead of
+  // being re-hashed on every lookup.
   SubstitutionEntry entry;
   size_t entryHash = hashForNode(node, treatAsIdentifier);
   entry.setNode(node, treatAsIdentifier, entryHash);
+  HashHash[hash & (HashHashCapacity - 1)] = entry;
   return entry;
 }
 
@@ -3975,6 +3983,15 @@ Demangle::mangleNode(NodePointer node, SymbolicResolver resolver) {
   return remangler.str();
 }
 
+ManglingErrorOr<llvm::StringRef>
+Demangle::mangleNode(NodePointer node, NodeFactory &Factory) {
+  return mangleNode(node,
+                    [](SymbolicReferenceKind, const void *) -> NodePointer {
+                      return nullptr;
+                    },
+                    Factory);
+}
+
 ManglingErrorOr<llvm::StringRef>
 Demangle::mangleNode(NodePointer node, SymbolicResolver resolver,
                      NodeFactory &Factory) {
@@ -69,6 +69,8 @@ private:
       return false;
     if (lhs.treatAsIdentifier != rhs.treatAsIdentifier)
       return false;
+    if (lhs.TheNode == rhs.TheNode)
+      return true;
     if (lhs.treatAsIdentifier) {
       return identifierEquals(lhs.TheNode, rhs.TheNode);
     }
@@ -23,17 +23,20 @@ using namespace swift::c_string_utils;
 using namespace llvm;
 
 namespace {
-std::string quote(StringRef unquoted) {
-  llvm::SmallString<128> buffer;
-  llvm::raw_svector_ostream os(buffer);
-  for (const auto ch : unquoted) {
-    if (ch == '\\')
-      os << '\\';
-    if (ch == '"')
-      os << '\\';
-    os << ch;
+/// Write \p unquoted to \p out with JSON escaping, without building a
+/// temporary string. Runs of characters that need no escaping are written in
+/// bulk, so emitting large outputs doesn't allocate per string.
+void writeQuoted(llvm::raw_ostream &out, StringRef unquoted) {
+  while (!unquoted.empty()) {
+    size_t nextEscape = unquoted.find_first_of("\\\"");
+    if (nextEscape == StringRef::npos) {
+      out << unquoted;
+      return;
+    }
+    out << unquoted.take_front(nextEscape);
+    out << '\\' << unquoted[nextEscape];
+    unquoted = unquoted.drop_front(nextEscape + 1);
   }
-  return buffer.str().str();
 }
 } // namespace
 
@@ -47,14 +50,14 @@ void writeJSONSingleField(llvm::raw_ostream &out, StringRef fieldName,
 void writeJSONValue(llvm::raw_ostream &out, StringRef value,
                     unsigned indentLevel) {
   out << "\"";
-  out << quote(value);
+  writeQuoted(out, value);
   out << "\"";
 }
 
 void writeJSONValue(llvm::raw_ostream &out, swiftscan_string_ref_t value,
                     unsigned indentLevel) {
   out << "\"";
-  out << quote(get_C_string(value));
+  writeQuoted(out, get_C_string(value));
   out << "\"";
 }
 
@@ -409,7 +412,9 @@ void writeJSON(llvm::raw_ostream &out,
           const auto &candidate = get_C_string(
               swiftTextualDeps->compiled_module_candidates->strings[i]);
           out.indent(6 * 2);
-          out << "\"" << quote(candidate) << "\"";
+          out << "\"";
+          writeQuoted(out, candidate);
+          out << "\"";
           if (i != count - 1)
             out << ",";
           out << "\n";
@@ -424,7 +429,9 @@ void writeJSON(llvm::raw_ostream &out,
         const auto &arg =
             get_C_string(swiftTextualDeps->command_line->strings[i]);
         out.indent(6 * 2);
-        out << "\"" << quote(arg) << "\"";
+        out << "\"";
+        writeQuoted(out, arg);
+        out << "\"";
         if (i != count - 1)
           out << ",";
         out << "\n";
@@ -471,7 +478,9 @@ void writeJSON(llvm::raw_ostream &out,
           const auto &arg =
               get_C_string(swiftTextualDeps->extra_pcm_args->strings[i]);
           out.indent(6 * 2);
-          out << "\"" << quote(arg) << "\"";
+          out << "\"";
+          writeQuoted(out, arg);
+          out << "\"";
           if (i != count - 1)
             out << ",";
           out << "\n";
@@ -505,7 +514,9 @@ void writeJSON(llvm::raw_ostream &out,
           const auto &arg = get_C_string(
               swiftTextualDeps->bridging_pch_command_line->strings[i]);
           out.indent(7 * 2);
-          out << "\"" << quote(arg) << "\"";
+          out << "\"";
+          writeQuoted(out, arg);
+          out << "\"";
           if (i != count - 1)
             out << ",";
           out << "\n";
@@ -394,6 +394,18 @@ std::unique_ptr<sys::TaskQueue> Driver::buildTaskQueue(const Compilation &C) {
                      "-j");
   }
 
+  uint64_t MemoryBudget = 0;
+  if (const Arg *A =
+          ArgList.getLastArg(options::OPT_driver_job_memory_budget)) {
+    uint64_t MemoryBudgetMiB = 0;
+    if (StringRef(A->getValue()).getAsInteger(10, MemoryBudgetMiB)) {
+      Diags.diagnose(SourceLoc(), diag::error_invalid_arg_value,
+                     A->getAsString(ArgList), A->getValue());
+      return nullptr;
+    }
+    MemoryBudget = MemoryBudgetMiB * 1024 * 1024;
+  }
+
   const bool DriverSkipExecution =
     ArgList.hasArg(options::OPT_driver_skip_execution,
                    options::OPT_driver_print_jobs);
@@ -401,7 +413,8 @@ std::unique_ptr<sys::TaskQueue> Driver::buildTaskQueue(const Compilation &C) {
     return std::make_unique<sys::DummyTaskQueue>(NumberOfParallelCommands);
   } else {
     return std::make_unique<sys::TaskQueue>(NumberOfParallelCommands,
-                                             C.getStatsReporter());
+                                             C.getStatsReporter(),
+                                             MemoryBudget);
   }
 }
 
@@ -122,6 +122,16 @@ bool ArgsToFrontendOptionsConverter::convert(
     Opts.BadFileDescriptorRetryCount = limit;
   }
 
+  if (const Arg *A = Args.getLastArg(OPT_memory_watermark_mb_EQ)) {
+    unsigned watermark;
+    if (StringRef(A->getValue()).getAsInteger(10, watermark)) {
+      Diags.diagnose(SourceLoc(), diag::error_invalid_arg_value,
+                     A->getAsString(Args), A->getValue());
+      return true;
+    }
+    Opts.MemoryWatermarkMB = watermark;
+  }
+
   if (auto A = Args.getLastArg(OPT_user_module_version)) {
     StringRef raw(A->getValue());
     while(raw.count('.') > 3) {
@@ -308,6 +318,8 @@ bool ArgsToFrontendOptionsConverter::convert(
   Opts.EnableSourceImport |= Args.hasArg(OPT_enable_source_import);
   Opts.ImportUnderlyingModule |= Args.hasArg(OPT_import_underlying_module);
   Opts.EnableIncrementalDependencyVerifier |= Args.hasArg(OPT_verify_incremental_dependencies);
+  Opts.EnableFileSystemStatCache |=
+      Args.hasArg(OPT_enable_filesystem_stat_cache);
   Opts.UseSharedResourceFolder = !Args.hasArg(OPT_use_static_resource_dir);
   Opts.DisableBuildingInterface = Args.hasArg(OPT_disable_building_interface);
   if (const Arg *A = Args.getLastArg(options::OPT_clang_header_expose_decls)) {
@@ -414,6 +426,12 @@ void ArgsToFrontendOptionsConverter::computeDebugTimeOptions() {
     if (Args.getLastArg(OPT_profile_stats_entities)) {
       Opts.ProfileEntities = true;
     }
+    if (Args.getLastArg(OPT_stream_stats_events)) {
+      Opts.StreamStats = true;
+    }
+    if (Args.getLastArg(OPT_trace_stats_chrome)) {
+      Opts.TraceStatsChrome = true;
+    }
   }
 }
 
@@ -899,6 +899,20 @@ static bool ParseLangArgs(LangOptions &Opts, ArgList &Args,
   if (Args.getLastArg(OPT_debug_cycles))
     Opts.DebugDumpCycles = true;
 
+  if (Args.getLastArg(OPT_dump_request_timers))
+    Opts.DumpRequestTimers = true;
+
+  if (const Arg *A = Args.getLastArg(OPT_warn_long_request_evaluation)) {
+    unsigned threshold;
+    if (StringRef(A->getValue()).getAsInteger(10, threshold)) {
+      Diags.diagnose(SourceLoc(), diag::error_invalid_arg_value,
+                     A->getAsString(Args), A->getValue());
+      HadError = true;
+    } else {
+      Opts.WarnLongRequestEvaluation = threshold;
+    }
+  }
+
   Opts.RequireExplicitSendable |= Args.hasArg(OPT_require_explicit_sendable);
   for (const Arg *A : Args.filtered(OPT_define_availability)) {
     Opts.AvailabilityMacros.push_back(A->getValue());
@@ -2621,6 +2635,9 @@ static bool ParseSILArgs(SILOptions &Opts, ArgList &Args,
     }
   }
 
+  Opts.EnablePackageWideDevirtualization |=
+      Args.hasArg(OPT_ExperimentalPackageWideDevirt);
+
   Opts.EnableStackProtection =
       Args.hasFlag(OPT_enable_stack_protector, OPT_disable_stack_protector,
                    Opts.EnableStackProtection);
@@ -2652,6 +2669,9 @@ static bool ParseSILArgs(SILOptions &Opts, ArgList &Args,
   Opts.UseProfile = ProfileUse ? ProfileUse->getValue() : "";
 
   Opts.EmitProfileCoverageMapping |= Args.hasArg(OPT_profile_coverage_mapping);
+  Opts.EmitSparseProfileCounters |= Args.hasArg(OPT_profile_sparse_coverage);
+  if (const Arg *A = Args.getLastArg(OPT_used_symbols_list_EQ))
+    Opts.ExternallyUsedSymbolsFile = A->getValue();
   Opts.DisableSILPartialApply |=
     Args.hasArg(OPT_disable_sil_partial_apply);
   Opts.VerifySILOwnership &= !Args.hasArg(OPT_disable_sil_ownership_verifier);
@@ -3091,6 +3111,8 @@ static bool ParseIRGenArgs(IRGenOptions &Opts, ArgList &Args,
   else if (Args.hasArg(OPT_embed_bitcode_marker))
     Opts.EmbedMode = IRGenEmbedMode::EmbedMarker;
 
+  Opts.EmbedSIL |= Args.hasArg(OPT_embed_sil);
+
   if (Opts.EmbedMode == IRGenEmbedMode::EmbedBitcode) {
     // Keep track of backend options so we can embed them in a separate data
     // section and use them when building from the bitcode. This can be removed
@@ -3182,11 +3204,17 @@ static bool ParseIRGenArgs(IRGenOptions &Opts, ArgList &Args,
     Opts.DisableLegacyTypeInfo = true;
   }
 
-  if (Args.hasArg(OPT_prespecialize_generic_metadata) &&
+  if ((Args.hasArg(OPT_prespecialize_generic_metadata) ||
+       Args.hasArg(OPT_prespecialize_generic_metadata_list_EQ)) &&
       !Args.hasArg(OPT_disable_generic_metadata_prespecialization)) {
     Opts.PrespecializeGenericMetadata = true;
   }
 
+  if (const Arg *A =
+          Args.getLastArg(OPT_prespecialize_generic_metadata_list_EQ)) {
+    Opts.PrespecializeGenericMetadataListPath = A->getValue();
+  }
+
   if (const Arg *A = Args.getLastArg(OPT_read_legacy_type_info_path_EQ)) {
     Opts.ReadLegacyTypeInfoPath = A->getValue();
   }
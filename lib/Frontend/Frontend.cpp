@@ -25,6 +25,7 @@
 #include "swift/AST/PluginLoader.h"
 #include "swift/AST/TypeCheckRequests.h"
 #include "swift/Basic/Assertions.h"
+#include "swift/Basic/FileSystem.h"
 #include "swift/Basic/FileTypes.h"
 #include "swift/Basic/Platform.h"
 #include "swift/Basic/SourceManager.h"
@@ -379,7 +380,9 @@ void CompilerInstance::setupStatsReporter() {
       getClangSourceManager(getASTContext()),
       Invoke.getFrontendOptions().TraceStats,
       Invoke.getFrontendOptions().ProfileEvents,
-      Invoke.getFrontendOptions().ProfileEntities);
+      Invoke.getFrontendOptions().ProfileEntities,
+      Invoke.getFrontendOptions().StreamStats,
+      Invoke.getFrontendOptions().TraceStatsChrome);
   // Hand the stats reporter down to the ASTContext so the rest of the compiler
   // can use it.
   getASTContext().setStatsReporter(Reporter.get());
@@ -691,6 +694,14 @@ bool CompilerInstance::setUpVirtualFileSystemOverlays() {
   }
 
   SourceMgr.setFileSystem(*ExpectedOverlay);
+
+  // Wrap the fully-overlaid file system in a stat cache if requested, so
+  // repeated status and symlink resolution queries issued by the various
+  // module loaders are answered without hitting the disk again.
+  if (Invocation.getFrontendOptions().EnableFileSystemStatCache)
+    SourceMgr.setFileSystem(
+        createStatCachingFileSystem(SourceMgr.getFileSystem()));
+
   return false;
 }
 
@@ -942,6 +953,17 @@ bool CompilerInstance::setUpInputs() {
   const bool shouldRecover = Invocation.getFrontendOptions()
                                  .InputsAndOutputs.shouldRecoverMissingInputs();
 
+  // Let the OS start reading the inputs into the page cache while we ingest
+  // them one at a time below. This is purely a hint; inputs that only exist
+  // in a VFS overlay simply fail to open and are fetched normally.
+  if (Inputs.size() > 1) {
+    SmallVector<StringRef, 16> inputPaths;
+    for (const InputFile &input : Inputs)
+      if (!input.getBuffer() && input.getFileName() != "-")
+        inputPaths.push_back(input.getFileName());
+    prefetchFiles(inputPaths);
+  }
+
   bool hasFailed = false;
   for (const InputFile &input : Inputs) {
     bool failed = false;
@@ -49,7 +49,9 @@
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/Errc.h"
 #include "llvm/Support/Error.h"
+#include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Path.h"
+#include "llvm/Support/Process.h"
 #include "llvm/Support/VirtualOutputBackend.h"
 #include "llvm/Support/YAMLParser.h"
 #include "llvm/Support/YAMLTraits.h"
@@ -221,6 +223,28 @@ static bool serializedASTLooksValid(const llvm::MemoryBuffer &buf,
   return VI.status == serialization::Status::Valid;
 }
 
+/// Best-effort update of a cache entry's access time, leaving its
+/// modification time untouched. Forwarding-module dependency validation
+/// compares modification times, so those must never be disturbed here; the
+/// access time only exists so external cache-compaction tooling can tell hot
+/// entries from cold ones, including on filesystems mounted noatime.
+/// Failures (read-only caches, entries only visible through a VFS overlay)
+/// are ignored.
+static void updateCacheEntryAccessTime(StringRef path) {
+  llvm::sys::fs::file_status status;
+  if (llvm::sys::fs::status(path, status))
+    return;
+  int fd;
+  if (llvm::sys::fs::openFileForWrite(path, fd, llvm::sys::fs::CD_OpenExisting))
+    return;
+  (void)llvm::sys::fs::setLastAccessAndModificationTime(
+      fd,
+      std::chrono::time_point_cast<std::chrono::nanoseconds>(
+          std::chrono::system_clock::now()),
+      status.getLastModificationTime());
+  llvm::sys::Process::SafelyCloseFileDescriptor(fd);
+}
+
 #pragma mark - Module Loading
 
 namespace {
@@ -1017,6 +1041,7 @@ class ModuleInterfaceLoaderImpl {
                                          moduleBuffer)) {
             LLVM_DEBUG(llvm::dbgs() << "Found up-to-date forwarding module at "
                                     << cachedOutputPath << "\n");
+            updateCacheEntryAccessTime(cachedOutputPath);
             return DiscoveredModule::forwarded(
               forwardingModule->underlyingModulePath, std::move(moduleBuffer));
           }
@@ -1031,6 +1056,7 @@ class ModuleInterfaceLoaderImpl {
                                                                rebuildInfo, deps)) {
         LLVM_DEBUG(llvm::dbgs() << "Found up-to-date cached module at "
                                 << cachedOutputPath << "\n");
+        updateCacheEntryAccessTime(cachedOutputPath);
         return DiscoveredModule::normal(cachedOutputPath, std::move(buf));
       } else {
         LLVM_DEBUG(llvm::dbgs() << "Found out-of-date cached module at "
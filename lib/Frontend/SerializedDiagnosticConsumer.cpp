@@ -665,11 +665,16 @@ void SerializedDiagnosticConsumer::handleDiagnostic(
     enterDiagBlock();
 
   // Actually substitute the diagnostic arguments into the diagnostic text.
-  llvm::SmallString<256> Text;
-  {
-    llvm::raw_svector_ostream Out(Text);
+  // If the format string has nothing to substitute, emit it directly and
+  // skip the formatting pass entirely; otherwise render it into the shared
+  // text buffer so repeated large diagnostics reuse its allocation.
+  StringRef Text = Info.FormatString;
+  if (!Info.FormatArgs.empty() || Text.contains('%')) {
+    State->diagBuf.clear();
+    llvm::raw_svector_ostream Out(State->diagBuf);
     DiagnosticEngine::formatDiagnosticText(Out, Info.FormatString,
                                            Info.FormatArgs);
+    Text = State->diagBuf;
   }
 
   emitDiagnosticMessage(SM, Info.Loc, Info.Kind, Text, Info);
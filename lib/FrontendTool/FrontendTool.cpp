@@ -64,6 +64,7 @@
 #include "swift/Option/Options.h"
 #include "swift/PrintAsClang/PrintAsClang.h"
 #include "swift/SILOptimizer/PassManager/Passes.h"
+#include "swift/Serialization/Serialization.h"
 #include "swift/Serialization/SerializationOptions.h"
 #include "swift/Serialization/SerializedModuleLoader.h"
 #include "swift/Subsystems.h"
@@ -88,6 +89,7 @@
 #include "llvm/Support/VirtualOutputBackend.h"
 #include "llvm/Support/VirtualOutputBackends.h"
 #include "llvm/Support/raw_ostream.h"
+#include "llvm/Transforms/Utils/ModuleUtils.h"
 
 #if __has_include(<unistd.h>)
 #include <unistd.h>
@@ -133,11 +135,13 @@ emitLoadedModuleTraceForAllPrimariesIfNeeded(ModuleDecl *mainModule,
 static bool writeSIL(SILModule &SM, ModuleDecl *M, const SILOptions &Opts,
                      StringRef OutputFilename,
                      llvm::vfs::OutputBackend &Backend) {
-  return withOutputPath(M->getDiags(), Backend, OutputFilename,
-                        [&](raw_ostream &out) -> bool {
-                          SM.print(out, M, Opts);
-                          return M->getASTContext().hadError();
-                        });
+  // SIL dumps of large modules can run to gigabytes of text; stream them to
+  // disk rather than buffering the whole output in memory.
+  return withStreamingOutputPath(M->getDiags(), Backend, OutputFilename,
+                                 [&](raw_ostream &out) -> bool {
+                                   SM.print(out, M, Opts);
+                                   return M->getASTContext().hadError();
+                                 });
 }
 
 static bool writeSIL(SILModule &SM, const PrimarySpecificPaths &PSPs,
@@ -307,6 +311,28 @@ static void countStatsPostSILGen(UnifiedStatsReporter &Stats,
   C.NumSILGenGlobalVariables += Module.getSILGlobalList().size();
 }
 
+/// If the invocation configured a memory watermark, compare the memory
+/// retained by the AST context (and, if present, the SIL module) against it
+/// and warn when the watermark is exceeded. This gives build systems an
+/// observable signal to split or reschedule the job before the process is
+/// killed for exceeding its memory budget.
+static void checkMemoryWatermark(CompilerInstance &Instance,
+                                 const SILModule *SM = nullptr) {
+  unsigned watermarkMB =
+      Instance.getInvocation().getFrontendOptions().MemoryWatermarkMB;
+  if (watermarkMB == 0)
+    return;
+
+  size_t usedBytes = Instance.getASTContext().getTotalMemory();
+  if (SM)
+    usedBytes += SM->getTotalMemory();
+  unsigned usedMB = unsigned(usedBytes >> 20);
+  if (usedMB > watermarkMB)
+    Instance.getDiags().diagnose(
+        SourceLoc(), diag::warning_memory_watermark_exceeded, usedMB,
+        watermarkMB);
+}
+
 static bool precompileBridgingHeader(const CompilerInstance &Instance) {
   const auto &Invocation = Instance.getInvocation();
   const auto &opts = Invocation.getFrontendOptions();
@@ -472,12 +498,12 @@ static bool dumpAST(CompilerInstance &Instance) {
     for (SourceFile *sourceFile: primaryFiles) {
       auto PSPs = Instance.getPrimarySpecificPathsForSourceFile(*sourceFile);
       auto OutputFilename = PSPs.OutputFilename;
-      if (withOutputPath(Instance.getASTContext().Diags,
-                         Instance.getOutputBackend(), OutputFilename,
-                         [&](raw_ostream &out) -> bool {
-                           sourceFile->dump(out, /*parseIfNeeded*/ true);
-                           return false;
-                         }))
+      if (withStreamingOutputPath(Instance.getASTContext().Diags,
+                                  Instance.getOutputBackend(), OutputFilename,
+                                  [&](raw_ostream &out) -> bool {
+                                    sourceFile->dump(out, /*parseIfNeeded*/ true);
+                                    return false;
+                                  }))
         return true;
     }
   } else {
@@ -1139,6 +1165,8 @@ withSemanticAnalysis(CompilerInstance &Instance, FrontendObserver *observer,
   if (observer)
     observer->performedSemanticAnalysis(Instance);
 
+  checkMemoryWatermark(Instance);
+
   switch (opts.CrashMode) {
   case FrontendOptions::DebugCrashMode::AssertAfterParse:
     debugFailWithAssertion();
@@ -1403,6 +1431,22 @@ static bool serializeSIB(SILModule *SM, const PrimarySpecificPaths &PSPs,
   return Context.hadError();
 }
 
+/// With -embed-sil, save the module's serialized SIL as data in the
+/// __LLVM,__swift_sil section, mirroring what -embed-bitcode does for LLVM IR.
+/// The blob is the same optimizer-ready SIL that -emit-sib would produce, so
+/// post-link tools can recover and re-optimize it without rebuilding sources.
+static void embedSerializedSIL(llvm::Module *M, StringRef SILData) {
+  ArrayRef<uint8_t> ModuleData(
+      reinterpret_cast<const uint8_t *>(SILData.data()), SILData.size());
+  llvm::Constant *ModuleConstant =
+      llvm::ConstantDataArray::get(M->getContext(), ModuleData);
+  auto *GV = new llvm::GlobalVariable(*M, ModuleConstant->getType(), true,
+                                      llvm::GlobalValue::PrivateLinkage,
+                                      ModuleConstant, "llvm.embedded.swift.sil");
+  GV->setSection("__LLVM,__swift_sil");
+  llvm::appendToCompilerUsed(*M, {GV});
+}
+
 static bool serializeModuleSummary(SILModule *SM,
                                    const PrimarySpecificPaths &PSPs,
                                    const ASTContext &Context) {
@@ -1708,6 +1752,8 @@ static bool performCompileStepsPostSILGen(CompilerInstance &Instance,
   if (observer)
     observer->performedSILProcessing(*SM);
 
+  checkMemoryWatermark(Instance, SM.get());
+
   // Cancellation check after SILOptimization.
   if (Instance.isCancellationRequested())
     return true;
@@ -1767,6 +1813,17 @@ static bool performCompileStepsPostSILGen(CompilerInstance &Instance,
     return processCommandLineAndRunImmediately(
         Instance, std::move(SM), MSF, observer, ReturnValue);
 
+  // Serialize the SIL for embedding now; IRGen consumes the SILModule.
+  std::string EmbeddedSILData;
+  if (IRGenOpts.EmbedSIL) {
+    SerializationOptions serializationOpts;
+    serializationOpts.SerializeAllSIL = true;
+    serializationOpts.IsSIB = true;
+    llvm::raw_string_ostream OS(EmbeddedSILData);
+    serialization::writeToStream(OS, MSF, SM.get(), serializationOpts,
+                                 /*DepGraph*/ nullptr);
+  }
+
   StringRef OutputFilename = PSPs.OutputFilename;
   std::vector<std::string> ParallelOutputFilenames =
       opts.InputsAndOutputs.copyOutputFilenames();
@@ -1788,6 +1845,9 @@ static bool performCompileStepsPostSILGen(CompilerInstance &Instance,
   if (validateTBDIfNeeded(Invocation, MSF, *IRModule.getModule()))
     return true;
 
+  if (IRGenOpts.EmbedSIL)
+    embedSerializedSIL(IRModule.getModule(), EmbeddedSILData);
+
   if (IRGenOpts.UseSingleModuleLLVMEmission) {
     // Pretend the other files that drivers/build systems expect exist by
     // creating empty files.
@@ -1349,9 +1349,17 @@ void swift::ide::collectCompletionResults(
 
   for (auto &Request: Lookup.RequestedCachedResults) {
     llvm::DenseSet<CodeCompletionCache::Key> ImportsSeen;
+    llvm::SmallPtrSet<ModuleDecl *, 16> ModulesSeen;
     auto handleImport = [&](ImportedModule Import) {
       ModuleDecl *TheModule = Import.importedModule;
       ImportPath::Access Path = Import.accessPath;
+
+      // A module is commonly reachable through many imports with no access
+      // path restriction. Deduplicate those here, before constructing the
+      // full cache key just to find it in ImportsSeen.
+      if (Path.empty() && !ModulesSeen.insert(TheModule).second)
+        return;
+
       if (TheModule->getFiles().empty())
         return;
 
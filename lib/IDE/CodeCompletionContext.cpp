@@ -13,6 +13,7 @@
 #include "swift/Basic/Assertions.h"
 #include "swift/IDE/CodeCompletionContext.h"
 #include "swift/IDE/CodeCompletionCache.h"
+#include "llvm/ADT/DenseMap.h"
 
 using namespace swift;
 using namespace swift::ide;
@@ -131,10 +132,23 @@ void CodeCompletionContext::addResultsFromModules(
   // context changes to cached results.
   const SourceFile *SF = DC->getParentSourceFile();
 
+  // The same module may be requested once per completion filter. Resolve
+  // each key against the cache (which revalidates against the module file
+  // on disk) only once per request and reuse the value for the remaining
+  // filters.
+  llvm::DenseMap<CodeCompletionCache::Key, CodeCompletionCache::ValueRefCntPtr>
+      ResolvedModules;
+
   for (auto &R : RequestedModules) {
+    std::optional<CodeCompletionCache::ValueRefCntPtr> V;
+    auto Resolved = ResolvedModules.find(R.Key);
+    if (Resolved != ResolvedModules.end())
+      V = Resolved->second;
+
     // FIXME(thread-safety): lock the whole AST context.  We might load a
     // module.
-    std::optional<CodeCompletionCache::ValueRefCntPtr> V = Cache.get(R.Key);
+    if (!V.has_value())
+      V = Cache.get(R.Key);
     if (!V.has_value()) {
       // No cached results found. Fill the cache.
       V = Cache.createValue();
@@ -166,6 +180,7 @@ void CodeCompletionContext::addResultsFromModules(
       Cache.set(R.Key, *V);
     }
     assert(V.has_value());
+    ResolvedModules[R.Key] = *V;
     auto newItems =
         copyCodeCompletionResults(getResultSink(), **V, R.Filter, &TypeContext,
                                   DC, CanCurrDeclContextHandleAsync);
@@ -119,6 +119,15 @@ getModifiedFunctionDeclList(const SourceFile &SF, SourceManager &tmpSM,
     return true;
   }
 
+  // If the source text is unchanged, there is nothing to re-typecheck; skip
+  // constructing the temporary ASTContext and re-parsing the file. This is
+  // the common case when only *other* files of the module were modified.
+  if (auto origBufferID = SF.getBufferID()) {
+    if ((*tmpBuffer)->getBuffer() ==
+        ctx.SourceMgr.getEntireTextForBuffer(*origBufferID))
+      return false;
+  }
+
   // Parse the new buffer into temporary SourceFile.
 
   LangOptions langOpts = ctx.LangOpts;
@@ -44,7 +44,15 @@ public:
   Explosion(const Explosion &) = delete;
   Explosion &operator=(const Explosion &) = delete;
   Explosion(Explosion &&other) : NextValue(0) {
-    // Do an uninitialized copy of the non-consumed elements.
+    // If nothing has been claimed from the other explosion, steal its
+    // buffer wholesale instead of copying the elements.
+    if (other.NextValue == 0) {
+      Values = std::move(other.Values);
+      other.reset();
+      return;
+    }
+
+    // Otherwise, do an uninitialized copy of the non-consumed elements.
     Values.resize_for_overwrite(other.size());
     std::uninitialized_copy(other.begin(), other.end(), Values.begin());
 
@@ -120,6 +128,15 @@ public:
 
   /// Transfer ownership of the next N values to the given explosion.
   void transferInto(Explosion &other, unsigned n) {
+    // Given that nothing has been claimed from this explosion yet, moving
+    // all of its values into an empty explosion can steal the buffer
+    // instead of copying the values.
+    if (NextValue == 0 && n == Values.size() && other.Values.empty()) {
+      assert(other.empty() && "stealing buffer into a claimed explosion?");
+      other.Values = std::move(Values);
+      reset();
+      return;
+    }
     other.add(claim(n));
   }
 
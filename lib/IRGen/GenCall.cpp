@@ -2814,7 +2814,7 @@ public:
 
       // Anything else, just pass along.  This will include things like
       // generic arguments.
-      adjusted.add(original.claimAll());
+      original.transferInto(adjusted, original.size());
 
       break;
     }
@@ -3142,7 +3142,7 @@ public:
 
       // Anything else, just pass along.  This will include things like
       // generic arguments.
-      asyncExplosion.add(original.claimAll());
+      original.transferInto(asyncExplosion, original.size());
 
       break;
     }
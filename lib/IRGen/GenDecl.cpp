@@ -16,8 +16,10 @@
 //===----------------------------------------------------------------------===//
 
 #include "swift/AST/ASTContext.h"
+#include "swift/AST/ASTDemangler.h"
 #include "swift/AST/Decl.h"
 #include "swift/AST/DiagnosticEngine.h"
+#include "swift/AST/DiagnosticsIRGen.h"
 #include "swift/AST/GenericEnvironment.h"
 #include "swift/AST/GenericSignature.h"
 #include "swift/AST/IRGenOptions.h"
@@ -51,6 +53,7 @@
 #include "llvm/IR/Value.h"
 #include "llvm/Support/Compiler.h"
 #include "llvm/Support/ConvertUTF.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/SaveAndRestore.h"
 #include "llvm/Target/TargetMachine.h"
@@ -1248,6 +1251,10 @@ void IRGenerator::emitGlobalTopLevel(
     IGM->finishEmitAfterTopLevel();
   }
 
+  // Enqueue any profile-directed metadata specializations so that they are
+  // emitted alongside the specializations noted during top-level emission.
+  noteUsesOfSpecializedGenericTypeMetadataFromList();
+
   emitEntryPointInfo();
 }
 
@@ -1703,6 +1710,88 @@ void IRGenerator::noteUseOfSpecializedGenericTypeMetadata(
   }
 }
 
+void IRGenerator::noteUsesOfSpecializedGenericTypeMetadataFromList() {
+  StringRef path = Opts.PrespecializeGenericMetadataListPath;
+  if (path.empty())
+    return;
+
+  auto &ctx = SIL.getASTContext();
+  // In embedded Swift, the compiler cannot emit metadata records at all.
+  if (ctx.LangOpts.hasFeature(Feature::Embedded))
+    return;
+
+  auto fs = ctx.SourceMgr.getFileSystem();
+  auto buffer = fs->getBufferForFile(path);
+  if (!buffer) {
+    PrimaryIGM->error(SourceLoc(),
+                      "Cannot read prespecialization list at '" + path + "'");
+    return;
+  }
+
+  SmallVector<StringRef, 16> lines;
+  (*buffer)->getBuffer().split(lines, '\n', /*MaxSplit=*/-1,
+                               /*KeepEmpty=*/false);
+  for (auto line : lines) {
+    auto mangledName = line.trim();
+    // Allow blank lines and comments in the list.
+    if (mangledName.empty() || mangledName.starts_with("#"))
+      continue;
+
+    auto type = Demangle::getTypeForMangling(ctx, mangledName);
+    if (!type) {
+      ctx.Diags.diagnose(SourceLoc(), diag::type_to_prespecialize_not_found,
+                         mangledName);
+      continue;
+    }
+
+    auto theType = type->getCanonicalType();
+    auto *nominal = theType->getAnyNominal();
+    if (!nominal || !nominal->isGenericContext() ||
+        !typeKindCanBePrespecialized(theType->getKind()) ||
+        theType->hasUnboundGenericType() || theType->hasTypeParameter()) {
+      ctx.Diags.diagnose(SourceLoc(),
+                         diag::cannot_prespecialize_metadata_for_type, type);
+      continue;
+    }
+
+    CurrentIGMPtr IGM = getGenModule(nominal->getDeclContext());
+
+    // Specializations of generic types defined in this module are canonical
+    // and are simply added to the type's metadata cache; records for types
+    // defined elsewhere are non-canonical and are canonicalized by the
+    // runtime on first use.
+    auto canonicality = IGM->getSwiftModule() == nominal->getModuleContext()
+                            ? CanonicalSpecializedMetadata
+                            : NoncanonicalSpecializedMetadata;
+
+    if (isCompleteSpecializedNominalTypeMetadataStaticallyAddressable(
+            *IGM.get(), theType, canonicality)) {
+      noteUseOfSpecializedGenericTypeMetadata(
+          *IGM.get(), theType,
+          canonicality == CanonicalSpecializedMetadata
+              ? TypeMetadataCanonicality::Canonical
+              : TypeMetadataCanonicality::Noncanonical);
+      continue;
+    }
+
+    // Class specializations are reached through their canonical specialized
+    // accessor, which initializes the metadata (e.g. registering the class
+    // with the Objective-C runtime) on first use.
+    if (isa<ClassDecl>(nominal) &&
+        canonicality == CanonicalSpecializedMetadata &&
+        isSpecializedNominalTypeMetadataStaticallyAddressable(
+            *IGM.get(), theType, CanonicalSpecializedMetadata,
+            ForUseOnlyFromAccessor)) {
+      (void)IGM->getAddrOfCanonicalSpecializedGenericTypeMetadataAccessFunction(
+          theType, NotForDefinition);
+      continue;
+    }
+
+    ctx.Diags.diagnose(SourceLoc(),
+                       diag::cannot_prespecialize_metadata_for_type, type);
+  }
+}
+
 void IRGenerator::noteUseOfOpaqueTypeDescriptor(OpaqueTypeDecl *opaque) {
   if (!opaque)
     return;
@@ -1349,22 +1349,60 @@ void IRGenFunction::emitUnknownStrongRelease(llvm::Value *value,
                         value);
 }
 
+/// Emit a fast-path check for a tagged Builtin.BridgeObject value, e.g. a
+/// small string, which needs no reference counting at all. If the target
+/// encodes the tag in statically known bits, branch around the runtime call
+/// and return the continuation block; otherwise return null and leave the
+/// insertion point alone.
+static llvm::BasicBlock *emitBridgeObjectTaggedBranch(IRGenFunction &IGF,
+                                                      llvm::Value *value) {
+  auto &IGM = IGF.IGM;
+  // At -Onone, keep the straightforward runtime call.
+  if (!IGM.IRGen.Opts.shouldOptimize())
+    return nullptr;
+  const auto &tagBits = IGM.TargetInfo.BridgeObjectTagBits;
+  if (!tagBits.any())
+    return nullptr;
+
+  llvm::Value *boBits = IGF.Builder.CreatePtrToInt(value, IGM.SizeTy);
+  llvm::Value *mask = IGF.Builder.getInt(tagBits.asAPInt());
+  llvm::Value *masked = IGF.Builder.CreateAnd(boBits, mask);
+  llvm::Value *isTagged =
+    IGF.Builder.CreateICmpNE(masked, llvm::ConstantInt::get(IGM.SizeTy, 0));
+
+  llvm::BasicBlock *untaggedBB = IGF.createBasicBlock("not-tagged-pointer");
+  llvm::BasicBlock *contBB = IGF.createBasicBlock("tagged-cont");
+  IGF.Builder.CreateCondBr(isTagged, contBB, untaggedBB);
+  IGF.Builder.emitBlock(untaggedBB);
+  return contBB;
+}
+
 void IRGenFunction::emitBridgeStrongRetain(llvm::Value *value,
                                            Atomicity atomicity) {
+  llvm::BasicBlock *contBB = emitBridgeObjectTaggedBranch(*this, value);
   emitUnaryRefCountCall(*this,
                         (atomicity == Atomicity::Atomic)
                             ? IGM.getBridgeObjectStrongRetainFn()
                             : IGM.getNonAtomicBridgeObjectStrongRetainFn(),
                         value);
+  if (contBB) {
+    Builder.CreateBr(contBB);
+    Builder.emitBlock(contBB);
+  }
 }
 
 void IRGenFunction::emitBridgeStrongRelease(llvm::Value *value,
                                             Atomicity atomicity) {
+  llvm::BasicBlock *contBB = emitBridgeObjectTaggedBranch(*this, value);
   emitUnaryRefCountCall(*this,
                         (atomicity == Atomicity::Atomic)
                             ? IGM.getBridgeObjectStrongReleaseFn()
                             : IGM.getNonAtomicBridgeObjectStrongReleaseFn(),
                         value);
+  if (contBB) {
+    Builder.CreateBr(contBB);
+    Builder.emitBlock(contBB);
+  }
 }
 
 void IRGenFunction::emitErrorStrongRetain(llvm::Value *value) {
@@ -992,6 +992,34 @@ getDestructiveInjectEnumTagFunction(IRGenModule &IGM,
   }
 }
 
+/// Whether the body of this value witness, when built from a type layout
+/// entry, is fully determined by the layout: it neither consults the type
+/// metadata argument nor an enum implementation strategy. Such witnesses can
+/// be shared between types whose layouts unique to the same entry.
+static bool valueWitnessDependsOnlyOnLayout(ValueWitness index) {
+  switch (index) {
+  case ValueWitness::Destroy:
+  case ValueWitness::InitializeBufferWithCopyOfBuffer:
+  case ValueWitness::InitializeWithCopy:
+  case ValueWitness::InitializeWithTake:
+  case ValueWitness::AssignWithCopy:
+  case ValueWitness::AssignWithTake:
+    return true;
+
+  case ValueWitness::GetEnumTagSinglePayload:
+  case ValueWitness::StoreEnumTagSinglePayload:
+  case ValueWitness::Size:
+  case ValueWitness::Stride:
+  case ValueWitness::Flags:
+  case ValueWitness::ExtraInhabitantCount:
+  case ValueWitness::GetEnumTag:
+  case ValueWitness::DestructiveProjectEnumData:
+  case ValueWitness::DestructiveInjectEnumTag:
+    return false;
+  }
+  llvm_unreachable("not all value witnesses covered");
+}
+
 static bool
 valueWitnessRequiresCopyability(ValueWitness index) {
   switch (index) {
@@ -1281,11 +1309,33 @@ static void addValueWitness(IRGenModule &IGM, ConstantStructBuilder &B,
  llvm::Function *IRGenModule::getOrCreateValueWitnessFunction(
      ValueWitness index, FixedPacking packing, CanType abstractType,
      SILType concreteType, const TypeInfo &type) {
+  // Witnesses whose body comes from a type layout entry depend only on the
+  // layout, and layout entries are uniqued structurally in the module's
+  // TypeLayoutCache. Reuse the function emitted for the first type with this
+  // layout instead of emitting an identical copy per type. Dependent layouts
+  // bind type-specific metadata and are excluded, as are noncopyable types,
+  // whose destruction is not a pure function of the layout.
+  const TypeLayoutEntry *layoutKey = nullptr;
+  if (valueWitnessDependsOnlyOnLayout(index) &&
+      type.isCopyable(ResilienceExpansion::Maximal)) {
+    if (auto *entry = conditionallyGetTypeLayoutEntry(*this, concreteType))
+      if (entry->isFixedSize(*this))
+        layoutKey = entry;
+  }
+  if (layoutKey) {
+    auto cached =
+        LayoutUniquedValueWitnesses.find({layoutKey, unsigned(index)});
+    if (cached != LayoutUniquedValueWitnesses.end())
+      return cached->second;
+  }
+
   llvm::Function *fn =
       getAddrOfValueWitness(abstractType, index, ForDefinition);
   if (fn->empty())
   buildValueWitnessFunction(*this, fn, index, packing, abstractType,
                             concreteType, type);
+  if (layoutKey)
+    LayoutUniquedValueWitnesses.insert({{layoutKey, unsigned(index)}, fn});
   return fn;
  }
 
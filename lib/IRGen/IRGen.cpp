@@ -1531,10 +1531,27 @@ static void performParallelIRGeneration(IRGenDescriptor desc) {
     }
   }
 
-  for (auto it = irgen.begin(); it != irgen.end(); ++it) {
-    IRGenModule *IGM = it->second;
+  // Bail out if there are any errors.
+  if (Ctx.hadError()) return;
+
+  FrontendStatsTracer tracer(Ctx.Stats, "LLVM pipeline");
+
+  llvm::sys::Mutex DiagMutex;
+
+  // Hand out the most expensive modules first so the threads stay
+  // balanced when module sizes are skewed.
+  irgen.sortQueueByEstimatedCost();
+
+  // Start the codegen threads now. Each module is published to the queue as
+  // soon as it has been finalized below, so LLVM optimization and codegen of
+  // finished modules overlap finalization of the rest.
+
+  LLVMCodeGenThreads codeGenThreads(&irgen, &DiagMutex, Opts.NumThreads - 1);
+  codeGenThreads.startThreads();
+
+  for (IRGenModule *IGM : irgen.getQueue()) {
     llvm::Module *M = IGM->getModule();
-    
+
     // Update the linkage of shared functions/globals.
     // If a shared function/global is referenced from another file it must have
     // weak instead of linkonce linkage. Otherwise LLVM would remove the
@@ -1556,23 +1573,24 @@ static void performParallelIRGeneration(IRGenDescriptor desc) {
       updateLinkage(A);
     }
 
-    if (!IGM->finalize())
+    // Hold the diagnostic mutex during finalization: the codegen threads are
+    // already running and take it before emitting any diagnostics of their
+    // own.
+    bool finalized;
+    {
+      llvm::sys::ScopedLock lock(DiagMutex);
+      finalized = IGM->finalize() && !Ctx.hadError();
+    }
+    if (!finalized) {
+      irgen.closeQueue();
+      codeGenThreads.join();
       return;
+    }
 
     setModuleFlags(*IGM);
-  }
 
-  // Bail out if there are any errors.
-  if (Ctx.hadError()) return;
-
-  FrontendStatsTracer tracer(Ctx.Stats, "LLVM pipeline");
-
-  llvm::sys::Mutex DiagMutex;
-
-  // Start all the threads and do the LLVM compilation.
-
-  LLVMCodeGenThreads codeGenThreads(&irgen, &DiagMutex, Opts.NumThreads - 1);
-  codeGenThreads.startThreads();
+    irgen.markNextQueueEntryReady();
+  }
 
   // Free the memory occupied by the SILModule.
   // Execute this task in parallel to the LLVM compilation.
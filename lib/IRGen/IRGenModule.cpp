@@ -2180,6 +2180,66 @@ void IRGenerator::addGenModule(SourceFile *SF, IRGenModule *IGM) {
   Queue.push_back(IGM);
 }
 
+void IRGenerator::sortQueueByEstimatedCost() {
+  // Estimate per-module code generation cost by the number of global
+  // definitions and function basic blocks already emitted into the
+  // llvm::Module.
+  llvm::SmallVector<std::pair<size_t, IRGenModule *>, 8> costs;
+  costs.reserve(Queue.size());
+  for (IRGenModule *IGM : Queue) {
+    llvm::Module *M = IGM->getModule();
+    size_t cost = M->global_size();
+    for (llvm::Function &F : *M)
+      cost += 1 + F.size();
+    costs.push_back({cost, IGM});
+  }
+
+  // Longest-processing-time-first: handing out the largest modules first
+  // keeps the code generation threads balanced when module sizes are
+  // skewed. The sort is stable so equally-sized modules keep their
+  // deterministic source order.
+  llvm::stable_sort(costs, [](const std::pair<size_t, IRGenModule *> &lhs,
+                              const std::pair<size_t, IRGenModule *> &rhs) {
+    return lhs.first > rhs.first;
+  });
+
+  Queue.clear();
+  for (const auto &entry : costs)
+    Queue.push_back(entry.second);
+}
+
+void IRGenerator::markNextQueueEntryReady() {
+  {
+    std::lock_guard<std::mutex> lock(QueueMutex);
+    ++ReadyIndex;
+  }
+  QueueReadyCondition.notify_all();
+}
+
+void IRGenerator::closeQueue() {
+  {
+    std::lock_guard<std::mutex> lock(QueueMutex);
+    QueueClosed = true;
+  }
+  QueueReadyCondition.notify_all();
+}
+
+IRGenModule *IRGenerator::fetchFromQueue() {
+  int idx = QueueIndex++;
+  if (idx >= (int)Queue.size())
+    return nullptr;
+
+  // Wait until the module has been finalized and published by the main
+  // thread, so LLVM optimization of ready modules overlaps finalization of
+  // the rest.
+  std::unique_lock<std::mutex> lock(QueueMutex);
+  QueueReadyCondition.wait(
+      lock, [&] { return ReadyIndex > idx || QueueClosed; });
+  if (idx >= ReadyIndex)
+    return nullptr;
+  return Queue[idx];
+}
+
 IRGenModule *IRGenerator::getGenModule(SourceFile *SF) {
   // If we're emitting for a single module, or a single file, we always use the
   // primary IGM.
@@ -53,6 +53,8 @@
 #include "llvm/Target/TargetMachine.h"
 
 #include <atomic>
+#include <condition_variable>
+#include <mutex>
 
 namespace llvm {
   class Constant;
@@ -350,9 +352,21 @@ private:
 
   /// The queue of IRGenModules for multi-threaded compilation.
   SmallVector<IRGenModule *, 8> Queue;
-  
+
   std::atomic<int> QueueIndex;
-  
+
+  /// Guards \c ReadyIndex and \c QueueClosed in multi-threaded compilation.
+  std::mutex QueueMutex;
+  std::condition_variable QueueReadyCondition;
+
+  /// The number of modules at the front of the queue that have been
+  /// finalized and may be handed out to the LLVM codegen threads.
+  int ReadyIndex = 0;
+
+  /// True once no further queue entries will become ready, e.g. because
+  /// finalizing a module failed.
+  bool QueueClosed = false;
+
   friend class CurrentIGMPtr;
 public:
   explicit IRGenerator(const IRGenOptions &opts, SILModule &module);
@@ -496,6 +510,11 @@ public:
       IRGenModule &IGM, CanType theType, TypeMetadataCanonicality canonicality);
   void noteUseOfCanonicalSpecializedMetadataAccessor(CanType forType);
 
+  /// Note uses of the generic type specializations whose mangled names are
+  /// listed in the file given by \c -prespecialize-generic-metadata-list= so
+  /// that prespecialized metadata records are emitted for them.
+  void noteUsesOfSpecializedGenericTypeMetadataFromList();
+
   void noteUseOfTypeMetadata(CanType type) {
     type.visit([&](Type t) {
       if (auto *nominal = t->getAnyNominal())
@@ -542,14 +561,26 @@ public:
     return it->second;
   }
   
-  /// In multi-threaded compilation fetch the next IRGenModule from the queue.
-  IRGenModule *fetchFromQueue() {
-    int idx = QueueIndex++;
-    if (idx < (int)Queue.size()) {
-      return Queue[idx];
-    }
-    return nullptr;
-  }
+  /// Sort the multi-threaded compilation queue so that the most expensive
+  /// modules are fetched first. Queue order only affects which thread
+  /// processes which module, not the contents of any output.
+  void sortQueueByEstimatedCost();
+
+  /// The modules in multi-threaded compilation queue order.
+  ArrayRef<IRGenModule *> getQueue() const { return Queue; }
+
+  /// Mark the next module in the queue as finalized, making it available
+  /// to the LLVM codegen threads. Modules become ready in queue order.
+  void markNextQueueEntryReady();
+
+  /// Stop handing out queue entries, waking any codegen threads that are
+  /// waiting for a module to become ready. Used when finalization fails.
+  void closeQueue();
+
+  /// In multi-threaded compilation fetch the next IRGenModule from the
+  /// queue, waiting if necessary until it has been marked ready. Returns
+  /// null when the queue is exhausted or has been closed.
+  IRGenModule *fetchFromQueue();
 
   /// Return the effective triple used by clang.
   llvm::Triple getEffectiveClangTriple();
@@ -687,6 +718,12 @@ public:
 
   TypeLayoutCache typeLayoutCache;
 
+  /// Value witness functions that were emitted from a uniqued type layout
+  /// entry, keyed by that entry and the witness kind so that layout-identical
+  /// types share a single definition.
+  llvm::DenseMap<std::pair<const TypeLayoutEntry *, unsigned>, llvm::Function *>
+      LayoutUniquedValueWitnesses;
+
   /// Does the current target require Objective-C interoperation?
   bool ObjCInterop = true;
 
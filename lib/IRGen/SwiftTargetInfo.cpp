@@ -41,6 +41,10 @@ static void configureARM64(IRGenModule &IGM, const llvm::Triple &triple,
               SWIFT_ABI_ANDROID_ARM64_SWIFT_SPARE_BITS_MASK);
     setToMask(target.ObjCPointerReservedBits, 64,
               SWIFT_ABI_ANDROID_ARM64_OBJC_RESERVED_BITS_MASK);
+    // Android AArch64 reserves the top byte for its own pointer tagging, so
+    // the BridgeObject tag lives one byte lower there.
+    setToMask(target.BridgeObjectTagBits, 64,
+              SWIFT_ABI_DEFAULT_BRIDGEOBJECT_TAG_64 >> 8);
   } else {
     setToMask(target.PointerSpareBits, 64,
               SWIFT_ABI_ARM64_SWIFT_SPARE_BITS_MASK);
@@ -198,9 +202,12 @@ SwiftTargetInfo::SwiftTargetInfo(
   setToMask(FunctionPointerSpareBits, numPointerBits,
             SWIFT_ABI_DEFAULT_FUNCTION_SPARE_BITS_MASK);
   if (numPointerBits == 64) {
+    setToMask(BridgeObjectTagBits, 64, SWIFT_ABI_DEFAULT_BRIDGEOBJECT_TAG_64);
     ReferencePoisonDebugValue =
       SWIFT_ABI_DEFAULT_REFERENCE_POISON_DEBUG_VALUE_64;
   } else {
+    setToMask(BridgeObjectTagBits, numPointerBits,
+              SWIFT_ABI_DEFAULT_BRIDGEOBJECT_TAG_32);
     ReferencePoisonDebugValue =
       SWIFT_ABI_DEFAULT_REFERENCE_POISON_DEBUG_VALUE_32;
   }
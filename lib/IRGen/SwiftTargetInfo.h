@@ -75,6 +75,12 @@ public:
   /// an Objective-C object.
   SpareBitVector IsObjCPointerBit;
 
+  /// These bits, if set, indicate that a Builtin.BridgeObject value is holding
+  /// a tagged value (such as a small string) instead of a reference-counted
+  /// object. This must stay in sync with _swift_BridgeObject_TaggedPointerBits
+  /// in the runtime.
+  SpareBitVector BridgeObjectTagBits;
+
 
   /// The alignment of heap objects.  By default, assume pointer alignment.
   Alignment HeapObjectAlignment;
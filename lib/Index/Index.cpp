@@ -451,6 +451,10 @@ class IndexSwiftASTWalker : public SourceEntityWalker {
     StringRef USR;
     StringRef name;
   };
+  /// Discriminators for display names interned on the ASTContext, so names
+  /// printed here do not collide with other clients' formatting. Accessor
+  /// names are keyed by their AccessorKind, offset past DisplayName.
+  enum : unsigned { PrintedNameDisplay = 0, PrintedNameAccessorFirst = 1 };
   typedef llvm::PointerIntPair<Decl *, 3> DeclAccessorPair;
   llvm::DenseMap<void *, NameAndUSR> nameAndUSRCache;
   llvm::DenseMap<DeclAccessorPair, NameAndUSR> accessorNameAndUSRCache;
@@ -482,12 +486,11 @@ class IndexSwiftASTWalker : public SourceEntityWalker {
         result.USR = stringStorage.copyString(OS.str());
       }
 
-      storage.clear();
-      {
-        llvm::raw_svector_ostream OS(storage);
-        printDisplayName(D, OS);
-        result.name = stringStorage.copyString(OS.str());
-      }
+      // Display names use fixed formatting, so intern them on the ASTContext
+      // where they are shared by every file indexed in this compilation.
+      result.name = D->getASTContext().getOrCachePrintedName(
+          D, PrintedNameDisplay,
+          [&](llvm::raw_ostream &OS) { printDisplayName(D, OS); });
     }
 
     name = result.name;
@@ -530,12 +533,9 @@ class IndexSwiftASTWalker : public SourceEntityWalker {
         result.USR = stringStorage.copyString(OS.str());
       }
 
-      storage.clear();
-      {
-        llvm::raw_svector_ostream OS(storage);
-        printArtificialName(D, AK, OS);
-        result.name = stringStorage.copyString(OS.str());
-      }
+      result.name = D->getASTContext().getOrCachePrintedName(
+          D, PrintedNameAccessorFirst + static_cast<unsigned>(AK),
+          [&](llvm::raw_ostream &OS) { printArtificialName(D, AK, OS); });
     }
 
     Name = result.name;
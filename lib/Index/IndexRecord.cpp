@@ -35,6 +35,7 @@
 #include "clang/Index/IndexingAction.h"
 #include "clang/Lex/Preprocessor.h"
 #include "clang/Serialization/ASTReader.h"
+#include "llvm/ADT/StringSet.h"
 #include "llvm/Support/Path.h"
 
 using namespace swift;
@@ -397,6 +398,7 @@ emitDataForSwiftSerializedModule(ModuleDecl *module,
                                  DiagnosticEngine &diags,
                                  IndexUnitWriter &parentUnitWriter,
                                  const PathRemapper &pathRemapper,
+                                 llvm::StringSet<> &handledModuleUnits,
                                  SourceFile *initialFile);
 
 static void
@@ -602,6 +604,7 @@ static void addModuleDependencies(ArrayRef<ImportedModule> imports,
                                   IndexUnitWriter &unitWriter,
                                   StringScratchSpace &moduleNameScratch,
                                   const PathRemapper &pathRemapper,
+                                  llvm::StringSet<> &handledModuleUnits,
                                   SourceFile *initialFile = nullptr) {
   auto &fileMgr = clangCI.getFileManager();
 
@@ -678,6 +681,7 @@ static void addModuleDependencies(ArrayRef<ImportedModule> imports,
                                              clangCI, diags,
                                              unitWriter,
                                              pathRemapper,
+                                             handledModuleUnits,
                                              initialFile);
             withoutUnitName = false;
           }
@@ -725,10 +729,17 @@ emitDataForSwiftSerializedModule(ModuleDecl *module,
                                  DiagnosticEngine &diags,
                                  IndexUnitWriter &parentUnitWriter,
                                  const PathRemapper &pathRemapper,
+                                 llvm::StringSet<> &handledModuleUnits,
                                  SourceFile *initialFile) {
   StringRef filename = module->getModuleSourceFilename();
   std::string moduleName = module->getNameStr().str();
 
+  // Many units within one compilation import the same serialized modules.
+  // Once a module's unit has been emitted or verified up-to-date, later
+  // importers can skip the filesystem checks entirely.
+  if (!handledModuleUnits.insert(filename).second)
+    return false;
+
   // If this is a cross-import overlay, make sure we use the name of the
   // underlying module instead.
   if (ModuleDecl *declaring = module->getDeclaringModuleIfCrossImportOverlay())
@@ -872,7 +883,8 @@ emitDataForSwiftSerializedModule(ModuleDecl *module,
                         indexSystemModules, skipStdlib, includeLocals,
                         explicitModuleBuild,
                         targetTriple, clangCI, diags, unitWriter,
-                        moduleNameScratch, pathRemapper, initialFile);
+                        moduleNameScratch, pathRemapper, handledModuleUnits,
+                        initialFile);
 
   if (unitWriter.write(error)) {
     diags.diagnose(SourceLoc(), diag::error_write_index_unit, error);
@@ -891,7 +903,8 @@ recordSourceFileUnit(SourceFile *primarySourceFile, StringRef indexUnitToken,
                      ArrayRef<const clang::FileEntry *> fileDependencies,
                      const clang::CompilerInstance &clangCI,
                      const PathRemapper &pathRemapper,
-                     DiagnosticEngine &diags) {
+                     DiagnosticEngine &diags,
+                     llvm::StringSet<> &handledModuleUnits) {
   auto &fileMgr = clangCI.getFileManager();
   auto *module = primarySourceFile->getParentModule();
   bool isSystem = module->isNonUserModule();
@@ -915,7 +928,7 @@ recordSourceFileUnit(SourceFile *primarySourceFile, StringRef indexUnitToken,
                         indexSystemModules, skipStdlib, includeLocals,
                         isExplicitModuleBuild, targetTriple, clangCI, diags,
                         unitWriter, moduleNameScratch, pathRemapper,
-                        primarySourceFile);
+                        handledModuleUnits, primarySourceFile);
 
   // File dependencies.
   for (auto *F : fileDependencies)
@@ -997,12 +1010,14 @@ bool index::indexAndRecord(SourceFile *primarySourceFile,
   collectFileDependencies(fileDependencies, dependencyTracker, module, fileMgr);
 #endif
 
+  llvm::StringSet<> handledModuleUnits;
   return recordSourceFileUnit(primarySourceFile, indexUnitToken,
                               indexStorePath, indexClangModules,
                               indexSystemModules, skipStdlib, includeLocals,
                               isDebugCompilation, isExplicitModuleBuild,
                               targetTriple, fileDependencies.getArrayRef(),
-                              clangCI, pathRemapper, diags);
+                              clangCI, pathRemapper, diags,
+                              handledModuleUnits);
 }
 
 bool index::indexAndRecord(ModuleDecl *module,
@@ -1042,6 +1057,7 @@ bool index::indexAndRecord(ModuleDecl *module,
 #endif
 
   // Write a unit for each source file.
+  llvm::StringSet<> handledModuleUnits;
   unsigned unitIndex = 0;
   for (auto *F : module->getFiles()) {
     if (auto *SF = dyn_cast<SourceFile>(F)) {
@@ -1054,7 +1070,8 @@ bool index::indexAndRecord(ModuleDecl *module,
                                indexSystemModules, skipStdlib, includeLocals,
                                isDebugCompilation, isExplicitModuleBuild,
                                targetTriple, fileDependencies.getArrayRef(),
-                               clangCI, pathRemapper, diags))
+                               clangCI, pathRemapper, diags,
+                               handledModuleUnits))
         return true;
       unitIndex += 1;
     }
@@ -32,6 +32,7 @@
 // FIXME: Figure out if this can be migrated to LLVM.
 #include "clang/Basic/CharInfo.h"
 
+#include <cstring>
 #include <limits>
 
 using namespace swift;
@@ -368,12 +369,50 @@ static void diagnoseEmbeddedNul(DiagnosticEngine *Diags, const char *Ptr) {
       .fixItRemoveChars(NulLoc, NulEndLoc);
 }
 
+/// Word-at-a-time scanning helpers used to skip runs of plain ASCII in
+/// the hot comment- and line-skipping loops below. The bit tricks are the
+/// classic SWAR zero-byte test: a byte in \p word is zero iff the
+/// corresponding high bit survives \c (word - 0x01..) & ~word & 0x80..
+static const uint64_t SWARLowBits = 0x0101010101010101ULL;
+static const uint64_t SWARHighBits = 0x8080808080808080ULL;
+
+/// Return non-zero if any byte in \p word is zero.
+static inline uint64_t wordHasZeroByte(uint64_t word) {
+  return (word - SWARLowBits) & ~word & SWARHighBits;
+}
+
+/// Return non-zero if any byte in \p word equals \p c.
+static inline uint64_t wordHasByte(uint64_t word, char c) {
+  return wordHasZeroByte(word ^ (SWARLowBits * (unsigned char)c));
+}
+
+/// Load the next 8 bytes at \p CurPtr, returning false if fewer than 8
+/// bytes remain before \p BufferEnd.
+static inline bool loadScanWord(const char *CurPtr, const char *BufferEnd,
+                                uint64_t &word) {
+  if (BufferEnd - CurPtr < 8)
+    return false;
+  memcpy(&word, CurPtr, 8);
+  return true;
+}
+
 /// Advance \p CurPtr to the end of line or the end of file. Returns \c true
 /// if it stopped at the end of line, \c false if it stopped at the end of file.
 static bool advanceToEndOfLine(const char *&CurPtr, const char *BufferEnd,
                                const char *CodeCompletionPtr = nullptr,
                                DiagnosticEngine *Diags = nullptr) {
   while (1) {
+    // Eat plain ASCII a word at a time until we see a newline, a NUL, or a
+    // byte that could start a multi-byte UTF-8 sequence. When we aren't
+    // diagnosing invalid UTF-8, high bytes are eaten by the slow path's
+    // default case anyway, so they don't need to stop the fast path.
+    uint64_t word;
+    while (loadScanWord(CurPtr, BufferEnd, word) &&
+           !((Diags && (word & SWARHighBits)) || wordHasZeroByte(word) ||
+             wordHasByte(word, '\n') || wordHasByte(word, '\r'))) {
+      CurPtr += 8;
+    }
+
     switch (*CurPtr++) {
     case '\n':
     case '\r':
@@ -440,6 +479,17 @@ static bool skipToEndOfSlashStarComment(const char *&CurPtr,
   bool isMultiline = false;
 
   while (1) {
+    // Eat plain ASCII a word at a time until we see a character that could
+    // open or close a comment, a newline, a NUL, or (when diagnosing
+    // invalid UTF-8) a byte that could start a multi-byte sequence.
+    uint64_t word;
+    while (loadScanWord(CurPtr, BufferEnd, word) &&
+           !((Diags && (word & SWARHighBits)) || wordHasZeroByte(word) ||
+             wordHasByte(word, '*') || wordHasByte(word, '/') ||
+             wordHasByte(word, '\n') || wordHasByte(word, '\r'))) {
+      CurPtr += 8;
+    }
+
     switch (*CurPtr++) {
     case '*':
       // Check for a '*/'
@@ -658,7 +708,20 @@ void Lexer::lexIdentifier() {
   (void) didStart;
 
   // Lex [a-zA-Z_$0-9[[:XID_Continue:]]]*
-  while (advanceIfValidContinuationOfIdentifier(CurPtr, BufferEnd));
+  while (CurPtr < BufferEnd) {
+    // Almost all identifier characters in practice are ASCII; consume runs
+    // of them directly instead of paying for UTF-8 validation and an
+    // indirect predicate call per character.
+    unsigned char c = *CurPtr;
+    if (LLVM_LIKELY(c < 0x80)) {
+      if (!clang::isAsciiIdentifierContinue(c, /*dollar*/ true))
+        break;
+      ++CurPtr;
+      continue;
+    }
+    if (!advanceIfValidContinuationOfIdentifier(CurPtr, BufferEnd))
+      break;
+  }
 
   tok Kind = kindOfIdentifier(StringRef(TokStart, CurPtr-TokStart),
                               LexMode == LexerMode::SIL);
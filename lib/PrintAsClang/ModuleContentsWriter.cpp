@@ -649,16 +649,40 @@ public:
       decls.append(nestedAdds);
     }
 
+    // Memoize the mangled-name sort key. It is by far the most expensive key
+    // to compute and an O(n log n) sort revisits the same decl many times, so
+    // share one mangler and mangle each decl at most once.
+    Mangle::ASTMangler mangler;
+    llvm::DenseMap<const Decl *, std::string> mangledNames;
+    auto getMangledName = [&](const Decl *D) -> std::string {
+      const ValueDecl *VD = dyn_cast<ValueDecl>(D);
+      if (!VD && isa<ExtensionDecl>(D))
+        VD = cast<ExtensionDecl>(D)->getExtendedNominal();
+      if (!VD)
+        return std::string();
+      auto known = mangledNames.find(D);
+      if (known == mangledNames.end()) {
+        known = mangledNames
+                    .insert({D, mangler.mangleAnyDecl(
+                                    VD, /*prefix=*/true,
+                                    /*respectOriginallyDefinedIn=*/true)})
+                    .first;
+      }
+      return known->second;
+    };
+
     // REVERSE sort the decls, since we are going to copy them onto a stack.
-    llvm::array_pod_sort(decls.begin(), decls.end(),
-                         [](Decl * const *lhs, Decl * const *rhs) -> int {
+    auto compareDecls = [&](Decl *const *lhs, Decl *const *rhs) -> int {
       enum : int {
         Ascending = -1,
         Equivalent = 0,
         Descending = 1,
       };
 
-      assert(*lhs != *rhs && "duplicate top-level decl");
+      // Unlike array_pod_sort, std::sort is permitted to compare an element
+      // against itself.
+      if (*lhs == *rhs)
+        return Equivalent;
 
       auto getSortName = [](const Decl *D) -> StringRef {
         if (auto VD = dyn_cast<ValueDecl>(D))
@@ -725,19 +749,6 @@ public:
       // Last-ditch ValueDecl tiebreaker: Compare mangled names. This captures
       // *tons* of context and detail missed by the previous checks, but the
       // resulting sort makes little sense to humans.
-      // FIXME: It'd be nice to share the mangler or even memoize mangled names,
-      //        but we'd have to stop using `llvm::array_pod_sort()` so that we
-      //        could capture some outside state.
-      Mangle::ASTMangler mangler;
-      auto getMangledName = [&](const Decl *D) {
-        auto VD = dyn_cast<ValueDecl>(D);
-        if (!VD && isa<ExtensionDecl>(D))
-          VD = cast<ExtensionDecl>(D)->getExtendedNominal();
-        if (!VD)
-          return std::string();
-        return mangler.mangleAnyDecl(VD, /*prefix=*/true,
-                                     /*respectOriginallyDefinedIn=*/true);
-      };
       result = getMangledName(*rhs).compare(getMangledName(*lhs));
       if (result != 0)
         return result;
@@ -808,6 +819,9 @@ public:
       // Hopefully two extensions with identical conformances and member names
       // will be interchangeable enough not to matter.
       return Equivalent;
+    };
+    llvm::sort(decls, [&](Decl *lhs, Decl *rhs) {
+      return compareDecls(&lhs, &rhs) < 0;
     });
 
     assert(declsToWrite.empty());
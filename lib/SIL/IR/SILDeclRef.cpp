@@ -316,10 +316,24 @@ bool SILDeclRef::hasUserWrittenCode() const {
     case Kind::PropertyWrapperInitFromProjectedValue:
       // Never has user-written code, is just a forwarding initializer.
       return false;
-    default:
-      // TODO: This checking is currently conservative, we ought to
-      // exhaustively handle all the cases here, and use emitOrDelayFunction
-      // in more cases to take advantage of it.
+    case Kind::EnumElement:
+    case Kind::GlobalAccessor:
+    case Kind::IVarInitializer:
+    case Kind::IVarDestroyer:
+      // These entry points have fully synthesized bodies even when the
+      // anchoring declaration was written by the user; any user-written
+      // initialization code is spliced into a separate function.
+      return false;
+    case Kind::Func:
+    case Kind::Allocator:
+    case Kind::Initializer:
+    case Kind::Destroyer:
+    case Kind::Deallocator:
+    case Kind::DefaultArgGenerator:
+    case Kind::StoredPropertyInitializer:
+    case Kind::EntryPoint:
+    case Kind::AsyncEntryPoint:
+      // These contain (or splice in) code the user wrote.
       return true;
     }
     llvm_unreachable("Unhandled case in switch!");
@@ -278,18 +278,21 @@ RegularLocation::RegularLocation(Decl *D, SILLocation LocForDebugging,
 RegularLocation::RegularLocation(Stmt *S, Pattern *P, SILModule &Module)
   : SILLocation(new(Module) ExtendedASTNodeLoc({S, 0}, {P, 0}), RegularKind) {}
 
+// Debug-only and diagnostic-only locations are created in bulk by optimizer
+// utilities, and are never mutated in place (unlike locations that may be
+// adjusted with pointToEnd()), so their nodes are uniqued in the module.
 SILLocation::ExtendedASTNodeLoc *
 RegularLocation::getDebugOnlyExtendedASTNodeLoc(SILLocation L,
                                                 SILModule &Module) {
   ASTNodeTy Empty({(Decl *)nullptr, 0});
   if (auto D = L.getAsASTNode<Decl>())
-    return new (Module) ExtendedASTNodeLoc(Empty, {D, 0});
+    return Module.getOrCreateExtendedASTNodeLoc(Empty, {D, 0});
   if (auto E = L.getAsASTNode<Expr>())
-    return new (Module) ExtendedASTNodeLoc(Empty, {E, 0});
+    return Module.getOrCreateExtendedASTNodeLoc(Empty, {E, 0});
   if (auto S = L.getAsASTNode<Stmt>())
-    return new (Module) ExtendedASTNodeLoc(Empty, {S, 0});
+    return Module.getOrCreateExtendedASTNodeLoc(Empty, {S, 0});
   auto P = L.getAsASTNode<Pattern>();
-  return new (Module) ExtendedASTNodeLoc(Empty, {P, 0});
+  return Module.getOrCreateExtendedASTNodeLoc(Empty, {P, 0});
 }
 
 SILLocation::ExtendedASTNodeLoc *
@@ -297,13 +300,13 @@ RegularLocation::getDiagnosticOnlyExtendedASTNodeLoc(SILLocation L,
                                                      SILModule &Module) {
   ASTNodeTy Empty({(Decl *)nullptr, 0});
   if (auto D = L.getAsASTNode<Decl>())
-    return new (Module) ExtendedASTNodeLoc({D, 0}, Empty);
+    return Module.getOrCreateExtendedASTNodeLoc({D, 0}, Empty);
   if (auto E = L.getAsASTNode<Expr>())
-    return new (Module) ExtendedASTNodeLoc({E, 0}, Empty);
+    return Module.getOrCreateExtendedASTNodeLoc({E, 0}, Empty);
   if (auto S = L.getAsASTNode<Stmt>())
-    return new (Module) ExtendedASTNodeLoc({S, 0}, Empty);
+    return Module.getOrCreateExtendedASTNodeLoc({S, 0}, Empty);
   auto P = L.getAsASTNode<Pattern>();
-  return new (Module) ExtendedASTNodeLoc({P, 0}, Empty);
+  return Module.getOrCreateExtendedASTNodeLoc({P, 0}, Empty);
 }
 
 RegularLocation::RegularLocation(SILLocation ForDebuggingOrDiagnosticsOnly,
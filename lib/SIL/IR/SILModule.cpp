@@ -756,6 +756,17 @@ unsigned SILModule::getCaseIndex(EnumElementDecl *enumElement) {
   llvm_unreachable("enum element not found in enum decl");
 }
 
+SILLocation::ExtendedASTNodeLoc *
+SILModule::getOrCreateExtendedASTNodeLoc(SILLocation::ASTNodeTy primary,
+                                         SILLocation::ASTNodeTy forDebugging) {
+  auto key = std::make_pair(primary.getOpaqueValue(),
+                            forDebugging.getOpaqueValue());
+  auto &entry = ExtendedASTNodeLocs[key];
+  if (!entry)
+    entry = new (*this) SILLocation::ExtendedASTNodeLoc(primary, forDebugging);
+  return entry;
+}
+
 void SILModule::notifyAddedInstruction(SILInstruction *inst) {
   inst->forEachDefinedLocalArchetype([&](CanLocalArchetypeType archeTy,
                                          SILValue dependency) {
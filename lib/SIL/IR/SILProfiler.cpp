@@ -153,7 +153,8 @@ SILProfiler *SILProfiler::create(SILModule &M, SILDeclRef Ref) {
     return nullptr;
 
   auto *Buf = M.allocate<SILProfiler>(1);
-  auto *SP = ::new (Buf) SILProfiler(M, Ref, Opts.EmitProfileCoverageMapping);
+  auto *SP = ::new (Buf) SILProfiler(M, Ref, Opts.EmitProfileCoverageMapping,
+                                     Opts.EmitSparseProfileCounters);
   SP->assignRegionCounters();
   return SP;
 }
@@ -1764,6 +1765,19 @@ std::optional<ASTNode> SILProfiler::getPGOParent(ASTNode Node) {
   return it->getSecond();
 }
 
+bool SILProfiler::shouldEmitIncrementFor(ProfileCounterRef ref) {
+  if (!SparseCounters)
+    return true;
+
+  // Error branches model the rarely-taken paths whose counts we want to keep.
+  if (ref.getKind() == ProfileCounterRef::Kind::ErrorBranch)
+    return true;
+
+  // The root of the profiled node is visited first by MapRegionCounters, so
+  // the function entry counter is always the first one assigned.
+  return getCounterIndexFor(ref) == 0;
+}
+
 unsigned SILProfiler::getCounterIndexFor(ProfileCounterRef ref) {
   auto result = RegionCounterMap.find(ref);
   assert(result != RegionCounterMap.end());
@@ -1713,6 +1713,37 @@ bool SILParser::parseSILBBArgsAtBranch(SmallVector<SILValue, 6> &Args,
   return false;
 }
 
+bool SILParser::parseSILBranchProfileCounts(ProfileCounter &TrueCount,
+                                            ProfileCounter &FalseCount) {
+  while (P.Tok.is(tok::sil_exclamation)) {
+    P.consumeToken(tok::sil_exclamation);
+
+    bool IsTrueCount;
+    if (P.Tok.is(tok::identifier) && P.Tok.getText() == "true_count") {
+      IsTrueCount = true;
+    } else if (P.Tok.is(tok::identifier) && P.Tok.getText() == "false_count") {
+      IsTrueCount = false;
+    } else {
+      P.diagnose(P.Tok, diag::expected_tok_in_sil_instr,
+                 "true_count or false_count");
+      return true;
+    }
+    P.consumeToken(tok::identifier);
+
+    uint64_t Count;
+    if (P.parseToken(tok::l_paren, diag::expected_tok_in_sil_instr, "(") ||
+        parseInteger(Count, diag::expected_sil_branch_profile_count) ||
+        P.parseToken(tok::r_paren, diag::expected_tok_in_sil_instr, ")"))
+      return true;
+
+    if (IsTrueCount)
+      TrueCount = ProfileCounter(Count);
+    else
+      FalseCount = ProfileCounter(Count);
+  }
+  return false;
+}
+
 /// Parse the substitution list for an apply instruction or
 /// specialized protocol conformance.
 bool SILParser::parseSubstitutions(SmallVectorImpl<ParsedSubstitution> &parsed,
@@ -5359,6 +5390,7 @@ bool SILParser::parseSpecificSILInstruction(SILBuilder &B,
       Identifier BBName, BBName2;
       SourceLoc NameLoc, NameLoc2;
       SmallVector<SILValue, 6> Args, Args2;
+      ProfileCounter TrueCount, FalseCount;
       if (parseValueName(Cond) ||
           P.parseToken(tok::comma, diag::expected_tok_in_sil_instr, ",") ||
           parseSILIdentifier(BBName, NameLoc, diag::expected_sil_block_name) ||
@@ -5366,14 +5398,16 @@ bool SILParser::parseSpecificSILInstruction(SILBuilder &B,
           P.parseToken(tok::comma, diag::expected_tok_in_sil_instr, ",") ||
           parseSILIdentifier(BBName2, NameLoc2,
                              diag::expected_sil_block_name) ||
-          parseSILBBArgsAtBranch(Args2, B) || parseSILDebugLocation(InstLoc, B))
+          parseSILBBArgsAtBranch(Args2, B) ||
+          parseSILBranchProfileCounts(TrueCount, FalseCount) ||
+          parseSILDebugLocation(InstLoc, B))
         return true;
 
       auto I1Ty = SILType::getBuiltinIntegerType(1, SILMod.getASTContext());
       SILValue CondVal = getLocalValue(Cond, I1Ty, InstLoc, B);
       ResultVal = B.createCondBranch(
           InstLoc, CondVal, getBBForReference(BBName, NameLoc), Args,
-          getBBForReference(BBName2, NameLoc2), Args2);
+          getBBForReference(BBName2, NameLoc2), Args2, TrueCount, FalseCount);
       break;
     }
     case SILInstructionKind::UnreachableInst:
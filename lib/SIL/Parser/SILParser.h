@@ -331,6 +331,11 @@ public:
   /// Parses the basic block arguments as part of branch instruction.
   bool parseSILBBArgsAtBranch(SmallVector<SILValue, 6> &Args, SILBuilder &B);
 
+  /// Parses the optional '!true_count(...)' and '!false_count(...)'
+  /// annotations carrying PGO edge counts on a cond_br instruction.
+  bool parseSILBranchProfileCounts(ProfileCounter &TrueCount,
+                                   ProfileCounter &FalseCount);
+
   bool parseSILLocation(SILLocation &L);
   bool parseScopeRef(SILDebugScope *&DS);
   bool parseForwardingOwnershipKind(ValueOwnershipKind &forwardingKind);
@@ -12,6 +12,7 @@
 
 #include "swift/SIL/CalleeCache.h"
 #include "swift/SIL/SILModule.h"
+#include "swift/AST/Module.h"
 #include "swift/AST/ProtocolConformance.h"
 #include "swift/Basic/Assertions.h"
 #include "llvm/Support/Compiler.h"
@@ -33,8 +34,10 @@ bool swift::calleesAreStaticallyKnowable(SILModule &module, SILDeclRef decl) {
 bool swift::calleesAreStaticallyKnowable(SILModule &module, ValueDecl *vd) {
   assert(isa<AbstractFunctionDecl>(vd) || isa<EnumElementDecl>(vd));
 
-  // Only handle members defined within the SILModule's associated context.
-  if (!cast<DeclContext>(vd)->isChildContextOf(module.getAssociatedContext()))
+  // Only handle members defined within the SILModule's associated context,
+  // unless they come from a co-built module of the same package.
+  if (!cast<DeclContext>(vd)->isChildContextOf(module.getAssociatedContext()) &&
+      !isDeclInCoBuiltPackageModule(module, vd))
     return false;
 
   if (vd->isDynamic()) {
@@ -69,6 +72,21 @@ bool swift::calleesAreStaticallyKnowable(SILModule &module, ValueDecl *vd) {
   llvm_unreachable("Unhandled access level in switch.");
 }
 
+bool swift::isDeclInCoBuiltPackageModule(SILModule &module,
+                                         const ValueDecl *vd) {
+  if (!module.getOptions().EnablePackageWideDevirtualization)
+    return false;
+
+  auto *defModule = vd->getModuleContext();
+  if (defModule == module.getSwiftModule() ||
+      !module.getSwiftModule()->inSamePackage(defModule))
+    return false;
+
+  // Without serialized package SIL the v-tables of the defining module are
+  // not visible, so overrides declared there could be missed.
+  return defModule->serializePackageEnabled();
+}
+
 void CalleeList::dump() const {
   print(llvm::errs());
 }
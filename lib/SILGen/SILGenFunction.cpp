@@ -1676,6 +1676,11 @@ void SILGenFunction::emitProfilerIncrement(ProfileCounterRef Ref) {
   if (!SP->hasRegionCounters() || !getModule().getOptions().UseProfile.empty())
     return;
 
+  // With sparse instrumentation, only function entry and error branches are
+  // instrumented.
+  if (!SP->shouldEmitIncrementFor(Ref))
+    return;
+
   auto CounterIdx = SP->getCounterIndexFor(Ref);
 
   // If we're at an unreachable point, the increment can be elided as the
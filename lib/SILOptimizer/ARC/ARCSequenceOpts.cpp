@@ -41,6 +41,13 @@ STATISTIC(NumRefCountOpsRemoved, "Total number of increments removed");
 
 llvm::cl::opt<bool> EnableLoopARC("enable-loop-arc", llvm::cl::init(true));
 
+/// Each matching iteration is independently correct; iterating only uncovers
+/// additional nested pairs. Cap the number of iterations so pathological
+/// functions (e.g. huge switch-dominated bodies) stay linear in practice
+/// instead of re-running the dataflow until a fixed point. 0 means no limit.
+llvm::cl::opt<unsigned> MaxARCSequenceIterations("arc-sequence-max-iterations",
+                                                 llvm::cl::init(8));
+
 //===----------------------------------------------------------------------===//
 //                                Code Motion
 //===----------------------------------------------------------------------===//
@@ -139,6 +146,7 @@ bool LoopARCPairingContext::processRegion(const LoopRegion *Region,
   bool MadeChange = false;
   bool NestingDetected = false;
   bool MatchedPair = false;
+  unsigned Iteration = 0;
 
   do {
     NestingDetected = Evaluator.runOnLoop(Region, FreezePostDomReleases,
@@ -165,7 +173,9 @@ bool LoopARCPairingContext::processRegion(const LoopRegion *Region,
     // This ensures we only ever recompute post dominating releases on the first
     // iteration.
     RecomputePostDomReleases = false;
-  } while (NestingDetected && MatchedPair);
+  } while (NestingDetected && MatchedPair &&
+           (MaxARCSequenceIterations == 0 ||
+            ++Iteration < MaxARCSequenceIterations));
 
   return MadeChange;
 }
@@ -191,6 +201,7 @@ processFunctionWithoutLoopSupport(SILFunction &F, bool FreezePostDomReleases,
 
   bool Changed = false;
   BlockARCPairingContext Context(F, AA, POTA, RCIA, EAFI, PTFI);
+  unsigned Iteration = 0;
   // Until we do not remove any instructions or have nested increments,
   // decrements...
   while (true) {
@@ -209,6 +220,14 @@ processFunctionWithoutLoopSupport(SILFunction &F, bool FreezePostDomReleases,
     if (!ShouldRunAgain)
       break;
 
+    // Give up on any remaining nested pairs once the iteration cap is hit;
+    // everything matched so far has already been optimized.
+    if (MaxARCSequenceIterations != 0 &&
+        ++Iteration >= MaxARCSequenceIterations) {
+      LLVM_DEBUG(llvm::dbgs() << "\n<<< Hit max iterations! >>>\n");
+      break;
+    }
+
     // Otherwise, perform another iteration.
     LLVM_DEBUG(llvm::dbgs() << "\n<<< Made a Change! "
                                "Reprocessing Function! >>>\n");
@@ -13,6 +13,7 @@
 #include "swift/SILOptimizer/Analysis/ClassHierarchyAnalysis.h"
 #include "swift/AST/ASTContext.h"
 #include "swift/AST/Module.h"
+#include "swift/SIL/CalleeCache.h"
 #include "swift/SIL/SILInstruction.h"
 #include "swift/SIL/SILValue.h"
 #include "swift/SIL/SILModule.h"
@@ -40,9 +41,10 @@ void ClassHierarchyAnalysis::populateDirectSubclassesCacheIfNecessary() {
       ClassDecl *super = C->getSuperclassDecl();
       auto superModule = super->getModuleContext();
 
-      // Don't bother collecting subclasses for classes from a different module.
+      // Don't bother collecting subclasses for classes from a different
+      // module, unless the class hierarchy is closed package-wide.
       // TODO: cross-module WMO
-      if (superModule != module)
+      if (superModule != module && !isDeclInCoBuiltPackageModule(*M, super))
         break;
 
       // Find the superclass's list of direct subclasses.  If it's non-empty,
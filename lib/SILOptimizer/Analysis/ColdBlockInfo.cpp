@@ -17,6 +17,10 @@
 
 using namespace swift;
 
+/// A branch is considered biased if the less frequent successor was taken in
+/// fewer than one out of this many recorded executions of the branch.
+static const uint64_t ColdEdgeRatio = 20;
+
 /// Peek through an extract of Bool.value.
 static SILValue getCondition(SILValue C) {
   if (auto *SEI = dyn_cast<StructExtractInst>(C)) {
@@ -93,8 +97,31 @@ ColdBlockInfo::BranchHint ColdBlockInfo::getBranchHint(SILValue Cond,
   return BranchHint::None;
 }
 
-/// \return true if the CFG edge FromBB->ToBB is directly gated by a _slowPath
-/// branch hint.
+/// \return a BranchHint if the profile counts attached to \p CBI show that
+/// one successor is taken in fewer than one out of ColdEdgeRatio executions
+/// of the branch.
+ColdBlockInfo::BranchHint
+ColdBlockInfo::getProfileHint(const CondBranchInst *CBI) {
+  auto TrueCount = CBI->getTrueBBCount();
+  auto FalseCount = CBI->getFalseBBCount();
+  if (!TrueCount || !FalseCount)
+    return BranchHint::None;
+
+  uint64_t ThenCount = TrueCount.getValue();
+  uint64_t ElseCount = FalseCount.getValue();
+  if (ElseCount == 0)
+    return ThenCount > 0 ? BranchHint::LikelyTrue : BranchHint::None;
+  if (ThenCount == 0)
+    return BranchHint::LikelyFalse;
+  if (ElseCount < ThenCount / ColdEdgeRatio)
+    return BranchHint::LikelyTrue;
+  if (ThenCount < ElseCount / ColdEdgeRatio)
+    return BranchHint::LikelyFalse;
+  return BranchHint::None;
+}
+
+/// \return true if the CFG edge FromBB->ToBB is gated by a biased branch,
+/// either because the profile says so or because of a _slowPath branch hint.
 bool ColdBlockInfo::isSlowPath(const SILBasicBlock *FromBB,
                                const SILBasicBlock *ToBB,
                                int recursionDepth) {
@@ -102,9 +129,12 @@ bool ColdBlockInfo::isSlowPath(const SILBasicBlock *FromBB,
   if (!CBI)
     return false;
 
-  SILValue C = getCondition(CBI->getCondition());
-
-  BranchHint hint = getBranchHint(C, recursionDepth);
+  // Profile counts, when available, take precedence over static hints: they
+  // record what the program actually did rather than what the author
+  // expected it to do.
+  BranchHint hint = getProfileHint(CBI);
+  if (hint == BranchHint::None)
+    hint = getBranchHint(getCondition(CBI->getCondition()), recursionDepth);
   if (hint == BranchHint::None)
     return false;
 
@@ -25,7 +25,7 @@ void EpilogueARCContext::initializeDataflow() {
   for (auto *BB : PO->getPostOrder()) {
     // Find the exit blocks.
     if (isInterestedFunctionExitingBlock(BB)) {
-      ExitBlocks.insert(BB);
+      ExitBlocks->insert(BB);
     }
 
     // Allocate state for this block.
@@ -34,15 +34,14 @@ void EpilogueARCContext::initializeDataflow() {
 
   // Split the SILArgument into local arguments to each specific basic block.
   llvm::SmallVector<SILValue, 4> ToProcess;
-  llvm::DenseSet<SILValue> Processed;
+  ValueSet Processed(F);
   ToProcess.push_back(Arg);
   while (!ToProcess.empty()) {
     SILValue CArg = ToProcess.pop_back_val();
     if (!CArg)
       continue;
-    if (Processed.contains(CArg))
+    if (!Processed.insert(CArg))
       continue;
-    Processed.insert(CArg);
     if (auto *A = dyn_cast<SILPhiArgument>(CArg)) {
       // Find predecessor and break the SILArgument to predecessors.
       for (auto *X : A->getParent()->getPredecessorBlocks()) {
@@ -23,69 +23,108 @@ using namespace swift;
 
 /// Use Tarjan's strongly connected components (SCC) algorithm to find
 /// the SCCs in the call graph.
+///
+/// The search is iterative with an explicit frame stack so that deep call
+/// chains in large whole-module builds cannot overflow the native stack.
 void BottomUpFunctionOrder::DFS(SILFunction *Start) {
-  // Set the DFSNum for this node if we haven't already, and if we
-  // have, which indicates it's already been visited, return.
-  if (!DFSNum.insert(std::make_pair(Start, NextDFSNum)).second)
+  // If we've already visited this node, return.
+  if (DFSInfo.count(Start))
     return;
 
-  assert(MinDFSNum.find(Start) == MinDFSNum.end() &&
-         "Function should not already have a minimum DFS number!");
-
-  MinDFSNum[Start] = NextDFSNum;
-  ++NextDFSNum;
-
-  DFSStack.insert(Start);
-
-  // Visit all the instructions, looking for apply sites.
-  for (auto &B : *Start) {
-    for (auto &I : B) {
-      CalleeList callees;
-      if (auto FAS = FullApplySite::isa(&I)) {
-        callees = BCA->getCalleeList(FAS);
-      } else if (isa<StrongReleaseInst>(&I) || isa<ReleaseValueInst>(&I) ||
-                 isa<DestroyValueInst>(&I)) {
-        callees = BCA->getDestructors(I.getOperand(0)->getType(), /*isExactType*/ false);
-      } else if (auto *bi = dyn_cast<BuiltinInst>(&I)) {
-        switch (bi->getBuiltinInfo().ID) {
-          case BuiltinValueKind::Once:
-          case BuiltinValueKind::OnceWithContext:
-            callees = BCA->getCalleeListOfValue(bi->getArguments()[1]);
-            break;
-          default:
-            continue;
+  struct Frame {
+    SILFunction *Fn;
+    llvm::SmallVector<SILFunction *, 8> Callees;
+    unsigned NextCallee = 0;
+  };
+  llvm::SmallVector<Frame, 16> Frames;
+
+  // Number the function, push it on the SCC stack, and collect its callees
+  // by visiting all the instructions, looking for apply sites.
+  auto pushFrame = [&](SILFunction *Fn) {
+    auto &Info = DFSInfo[Fn];
+    Info.Num = Info.MinNum = NextDFSNum;
+    ++NextDFSNum;
+
+    DFSStack.insert(Fn);
+
+    Frames.emplace_back();
+    Frame &frame = Frames.back();
+    frame.Fn = Fn;
+
+    for (auto &B : *Fn) {
+      for (auto &I : B) {
+        CalleeList callees;
+        if (auto FAS = FullApplySite::isa(&I)) {
+          callees = BCA->getCalleeList(FAS);
+        } else if (isa<StrongReleaseInst>(&I) || isa<ReleaseValueInst>(&I) ||
+                   isa<DestroyValueInst>(&I)) {
+          callees = BCA->getDestructors(I.getOperand(0)->getType(), /*isExactType*/ false);
+        } else if (auto *bi = dyn_cast<BuiltinInst>(&I)) {
+          switch (bi->getBuiltinInfo().ID) {
+            case BuiltinValueKind::Once:
+            case BuiltinValueKind::OnceWithContext:
+              callees = BCA->getCalleeListOfValue(bi->getArguments()[1]);
+              break;
+            default:
+              continue;
+          }
+        } else {
+          continue;
         }
-      } else {
-        continue;
+
+        for (auto *CalleeFn : callees)
+          frame.Callees.push_back(CalleeFn);
       }
+    }
+  };
 
-      for (auto *CalleeFn : callees) {
-        // If not yet visited, visit the callee.
-        if (DFSNum.find(CalleeFn) == DFSNum.end()) {
-          DFS(CalleeFn);
-          MinDFSNum[Start] = std::min(MinDFSNum[Start], MinDFSNum[CalleeFn]);
-        } else if (DFSStack.count(CalleeFn)) {
-          // If the callee is on the stack, it update our minimum DFS
-          // number based on it's DFS number.
-          MinDFSNum[Start] = std::min(MinDFSNum[Start], DFSNum[CalleeFn]);
-        }
+  pushFrame(Start);
+
+  while (!Frames.empty()) {
+    Frame &frame = Frames.back();
+    SILFunction *Fn = frame.Fn;
+
+    if (frame.NextCallee < frame.Callees.size()) {
+      SILFunction *CalleeFn = frame.Callees[frame.NextCallee];
+      ++frame.NextCallee;
+
+      auto found = DFSInfo.find(CalleeFn);
+      if (found == DFSInfo.end()) {
+        // If not yet visited, visit the callee. Its minimum DFS number is
+        // propagated back to us when its frame is popped below.
+        pushFrame(CalleeFn);
+      } else if (DFSStack.count(CalleeFn)) {
+        // If the callee is on the stack, it update our minimum DFS
+        // number based on it's DFS number.
+        auto &Info = DFSInfo[Fn];
+        Info.MinNum = std::min(Info.MinNum, found->second.Num);
       }
+      continue;
     }
-  }
 
-  // If our DFS number is the minimum found, we've found a
-  // (potentially singleton) SCC, so pop the nodes off the stack and
-  // push the new SCC on our stack of SCCs.
-  if (DFSNum[Start] == MinDFSNum[Start]) {
-    SCC CurrentSCC;
+    // All callees have been visited; this function's numbering is final.
+    auto Numbers = DFSInfo[Fn];
+    Frames.pop_back();
 
-    SILFunction *Popped;
-    do {
-      Popped = DFSStack.pop_back_val();
-      CurrentSCC.push_back(Popped);
-    } while (Popped != Start);
+    if (!Frames.empty()) {
+      auto &CallerInfo = DFSInfo[Frames.back().Fn];
+      CallerInfo.MinNum = std::min(CallerInfo.MinNum, Numbers.MinNum);
+    }
 
-    TheSCCs.push_back(CurrentSCC);
+    // If our DFS number is the minimum found, we've found a
+    // (potentially singleton) SCC, so pop the nodes off the stack and
+    // push the new SCC on our stack of SCCs.
+    if (Numbers.Num == Numbers.MinNum) {
+      SCC CurrentSCC;
+
+      SILFunction *Popped;
+      do {
+        Popped = DFSStack.pop_back_val();
+        CurrentSCC.push_back(Popped);
+      } while (Popped != Fn);
+
+      TheSCCs.push_back(CurrentSCC);
+    }
   }
 }
 
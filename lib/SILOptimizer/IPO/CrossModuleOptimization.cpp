@@ -38,6 +38,13 @@ using namespace swift;
 static llvm::cl::opt<int> CMOFunctionSizeLimit("cmo-function-size-limit",
                                                llvm::cl::init(20));
 
+/// Generic functions are serialized regardless of size because clients can
+/// specialize them. Values > 0 cap their (abstract) size anyway, for build
+/// setups where swiftmodule size and client deserialization time matter more
+/// than specializing pathologically large bodies.
+static llvm::cl::opt<int> CMOGenericFunctionSizeLimit(
+    "cmo-generic-function-size-limit", llvm::cl::init(0));
+
 static llvm::cl::opt<bool> SerializeEverything(
     "sil-cross-module-serialize-all", llvm::cl::init(false),
     llvm::cl::desc(
@@ -660,6 +667,19 @@ bool CrossModuleOptimization::canUseFromInline(SILFunction *function) {
   return true;
 }
 
+/// Returns true if the inline-cost size of \p function stays below \p limit.
+static bool isBelowSizeLimit(SILFunction *function, int limit) {
+  int size = 0;
+  for (SILBasicBlock &block : *function) {
+    for (SILInstruction &inst : block) {
+      size += (int)instructionInlineCost(inst);
+      if (size >= limit)
+        return false;
+    }
+  }
+  return true;
+}
+
 /// Decide whether to serialize a function.
 bool CrossModuleOptimization::shouldSerialize(SILFunction *function) {
   // Check if we already handled this function before.
@@ -674,9 +694,11 @@ bool CrossModuleOptimization::shouldSerialize(SILFunction *function) {
 
   if (!conservative) {
     // The basic heuristic: serialize all generic functions, because it makes a
-    // huge difference if generic functions can be specialized or not.
+    // huge difference if generic functions can be specialized or not. An
+    // explicit generic size limit can still cap the largest of them.
     if (function->getLoweredFunctionType()->isPolymorphic())
-      return true;
+      return CMOGenericFunctionSizeLimit == 0 ||
+             isBelowSizeLimit(function, CMOGenericFunctionSizeLimit);
 
     if (function->getLinkage() == SILLinkage::Shared)
       return true;
@@ -686,14 +708,8 @@ bool CrossModuleOptimization::shouldSerialize(SILFunction *function) {
   // or should at least increase the cap.
   if (!M.getSwiftModule()->serializePackageEnabled()) {
     // Also serialize "small" non-generic functions.
-    int size = 0;
-    for (SILBasicBlock &block : *function) {
-      for (SILInstruction &inst : block) {
-        size += (int)instructionInlineCost(inst);
-        if (size >= CMOFunctionSizeLimit)
-          return false;
-      }
-    }
+    if (!isBelowSizeLimit(function, CMOFunctionSizeLimit))
+      return false;
   }
 
   return true;
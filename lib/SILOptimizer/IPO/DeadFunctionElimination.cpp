@@ -11,8 +11,11 @@
 //===----------------------------------------------------------------------===//
 
 #define DEBUG_TYPE "sil-dead-function-elimination"
+#include "swift/AST/ASTContext.h"
+#include "swift/AST/DiagnosticsSIL.h"
 #include "swift/AST/ProtocolConformance.h"
 #include "swift/Basic/Assertions.h"
+#include "swift/Basic/SourceManager.h"
 #include "swift/SIL/InstructionUtils.h"
 #include "swift/SIL/PatternMatch.h"
 #include "swift/SIL/SILBuilder.h"
@@ -23,6 +26,7 @@
 #include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/Statistic.h"
+#include "llvm/ADT/StringSet.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
 using namespace swift;
@@ -91,6 +95,45 @@ class DeadFunctionAndGlobalElimination {
 
   bool keepExternalWitnessTablesAlive;
 
+  /// The symbol names from the used-symbols list, if one was provided.
+  /// Externally visible functions that are not named here can be removed.
+  std::optional<llvm::StringSet<>> ExternallyUsedSymbols;
+
+  /// Reads the used-symbols list: one mangled name per line, with blank
+  /// lines and '#' comments allowed.
+  void loadExternallyUsedSymbols(StringRef path) {
+    auto &ctx = Module->getASTContext();
+    auto fs = ctx.SourceMgr.getFileSystem();
+    auto buffer = fs->getBufferForFile(path);
+    if (!buffer) {
+      ctx.Diags.diagnose(SourceLoc(), diag::cannot_read_used_symbols_list,
+                         path);
+      return;
+    }
+
+    ExternallyUsedSymbols.emplace();
+    SmallVector<StringRef, 16> lines;
+    (*buffer)->getBuffer().split(lines, '\n', /*MaxSplit=*/-1,
+                                 /*KeepEmpty=*/false);
+    for (auto line : lines) {
+      auto symbolName = line.trim();
+      if (symbolName.empty() || symbolName.starts_with("#"))
+        continue;
+      ExternallyUsedSymbols->insert(symbolName);
+    }
+  }
+
+  /// Whether the used-symbols list proves that no client references \p F.
+  bool isUnusedExternally(SILFunction *F) {
+    if (!ExternallyUsedSymbols)
+      return false;
+    // @_used functions can be referenced invisibly, e.g. from linker
+    // sections; the list cannot account for them.
+    if (F->markedAsUsed() || F->hasCReferences())
+      return false;
+    return !ExternallyUsedSymbols->contains(F->getName());
+  }
+
   /// Checks is a function is alive, e.g. because it is visible externally.
   bool isAnchorFunction(SILFunction *F) {
     // In embedded Swift, (even public) generic functions *after serialization*
@@ -101,8 +144,10 @@ class DeadFunctionAndGlobalElimination {
     if (embedded && generic && isSerialized)
       return false;
 
-    // Functions that may be used externally cannot be removed.
-    if (F->isPossiblyUsedExternally())
+    // Functions that may be used externally cannot be removed, unless a
+    // used-symbols list proves that nothing outside the module references
+    // them.
+    if (F->isPossiblyUsedExternally() && !isUnusedExternally(F))
       return true;
 
     if (F->getDynamicallyReplacedFunction())
@@ -715,7 +760,11 @@ public:
   DeadFunctionAndGlobalElimination(SILModule *module,
                                    bool keepExternalWitnessTablesAlive) :
     Module(module),
-    keepExternalWitnessTablesAlive(keepExternalWitnessTablesAlive) {}
+    keepExternalWitnessTablesAlive(keepExternalWitnessTablesAlive) {
+    auto &listPath = module->getOptions().ExternallyUsedSymbolsFile;
+    if (!listPath.empty())
+      loadExternallyUsedSymbols(listPath);
+  }
 
   /// The main entry point of the optimization.
   void eliminateFunctionsAndGlobals(SILModuleTransform *DFEPass) {
@@ -810,17 +810,29 @@ public:
     return getZeroToCountArray(Ind->Start, Ind->End) == ArrayVal;
   }
 
-  /// Hoists the necessary check for beginning and end of the induction
-  /// encapsulated by this access function to the header.
+  /// The induction this access function is based on.
+  InductionInfo *getInduction() const { return Ind; }
+
+  /// The offset the first accessed index has from the induction's start
+  /// value.
+  unsigned getFirstOffset() const { return preIncrement ? 1 : 0; }
+
+  /// The offset the last accessed index has from the induction's end value.
+  unsigned getLastOffset() const { return preIncrement ? 0 : 1; }
+
+  /// Hoists checks for the beginning and end of the index domain
+  /// [Start + \p FirstAdd, End - \p LastSub] to the preheader. The offsets
+  /// may be widened beyond this access function's own to cover a whole
+  /// batch of checks based on the same induction.
   void hoistCheckToPreheader(ArraySemanticsCall CheckToHoist,
-                             SILBasicBlock *Preheader,
-                             DominanceInfo *DT) {
+                             SILBasicBlock *Preheader, DominanceInfo *DT,
+                             unsigned FirstAdd, unsigned LastSub) {
     ApplyInst *AI = CheckToHoist;
     SILLocation Loc = AI->getLoc();
     SILBuilderWithScope Builder(Preheader->getTerminator(), AI);
 
     // Get the first induction value.
-    auto FirstVal = Ind->getFirstValue(Loc, Builder, preIncrement ? 1 : 0);
+    auto FirstVal = Ind->getFirstValue(Loc, Builder, FirstAdd);
     // Clone the struct for the start index.
     auto Start = cast<SingleValueInstruction>(CheckToHoist.getIndex())
                      ->clone(Preheader->getTerminator());
@@ -832,7 +844,7 @@ public:
     NewCheck->setOperand(1, Start);
 
     // Get the last induction value.
-    auto LastVal = Ind->getLastValue(Loc, Builder, preIncrement ? 0 : 1);
+    auto LastVal = Ind->getLastValue(Loc, Builder, LastSub);
     // Clone the struct for the end index.
     auto End = cast<SingleValueInstruction>(CheckToHoist.getIndex())
                    ->clone(Preheader->getTerminator());
@@ -844,6 +856,16 @@ public:
   }
 };
 
+/// A bounds check in a loop that can be hoisted to the preheader, together
+/// with the access function describing the indices it checks.
+struct HoistableBoundsCheck {
+  ArraySemanticsCall Check;
+  AccessFunction Access;
+  /// The underlying array pointer; checks on the same pointer guarded by the
+  /// same induction can share a pair of hoisted domain checks.
+  SILValue Array;
+};
+
 /// A dominating cond_fail on the same value ensures that this value is false.
 static bool isValueKnownFalseAt(SILValue Val, SILInstruction *At,
                                 DominanceInfo *DT) {
@@ -953,12 +975,20 @@ private:
                                    SILLoop *Loop,
                                    int recursionDepth);
   /// Analyze the loop for arrays that are not modified and perform dominator
-  /// tree based redundant bounds check removal.
+  /// tree based redundant bounds check removal. Checks that can be replaced
+  /// by checks of the loop's index domain in the preheader are collected in
+  /// \p HoistableChecks.
   bool hoistChecksInLoop(DominanceInfoNode *DTNode, ABCAnalysis &ABC,
-                         InductionAnalysis &IndVars, SILBasicBlock *Preheader,
-                         SILBasicBlock *Header,
+                         InductionAnalysis &IndVars,
+                         SmallVectorImpl<HoistableBoundsCheck> &HoistableChecks,
+                         SILBasicBlock *Preheader, SILBasicBlock *Header,
                          SILBasicBlock *SingleExitingBlk,
                          int recursionDepth);
+  /// Replace the collected hoistable checks by checks of the loop's index
+  /// domain in the preheader. Checks on the same array and induction share a
+  /// single pair of domain checks.
+  bool hoistDomainChecks(ArrayRef<HoistableBoundsCheck> HoistableChecks,
+                         SILBasicBlock *Preheader);
 
 public:
   void run() override {
@@ -1324,19 +1354,22 @@ bool ABCOpt::processLoop(SILLoop *Loop) {
   }
 
   // Hoist bounds checks.
-  Changed |= hoistChecksInLoop(DT->getNode(Header), ABC, IndVars, Preheader,
-                               Header, SingleExitingBlk, /*recursionDepth*/ 0);
+  SmallVector<HoistableBoundsCheck, 4> HoistableChecks;
+  Changed |= hoistChecksInLoop(DT->getNode(Header), ABC, IndVars,
+                               HoistableChecks, Preheader, Header,
+                               SingleExitingBlk, /*recursionDepth*/ 0);
+  Changed |= hoistDomainChecks(HoistableChecks, Preheader);
   if (Changed) {
     Preheader->getParent()->verify(getAnalysis<BasicCalleeAnalysis>()->getCalleeCache());
   }
   return Changed;
 }
 
-bool ABCOpt::hoistChecksInLoop(DominanceInfoNode *DTNode, ABCAnalysis &ABC,
-                               InductionAnalysis &IndVars,
-                               SILBasicBlock *Preheader, SILBasicBlock *Header,
-                               SILBasicBlock *SingleExitingBlk,
-                               int recursionDepth) {
+bool ABCOpt::hoistChecksInLoop(
+    DominanceInfoNode *DTNode, ABCAnalysis &ABC, InductionAnalysis &IndVars,
+    SmallVectorImpl<HoistableBoundsCheck> &HoistableChecks,
+    SILBasicBlock *Preheader, SILBasicBlock *Header,
+    SILBasicBlock *SingleExitingBlk, int recursionDepth) {
   // Avoid a stack overflow for very deep dominator trees.
   if (recursionDepth >= maxRecursionDepth)
     return false;
@@ -1421,28 +1454,72 @@ bool ABCOpt::hoistChecksInLoop(DominanceInfoNode *DTNode, ABCAnalysis &ABC,
     if (!blockAlwaysExecutes)
       continue;
 
-    // Hoist the access function and the check to the preheader for start and
-    // end of the induction.
+    // Defer the hoist so that checks over the same array and induction can
+    // share a single pair of checks covering the loop's index domain.
     assert(ArrayCall.canHoist(Preheader->getTerminator(), DT) &&
            "Must be able to hoist the call");
 
-    F.hoistCheckToPreheader(ArrayCall, Preheader, DT);
-
-    // Remove the old check in the loop and the match the retain with a release.
-    ArrayCall.removeCall();
-
-    LLVM_DEBUG(llvm::dbgs() << "  Bounds check hoisted\n");
-    Changed = true;
+    HoistableChecks.push_back({ArrayCall, F, Array});
+    LLVM_DEBUG(llvm::dbgs() << "  Bounds check hoistable\n");
   }
 
   // Traverse the children in the dominator tree.
   for (auto Child : *DTNode)
-    Changed |= hoistChecksInLoop(Child, ABC, IndVars, Preheader, Header,
-                                 SingleExitingBlk, recursionDepth + 1);
+    Changed |= hoistChecksInLoop(Child, ABC, IndVars, HoistableChecks,
+                                 Preheader, Header, SingleExitingBlk,
+                                 recursionDepth + 1);
 
   return Changed;
 }
 
+bool ABCOpt::hoistDomainChecks(ArrayRef<HoistableBoundsCheck> HoistableChecks,
+                               SILBasicBlock *Preheader) {
+  if (HoistableChecks.empty())
+    return false;
+
+  // Group the checks by underlying array pointer, induction, and semantics
+  // call kind. Each group's index domain is the union of the members'
+  // domains; checking its two endpoints in the preheader proves every index
+  // in between.
+  using DomainKey = std::pair<SILValue, std::pair<InductionInfo *, unsigned>>;
+  llvm::SmallDenseMap<DomainKey, std::pair<unsigned, unsigned>, 4> Domains;
+  for (auto &HC : HoistableChecks) {
+    DomainKey Key{HC.Array,
+                  {HC.Access.getInduction(), unsigned(HC.Check.getKind())}};
+    auto Offsets =
+        std::make_pair(HC.Access.getFirstOffset(), HC.Access.getLastOffset());
+    auto Inserted = Domains.try_emplace(Key, Offsets);
+    if (!Inserted.second) {
+      // Widen the domain to cover this access function as well.
+      auto &Known = Inserted.first->second;
+      Known.first = std::min(Known.first, Offsets.first);
+      Known.second = std::min(Known.second, Offsets.second);
+    }
+  }
+
+  // Emit one pair of domain checks per group and remove all checks in the
+  // loop.
+  for (auto &HC : HoistableChecks) {
+    ArraySemanticsCall Check = HC.Check;
+    DomainKey Key{HC.Array,
+                  {HC.Access.getInduction(), unsigned(Check.getKind())}};
+    auto Known = Domains.find(Key);
+    assert(Known != Domains.end() && "Hoistable check without a domain?");
+    if (Known != Domains.end()) {
+      AccessFunction Access = HC.Access;
+      Access.hoistCheckToPreheader(Check, Preheader, DT, Known->second.first,
+                                   Known->second.second);
+      // Later members of the group are covered by this pair of checks.
+      Domains.erase(Known);
+    }
+
+    // Remove the old check in the loop and match the retain with a release.
+    Check.removeCall();
+    LLVM_DEBUG(llvm::dbgs() << "  Bounds check hoisted\n");
+  }
+  return true;
+}
+
 } // end anonymous namespace
 
 SILTransform *swift::createABCOpt() {
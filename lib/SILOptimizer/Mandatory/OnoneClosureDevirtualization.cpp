@@ -0,0 +1,245 @@
+//===--- OnoneClosureDevirtualization.cpp - Inline closure-taking calls ---===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+// At -Onone, calls to stdlib higher-order functions like map, filter and
+// reduce keep all of their closure indirection: the callee is an unspecialized
+// generic function and the closure argument is invoked through a thick
+// function value. For closure-heavy numeric code this makes debug builds
+// dramatically slower than optimized builds.
+//
+// This pass recovers most of that gap without running the optimizer. It
+// performs a single, minimal step of devirtualization: a full apply of an
+// imported inlinable function (one whose serialized body is available, which
+// covers the stdlib higher-order functions) is inlined into the caller when
+// one of its arguments is a closure literal with a single use. Inlining with
+// the apply's substitution map specializes the callee body for the concrete
+// types at the call site, and exposes the closure application directly in the
+// caller.
+//
+// The pass deliberately only considers callees with serialized bodies from
+// other modules: functions defined in the current module are exactly the code
+// the user expects to step into as calls at -Onone. Inlining uses the
+// mandatory-inlining mode of SILInliner, so debug scopes of the inlined body
+// are preserved as inlined-at locations, like [transparent] functions.
+//
+//===----------------------------------------------------------------------===//
+
+#define DEBUG_TYPE "onone-closure-devirtualization"
+
+#include "swift/SIL/ApplySite.h"
+#include "swift/SIL/SILFunction.h"
+#include "swift/SIL/SILInstruction.h"
+#include "swift/SIL/SILModule.h"
+#include "swift/SILOptimizer/PassManager/Passes.h"
+#include "swift/SILOptimizer/PassManager/Transforms.h"
+#include "swift/SILOptimizer/Utils/InstructionDeleter.h"
+#include "swift/SILOptimizer/Utils/SILInliner.h"
+#include "swift/SILOptimizer/Utils/SILOptFunctionBuilder.h"
+#include "swift/SILOptimizer/Utils/StackNesting.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/Debug.h"
+
+using namespace swift;
+
+/// The maximum non-free inline cost of a callee to inline. This keeps the
+/// pass from bloating debug builds with large inlinable bodies; the stdlib
+/// higher-order functions are all well below this limit.
+static llvm::cl::opt<int> OnoneClosureDevirtSizeLimit(
+    "sil-onone-closure-devirt-size-limit", llvm::cl::init(200),
+    llvm::cl::desc("Maximum callee size for closure devirtualization at "
+                   "-Onone"));
+
+/// Returns true if all uses of \p value other than debug instructions and
+/// lifetime ends are a single consumer.
+static bool hasSingleRelevantUse(SILValue value) {
+  unsigned numUses = 0;
+  for (Operand *use : value->getUses()) {
+    SILInstruction *user = use->getUser();
+    if (user->isDebugInstruction())
+      continue;
+    if (isa<DestroyValueInst>(user) || isa<StrongReleaseInst>(user) ||
+        isa<ReleaseValueInst>(user) || isa<EndBorrowInst>(user) ||
+        isa<DeallocStackInst>(user) || isa<EndLifetimeInst>(user))
+      continue;
+    if (++numUses > 1)
+      return false;
+  }
+  return true;
+}
+
+/// Returns true if \p value is a closure literal — a partial_apply,
+/// thin_to_thick_function or bare function_ref, possibly behind the usual
+/// conversions — whose only relevant use is the apply site it was traced
+/// from. Such a closure cannot escape through this call, so inlining the
+/// callee exposes its applications without changing the closure's semantics.
+static bool isSingleUseClosureLiteral(SILValue value) {
+  while (true) {
+    if (!hasSingleRelevantUse(value))
+      return false;
+    if (isa<PartialApplyInst>(value) || isa<ThinToThickFunctionInst>(value) ||
+        isa<FunctionRefInst>(value))
+      return true;
+    if (auto *cfi = dyn_cast<ConvertFunctionInst>(value)) {
+      value = cfi->getOperand();
+      continue;
+    }
+    if (auto *cvt = dyn_cast<ConvertEscapeToNoEscapeInst>(value)) {
+      value = cvt->getOperand();
+      continue;
+    }
+    if (auto *mdi = dyn_cast<MarkDependenceInst>(value)) {
+      value = mdi->getValue();
+      continue;
+    }
+    if (auto *bbi = dyn_cast<BeginBorrowInst>(value)) {
+      value = bbi->getOperand();
+      continue;
+    }
+    if (auto *cvi = dyn_cast<CopyValueInst>(value)) {
+      value = cvi->getOperand();
+      continue;
+    }
+    if (auto *mvi = dyn_cast<MoveValueInst>(value)) {
+      value = mvi->getOperand();
+      continue;
+    }
+    return false;
+  }
+}
+
+/// Returns true if \p callee is an imported inlinable function whose body is
+/// available and may be inlined into \p caller.
+static bool isViableCallee(SILFunction *caller, FullApplySite apply,
+                           SILFunction *callee) {
+  // [transparent] functions were already handled by mandatory inlining.
+  if (callee->isTransparent() == IsTransparent)
+    return false;
+  if (callee->getInlineStrategy() == NoInline)
+    return false;
+
+  // If the callee is a declaration, see if we can load its serialized body.
+  if (callee->empty())
+    apply.getModule().loadFunction(callee, SILModule::LinkingMode::LinkNormal);
+  if (callee->empty())
+    return false;
+
+  // Only consider bodies imported from other modules. Functions defined in
+  // this module are ordinary debug-build code.
+  if (!callee->isAvailableExternally())
+    return false;
+
+  if (!callee->canBeInlinedIntoCaller(caller->getSerializedKind()))
+    return false;
+  if (caller->isAnySerialized() &&
+      !callee->hasValidLinkageForFragileRef(caller->getSerializedKind()))
+    return false;
+
+  // A non-OSSA body cannot be inlined into an OSSA caller.
+  if (!callee->hasOwnership() && caller->hasOwnership())
+    return false;
+
+  int cost = 0;
+  for (SILBasicBlock &block : *callee) {
+    for (SILInstruction &inst : block) {
+      if (instructionInlineCost(inst) == InlineCost::Free)
+        continue;
+      if (++cost > OnoneClosureDevirtSizeLimit)
+        return false;
+    }
+  }
+  return true;
+}
+
+/// Returns true if \p apply directly calls a viable inlinable function and
+/// passes it a single-use closure literal.
+static bool isDevirtualizationCandidate(SILFunction *caller,
+                                        FullApplySite apply) {
+  SILFunction *callee = apply.getReferencedFunctionOrNull();
+  if (!callee)
+    return false;
+
+  bool hasClosureArgument = false;
+  for (SILValue argument : apply.getArguments()) {
+    if (!argument->getType().is<SILFunctionType>())
+      continue;
+    if (isSingleUseClosureLiteral(argument)) {
+      hasClosureArgument = true;
+      break;
+    }
+  }
+  if (!hasClosureArgument)
+    return false;
+
+  return isViableCallee(caller, apply, callee);
+}
+
+namespace {
+
+class OnoneClosureDevirtualization : public SILFunctionTransform {
+  void run() override {
+    SILFunction *function = getFunction();
+    if (!function->isDefinition())
+      return;
+
+    // Collect the candidates up front; inlining invalidates instruction
+    // iteration. Applies exposed by inlining are not revisited: one minimal
+    // step of devirtualization per call site is the point of this pass.
+    SmallVector<FullApplySite, 8> candidates;
+    for (SILBasicBlock &block : *function) {
+      for (SILInstruction &inst : block) {
+        if (auto apply = FullApplySite::isa(&inst))
+          if (isDevirtualizationCandidate(function, apply))
+            candidates.push_back(apply);
+      }
+    }
+    if (candidates.empty())
+      return;
+
+    SILOptFunctionBuilder funcBuilder(*this);
+    bool changed = false;
+    bool invalidatedStackNesting = false;
+
+    for (FullApplySite apply : candidates) {
+      if (!SILInliner::canInlineApplySite(apply))
+        continue;
+      SILFunction *callee = apply.getReferencedFunctionOrNull();
+
+      LLVM_DEBUG(llvm::dbgs()
+                 << "Inlining closure-taking call of @" << callee->getName()
+                 << " into @" << function->getName() << "\n");
+
+      // When inlining an OSSA body into a non-OSSA caller, ownership of
+      // nonescaping closures is lowered and they become stack users, so the
+      // stack nesting must be corrected afterwards.
+      if (SILInliner::invalidatesStackNesting(apply) ||
+          (callee->hasOwnership() && !function->hasOwnership()))
+        invalidatedStackNesting = true;
+
+      InstructionDeleter deleter;
+      SILInliner::inlineFullApply(apply, SILInliner::InlineKind::MandatoryInline,
+                                  funcBuilder, deleter);
+      deleter.cleanupDeadInstructions();
+      changed = true;
+    }
+
+    if (invalidatedStackNesting)
+      StackNesting::fixNesting(function);
+    if (changed)
+      invalidateAnalysis(SILAnalysis::InvalidationKind::FunctionBody);
+  }
+};
+
+} // end anonymous namespace
+
+SILTransform *swift::createOnoneClosureDevirtualization() {
+  return new OnoneClosureDevirtualization();
+}
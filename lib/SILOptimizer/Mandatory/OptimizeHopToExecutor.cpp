@@ -39,6 +39,16 @@ namespace {
 ///      ... // no instruction which require to run on %a
 ///      return
 ///   \endcode
+///
+/// Both steps treat all references to the shared MainActor instance as the
+/// same actor, and the redundancy elimination additionally knows that an
+/// async call to a main-actor-isolated function returns on the main executor
+/// and therefore does not invalidate a main-actor state:
+///   \code
+///      hop_to_executor %main
+///      ... // no suspension points, except calls to @MainActor functions
+///      hop_to_executor %main2 // can be eliminated
+///   \endcode
 class OptimizeHopToExecutor {
 
 private:
@@ -86,6 +96,10 @@ private:
 
   SILFunction *function;
 
+  /// The ID in Actors which is shared by all references to the main actor,
+  /// if there are any.
+  std::optional<int> mainActorId;
+
   /// All block states.
   std::vector<BlockState> blockStates;
 
@@ -116,6 +130,17 @@ public:
   void dump();
 };
 
+/// Returns true if \p value is a reference to the shared MainActor instance.
+///
+/// MainActor has no accessible initializers, so every value of MainActor type
+/// is the shared instance. The same is not true for other global actors: their
+/// types can have additional instances with their own executors.
+static bool isMainActorValue(SILValue value) {
+  if (auto *nominal = value->getType().getNominalOrBoundGenericNominal())
+    return nominal->isMainActor();
+  return false;
+}
+
 /// Search for hop_to_executor instructions and add their operands to \p actors.
 void OptimizeHopToExecutor::collectActors(Actors &actors) {
   int uniqueActorID = 0;
@@ -127,6 +152,16 @@ void OptimizeHopToExecutor::collectActors(Actors &actors) {
         if (actors.count(oper))
           continue;
 
+        // All references to the main actor denote the same executor, even if
+        // they are distinct values, e.g. separately loaded from
+        // MainActor.shared.
+        if (isMainActorValue(oper)) {
+          if (!mainActorId)
+            mainActorId = uniqueActorID++;
+          actors[oper] = *mainActorId;
+          continue;
+        }
+
         actors[oper] = uniqueActorID++;
       }
     }
@@ -202,6 +237,18 @@ static bool isSuspensionPoint(SILInstruction *inst) {
   return false;
 }
 
+/// Returns true if \p inst is an async call which is guaranteed to return on
+/// the main executor, because its callee is isolated to the main actor.
+static bool returnsOnMainActor(SILInstruction *inst) {
+  auto applySite = FullApplySite::isa(inst);
+  if (!applySite || !applySite.isAsync())
+    return false;
+  SILFunction *callee = applySite.getReferencedFunctionOrNull();
+  if (!callee)
+    return false;
+  return callee->getActorIsolation().isMainActor();
+}
+
 /// Remove hop_to_executor instructions which are dominated by another
 /// hop_to_executor with the same operand.
 /// See the top-level comment on OptimizeHopToExecutor for details.
@@ -215,8 +262,10 @@ bool OptimizeHopToExecutor::removeRedundantHopToExecutors(const Actors &actors)
     for (SILInstruction &inst : *state.block) {
       if (isSuspensionPoint(&inst)) {
         // A suspension point (like an async call) can switch to another
-        // executor.
-        state.intra = BlockState::Unknown;
+        // executor, unless the callee is known to return on the main executor.
+        state.intra = (mainActorId && returnsOnMainActor(&inst))
+                          ? *mainActorId
+                          : BlockState::Unknown;
       } else if (auto *hop = dyn_cast<HopToExecutorInst>(&inst)) {
         state.intra = actors.lookup(hop->getOperand());
       }
@@ -235,7 +284,9 @@ bool OptimizeHopToExecutor::removeRedundantHopToExecutors(const Actors &actors)
     for (auto iter = state.block->begin(); iter != state.block->end();) {
       SILInstruction *inst = &*iter++;
       if (isSuspensionPoint(inst)) {
-        actorIdx = BlockState::Unknown;
+        actorIdx = (mainActorId && returnsOnMainActor(inst))
+                       ? *mainActorId
+                       : BlockState::Unknown;
         continue;
       }
       auto *hop = dyn_cast<HopToExecutorInst>(inst);
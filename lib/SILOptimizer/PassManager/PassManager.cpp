@@ -76,6 +76,11 @@ llvm::cl::opt<std::string> SILNumOptPassesToRun(
     "sil-opt-pass-count", llvm::cl::init(""),
     llvm::cl::desc("Stop optimizing after <N> passes or <N>.<M> passes/sub-passes"));
 
+llvm::cl::opt<unsigned> SILOptMaxTime(
+    "sil-opt-max-time", llvm::cl::init(0),
+    llvm::cl::desc("Stop running non-mandatory passes after this many "
+                   "milliseconds (0: no limit)"));
+
 // Read pass counts for each module from a config file.
 // Config file format:
 //   <module-name>:<pass-count>(.<sub-pass-count>)?
@@ -444,6 +449,11 @@ SILPassManager::SILPassManager(SILModule *M, bool isMandatory,
     parseBreakBeforePassCount(SILBreakBeforePassCount);
   }
 
+  if (SILOptMaxTime > 0) {
+    deadline = std::chrono::system_clock::now() +
+               std::chrono::milliseconds(SILOptMaxTime);
+  }
+
   for (SILAnalysis *A : Analyses) {
     A->initialize(this);
   }
@@ -483,6 +493,8 @@ void SILPassManager::parseBreakBeforePassCount(StringRef countsStr) {
 bool SILPassManager::continueTransforming() {
   if (isMandatory)
     return true;
+  if (passedDeadline())
+    return false;
   return NumPassesRun < maxNumPassesToRun;
 }
 
@@ -502,6 +514,8 @@ bool SILPassManager::continueWithNextSubpassRun(SILInstruction *forInst,
 
   if (isMandatory)
     return true;
+  if (passedDeadline())
+    return false;
   if (NumPassesRun != maxNumPassesToRun - 1)
     return true;
 
@@ -842,6 +856,18 @@ void SILPassManager::runModulePass(unsigned TransIdx) {
   if (isDisabled(SMT))
     return;
 
+  // If this pass already ran without changing anything and nothing in the
+  // module has changed since, it is proven idle and can be skipped, like
+  // an already-completed function pass.
+  auto idlePass = IdleModulePasses.find((unsigned)SMT->getPassKind());
+  if (idlePass != IdleModulePasses.end() &&
+      idlePass->second == ModuleChangeGeneration &&
+      !SILDisableSkippingPasses) {
+    if (SILPrintPassName)
+      dumpPassInfo("(Skip)", TransIdx);
+    return;
+  }
+
   const SILOptions &Options = getOptions();
 
   SMT->injectPassManager(this);
@@ -905,6 +931,11 @@ void SILPassManager::runModulePass(unsigned TransIdx) {
 
   updateSILModuleStatsAfterTransform(*Mod, SMT, *this, NumPassesRun, duration.count());
 
+  // Remember if this pass didn't change anything. Stale entries expire on
+  // their own because any subsequent change bumps the generation.
+  if (!CurrentPassHasInvalidated)
+    IdleModulePasses[(unsigned)SMT->getPassKind()] = ModuleChangeGeneration;
+
   if (Options.VerifyAll &&
       (CurrentPassHasInvalidated || !SILVerifyWithoutInvalidation)) {
     Mod->verify(getAnalysis<BasicCalleeAnalysis>()->getCalleeCache());
@@ -1067,6 +1098,7 @@ SILPassManager::~SILPassManager() {
 }
 
 void SILPassManager::notifyOfNewFunction(SILFunction *F, SILTransform *T) {
+  ++ModuleChangeGeneration;
   if (doPrintAfter(T, F, /*PassChangedSIL*/ true)) {
     dumpPassInfo("*** New SIL function in ", T, F);
     F->dump(getOptions().EmitVerboseSIL);
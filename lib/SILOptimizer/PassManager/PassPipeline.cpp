@@ -896,6 +896,11 @@ static void addLastChanceOptPassPipeline(SILPassPipelinePlan &P) {
   P.addAccessPathVerification();
 #endif
 
+  // Use non-atomic refcounting on objects proven thread-local. Runs after all
+  // general transformations so that escape information is as precise as it
+  // will get.
+  P.addNonAtomicRefCounting();
+
   // Only has an effect if the -assume-single-thread option is specified.
   if (P.getOptions().AssumeSingleThreaded) {
     P.addAssumeSingleThreaded();
@@ -1092,6 +1097,11 @@ SILPassPipelinePlan::getOnonePassPipeline(const SILOptions &Options) {
   P.startPipeline("Rest of Onone");
   P.addUsePrespecialized();
 
+  // Inline imported inlinable functions that are passed single-use closure
+  // literals, so stdlib higher-order calls like map and filter do not pay
+  // full generic and closure indirection in debug builds.
+  P.addOnoneClosureDevirtualization();
+
   // Has only an effect if the -assume-single-thread option is specified.
   if (P.getOptions().AssumeSingleThreaded) {
     P.addAssumeSingleThreaded();
@@ -120,6 +120,37 @@ void SILCombiner::addReachableCodeToWorklist(SILBasicBlock *BB) {
 //                               Implementation
 //===----------------------------------------------------------------------===//
 
+namespace {
+
+/// A kind-indexed table of the instruction kinds SILCombiner has any rule
+/// for: a C++ visitor or a registered Swift instruction pass, both of which
+/// appear as visit method declarations on SILCombiner itself. Kinds without
+/// such a declaration inherit the no-op default from SILInstructionVisitor.
+/// Whether a declaration is SILCombiner's own or inherited is encoded in the
+/// class of its member pointer, so the table can be computed at compile time;
+/// selecting the rule set for an instruction is then a single indexed load
+/// instead of running the visitor machinery to reach a no-op.
+struct SILCombineRuleTable {
+  bool hasRule[unsigned(SILNodeKind::Last_SILInstruction) + 1] = {};
+
+  constexpr SILCombineRuleTable() {
+#define INST(ID, PARENT)                                                       \
+  hasRule[unsigned(SILInstructionKind::ID)] =                                  \
+      std::is_same<decltype(&SILCombiner::visit##ID),                          \
+                   SILInstruction *(SILCombiner::*)(ID *)>::value;
+#include "swift/SIL/SILNodes.def"
+  }
+};
+
+constexpr SILCombineRuleTable RuleTable;
+
+} // end anonymous namespace
+
+/// Whether SILCombiner has any combine registered for \p kind.
+static bool hasCombineRule(SILInstructionKind kind) {
+  return RuleTable.hasRule[unsigned(kind)];
+}
+
 // Define a CanonicalizeInstruction subclass for use in SILCombine.
 class SILCombineCanonicalize final : CanonicalizeInstruction {
   SmallSILInstructionWorklist<256> &Worklist;
@@ -461,21 +492,25 @@ bool SILCombiner::doOneIteration(SILFunction &F, unsigned Iteration) {
       }
     }
 
-    // Then begin... SILCombine.
-    Builder.setInsertionPoint(I);
-
+    // Then begin... SILCombine. Consult the rule table first: most
+    // instruction kinds have no rules at all, and for those the visit would
+    // only reach the no-op default.
     SILInstruction *currentInst = I;
-    if (SILInstruction *Result = visit(I)) {
-      ++NumCombined;
-      // Should we replace the old instruction with a new one?
-      Worklist.replaceInstructionWithInstruction(I, Result
+    if (hasCombineRule(I->getKind())) {
+      Builder.setInsertionPoint(I);
+
+      if (SILInstruction *Result = visit(I)) {
+        ++NumCombined;
+        // Should we replace the old instruction with a new one?
+        Worklist.replaceInstructionWithInstruction(I, Result
 #ifndef NDEBUG
-                                                 ,
-                                                 OrigIStr
+                                                   ,
+                                                   OrigIStr
 #endif
-      );
-      currentInst = Result;
-      MadeChange = true;
+        );
+        currentInst = Result;
+        MadeChange = true;
+      }
     }
 
     // Eliminate copies created that this SILCombine iteration may have
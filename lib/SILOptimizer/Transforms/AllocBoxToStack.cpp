@@ -335,7 +335,7 @@ static bool checkLocalApplyBody(Operand *O,
 
 // Returns true if a callee is eligible to be cloned and rewritten for
 // AllocBoxToStack opt. We don't want to increase code size, so this is
-// restricted only for private local functions currently.
+// restricted to functions that are not visible outside the module.
 static bool isOptimizableApplySite(ApplySite Apply) {
   if (!AllocBoxToStackAnalyzeApply) {
     // turned off explicitly
@@ -358,7 +358,12 @@ static bool isOptimizableApplySite(ApplySite Apply) {
   if (callee->getInlineStrategy() == Inline_t::AlwaysInline)
     return false;
 
-  if (callee->getLinkage() != SILLinkage::Private)
+  // Private and hidden functions can both be cloned safely: the clone gets
+  // a fresh name and the original remains for any apply sites we did not
+  // analyze. Externally visible functions are left alone to avoid code-size
+  // growth for callees that are likely called from many places.
+  if (callee->getLinkage() != SILLinkage::Private &&
+      callee->getLinkage() != SILLinkage::Hidden)
     return false;
 
   return true;
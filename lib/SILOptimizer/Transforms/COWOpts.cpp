@@ -60,6 +60,13 @@ namespace {
 /// The optimization can also handle def-use chains between end_cow_mutation and
 /// begin_cow_mutation which involve phi-arguments.
 ///
+/// Beside end_cow_mutation, the buffer result of a begin_cow_mutation whose
+/// uniqueness result was already folded to "true" is accepted as a source of
+/// a uniquely referenced buffer. This handles whole mutation regions where
+/// a dominating begin_cow_mutation (e.g. hoisted into a loop pre-header)
+/// proves uniqueness for the begin_cow_mutation instructions inside the
+/// region.
+///
 class COWOptsPass : public SILFunctionTransform {
 public:
   COWOptsPass() {}
@@ -69,7 +76,8 @@ public:
 private:
   AliasAnalysis *AA = nullptr;
 
-  bool optimizeBeginCOW(BeginCOWMutationInst *BCM);
+  bool optimizeBeginCOW(BeginCOWMutationInst *BCM,
+                        InstructionSet &provenlyUniqueBeginCOWs);
 
   static void collectEscapePoints(SILValue v,
                                   InstructionSetWithSize &escapePoints,
@@ -87,12 +95,15 @@ void COWOptsPass::run() {
   AA = PM->getAnalysis<AliasAnalysis>(F);
 
   bool changed = false;
+  InstructionSet provenlyUniqueBeginCOWs(F);
   for (SILBasicBlock &block : *F) {
-  
+
     for (SILInstruction &inst : block) {
       if (auto *beginCOW = dyn_cast<BeginCOWMutationInst>(&inst)) {
-        if (optimizeBeginCOW(beginCOW))
+        if (optimizeBeginCOW(beginCOW, provenlyUniqueBeginCOWs)) {
+          provenlyUniqueBeginCOWs.insert(beginCOW);
           changed = true;
+        }
       }
     }
   }
@@ -118,17 +129,22 @@ static SILValue skipStructAndExtract(SILValue value) {
   }
 }
 
-bool COWOptsPass::optimizeBeginCOW(BeginCOWMutationInst *BCM) {
+bool COWOptsPass::optimizeBeginCOW(BeginCOWMutationInst *BCM,
+                                   InstructionSet &provenlyUniqueBeginCOWs) {
   LLVM_DEBUG(llvm::dbgs() << "Looking at: ");
   LLVM_DEBUG(BCM->dump());
 
   SILFunction *function = BCM->getFunction();
   StackList<EndCOWMutationInst *> endCOWMutationInsts(function);
-  InstructionSet endCOWMutationsFound(function);
+  StackList<BeginCOWMutationInst *> uniqueBeginCOWMutationInsts(function);
+  InstructionSet sourceInsts(function);
 
   {
-    // Collect all end_cow_mutation instructions, used by the begin_cow_mutation,
-    // looking through block phi-arguments.
+    // Collect all instructions which produce the uniquely referenced buffer
+    // that the begin_cow_mutation uses, looking through block phi-arguments.
+    // Beside end_cow_mutation instructions, these can be the buffer results
+    // of begin_cow_mutation instructions whose uniqueness result was already
+    // proven to be true.
     StackList<SILValue> workList(function);
     ValueSet handled(function);
     workList.push_back(BCM->getOperand());
@@ -144,15 +160,22 @@ bool COWOptsPass::optimizeBeginCOW(BeginCOWMutationInst *BCM) {
           }
         }
       } else if (auto *ECM = dyn_cast<EndCOWMutationInst>(v)) {
-        if (endCOWMutationsFound.insert(ECM))
+        if (sourceInsts.insert(ECM))
           endCOWMutationInsts.push_back(ECM);
+      } else if (auto *result = dyn_cast<MultipleValueInstructionResult>(v)) {
+        auto *priorBCM = dyn_cast<BeginCOWMutationInst>(result->getParent());
+        if (!priorBCM || SILValue(result) != priorBCM->getBufferResult() ||
+            !provenlyUniqueBeginCOWs.contains(priorBCM))
+          return false;
+        if (sourceInsts.insert(priorBCM))
+          uniqueBeginCOWMutationInsts.push_back(priorBCM);
       } else {
         return false;
       }
     }
   }
 
-  // Collect all uses of the end_cow_instructions, where the buffer can
+  // Collect all uses of the source instructions, where the buffer can
   // potentially escape.
   InstructionSetWithSize potentialEscapePoints(function);
   {
@@ -160,6 +183,10 @@ bool COWOptsPass::optimizeBeginCOW(BeginCOWMutationInst *BCM) {
     for (EndCOWMutationInst *ECM : endCOWMutationInsts) {
       collectEscapePoints(ECM, potentialEscapePoints, handled);
     }
+    for (BeginCOWMutationInst *priorBCM : uniqueBeginCOWMutationInsts) {
+      collectEscapePoints(priorBCM->getBufferResult(), potentialEscapePoints,
+                          handled);
+    }
   }
 
   if (!potentialEscapePoints.empty()) {
@@ -208,10 +235,9 @@ bool COWOptsPass::optimizeBeginCOW(BeginCOWMutationInst *BCM) {
           numLoadsFound += 1;
         }
 
-        // An end_cow_mutation marks the begin of the liverange. It's the end
+        // A source instruction marks the begin of the liverange. It's the end
         // point of the dataflow analysis.
-        auto *ECM = dyn_cast<EndCOWMutationInst>(inst);
-        if (ECM && endCOWMutationsFound.contains(ECM))
+        if (sourceInsts.contains(inst))
           break;
 
         if (inst == &inst->getParent()->front()) {
@@ -111,6 +111,11 @@ class SILPerformanceInliner {
   llvm::DenseMap<SILFunction *, ShortestPathAnalysis *> SPAs;
   llvm::SpecificBumpPtrAllocator<ShortestPathAnalysis> SPAAllocator;
 
+  /// Memoizes whether a callee contains self-recursive calls. Inlining only
+  /// mutates the caller, so callee bodies are stable for the lifetime of this
+  /// inliner instance.
+  llvm::DenseMap<SILFunction *, bool> SelfRecursionCache;
+
   ColdBlockInfo CBI;
 
   OptRemark::Emitter &ORE;
@@ -125,6 +130,12 @@ class SILPerformanceInliner {
     /// The benefit of inlining a `begin_apply`.
     RemovedCoroutineCallBenefit = 300,
 
+    /// The benefit of inlining a non-suspending async callee into an async
+    /// caller. Besides the call overhead this removes the caller-side
+    /// suspension split and the callee's async context allocation, which is
+    /// comparable to removing a coroutine allocation.
+    RemovedNonSuspendingAsyncCallBenefit = RemovedCoroutineCallBenefit,
+
     /// The benefit if the operand of an apply gets constant, e.g. if a closure
     /// is passed to an apply instruction in the callee.
     RemovedClosureBenefit = RemovedCallBenefit + 50,
@@ -452,6 +463,28 @@ bool isProfitableToInlineAutodiffVJP(SILFunction *vjp, SILFunction *caller,
   return true;
 }
 
+/// Returns true if the async function \p callee contains anything that may
+/// actually suspend: an executor hop, an unsafe continuation, or a call to
+/// another async function. A non-suspending async callee behaves like a sync
+/// function once inlined into an async caller, so all of its async call
+/// overhead can be removed. All async SIL is inlined before IRGen performs
+/// the coroutine splitting, so no lowering boundary restricts this.
+static bool asyncCalleeMaySuspend(SILFunction *callee) {
+  for (SILBasicBlock &block : *callee) {
+    for (SILInstruction &inst : block) {
+      if (isa<HopToExecutorInst>(&inst) ||
+          isa<GetAsyncContinuationInst>(&inst) ||
+          isa<GetAsyncContinuationAddrInst>(&inst) ||
+          isa<AwaitAsyncContinuationInst>(&inst))
+        return true;
+      if (auto FAI = FullApplySite::isa(&inst))
+        if (FAI.getOrigCalleeType()->isAsync())
+          return true;
+    }
+  }
+  return false;
+}
+
 bool SILPerformanceInliner::isProfitableToInline(
     FullApplySite AI, Weight CallerWeight, ConstantTracker &callerTracker,
     int &NumCallerBlocks,
@@ -467,8 +500,15 @@ bool SILPerformanceInliner::isProfitableToInline(
   }
 
   // Start with a base benefit.
-  int BaseBenefit = isa<BeginApplyInst>(AI) ? RemovedCoroutineCallBenefit
-                                            : RemovedCallBenefit;
+  int BaseBenefit = RemovedCallBenefit;
+  if (isa<BeginApplyInst>(AI)) {
+    BaseBenefit = RemovedCoroutineCallBenefit;
+  } else if (Callee->isAsync() && AI.getFunction()->isAsync() &&
+             !asyncCalleeMaySuspend(Callee)) {
+    // Tiny async accessors never clear the cost threshold with the plain
+    // call benefit, even though inlining them removes much more than a call.
+    BaseBenefit = RemovedNonSuspendingAsyncCallBenefit;
+  }
 
   // Osize heuristic.
   //
@@ -1068,7 +1108,8 @@ void SILPerformanceInliner::collectAppliesToInline(
     // At this occasion we record additional weight increases.
     addWeightCorrection(FAS, WeightCorrections);
 
-    if (SILFunction *Callee = getEligibleFunction(FAS, WhatToInline)) {
+    if (SILFunction *Callee =
+            getEligibleFunction(FAS, WhatToInline, &SelfRecursionCache)) {
       // Compute the shortest-path analysis for the callee.
       SILLoopInfo *CalleeLI = LA->get(Callee);
       ShortestPathAnalysis *CalleeSPA = getSPA(Callee, CalleeLI);
@@ -1119,7 +1160,8 @@ void SILPerformanceInliner::collectAppliesToInline(
 
       FullApplySite AI = FullApplySite(&*I);
 
-      auto *Callee = getEligibleFunction(AI, WhatToInline);
+      auto *Callee =
+          getEligibleFunction(AI, WhatToInline, &SelfRecursionCache);
       if (Callee) {
         // Check if we have an always_inline or transparent function. If we do,
         // just add it to our final Applies list and continue.
@@ -1304,7 +1346,8 @@ void SILPerformanceInliner::visitColdBlocks(
       if (!AI)
         continue;
 
-      auto *Callee = getEligibleFunction(AI, WhatToInline);
+      auto *Callee =
+          getEligibleFunction(AI, WhatToInline, &SelfRecursionCache);
       if (Callee && decideInColdBlock(AI, Callee, numCallerBlocks)) {
         AppliesToInline.push_back(AI);
       }
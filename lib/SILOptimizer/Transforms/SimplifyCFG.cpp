@@ -3022,7 +3022,7 @@ class ArgumentSplitter {
 
   /// The worklist of arguments that we still need to visit. We
   /// simplify each argument recursively one step at a time.
-  std::vector<SILArgument *> &Worklist;
+  llvm::SmallVectorImpl<SILArgument *> &Worklist;
 
   /// The values incoming into Arg.
   llvm::SmallVector<std::pair<SILBasicBlock *, SILValue>, 8> IncomingValues;
@@ -3033,7 +3033,7 @@ class ArgumentSplitter {
   std::optional<int> FirstNewArgIndex;
 
 public:
-  ArgumentSplitter(SILArgument *A, std::vector<SILArgument *> &W)
+  ArgumentSplitter(SILArgument *A, llvm::SmallVectorImpl<SILArgument *> &W)
       : Arg(A), Worklist(W), IncomingValues() {}
   bool split();
 
@@ -3269,7 +3269,7 @@ bool ArgumentSplitter::split() {
 /// this should be moved to the SROA pass.
 static bool splitBBArguments(SILFunction &Fn) {
   bool Changed = false;
-  std::vector<SILArgument *> Worklist;
+  llvm::SmallVector<SILArgument *, 32> Worklist;
 
   // We know that we have at least one BB, so this is safe since in such a case
   // std::next(Fn->begin()) == Fn->end(), the exit case of iteration on a range.
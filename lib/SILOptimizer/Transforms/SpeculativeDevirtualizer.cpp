@@ -26,6 +26,8 @@
 #include "swift/SIL/InstructionUtils.h"
 #include "swift/SIL/OptimizationRemark.h"
 #include "swift/SILOptimizer/Analysis/ClassHierarchyAnalysis.h"
+#include "swift/SILOptimizer/Analysis/ColdBlockInfo.h"
+#include "swift/SILOptimizer/Analysis/DominanceAnalysis.h"
 #include "swift/SILOptimizer/Utils/Generics.h"
 #include "swift/SILOptimizer/PassManager/Passes.h"
 #include "swift/SILOptimizer/PassManager/PassManager.h"
@@ -607,12 +609,21 @@ namespace {
         return;
 
       ClassHierarchyAnalysis *CHA = PM->getAnalysis<ClassHierarchyAnalysis>();
+      DominanceAnalysis *DA = PM->getAnalysis<DominanceAnalysis>();
+      ColdBlockInfo ColdBlocks(DA);
 
       bool Changed = false;
 
       // Collect virtual calls that may be specialized.
       SmallVector<FullApplySite, 16> ToSpecialize;
       for (auto &BB : *getFunction()) {
+        // Don't speculate in cold blocks: the checked_cast_br cascade only
+        // pays for its code size on paths which actually run. This covers
+        // blocks gated by a _slowPath hint as well as blocks a profile
+        // (-profile-use) shows to be rarely executed.
+        if (ColdBlocks.isCold(&BB))
+          continue;
+
         for (auto II = BB.begin(), IE = BB.end(); II != IE; ++II) {
           FullApplySite AI = FullApplySite::isa(&*II);
           if (AI && isa<ClassMethodInst>(AI.getCallee()))
@@ -1313,10 +1313,18 @@ ConstExprFunctionState::computeCallResult(ApplyInst *apply) {
                                            : callSubMap.subst(substitutionMap);
   }
 
+  // If an identical call was already evaluated, reuse its result instead of
+  // interpreting the callee again.
+  SymbolicValue result;
+  if (evaluator.lookupMemoizedCallResult(callee, calleeSubMap, paramConstants,
+                                         result)) {
+    setValue(apply, result);
+    return std::nullopt;
+  }
+
   // Now that we have successfully folded all of the parameters, we can evaluate
   // the call.
   evaluator.pushCallStack(apply->getLoc().getSourceLoc());
-  SymbolicValue result;
   auto callResult = evaluateAndCacheCall(*callee, calleeSubMap, paramConstants,
                                          result, numInstEvaluated, evaluator);
   evaluator.popCallStack();
@@ -1324,6 +1332,7 @@ ConstExprFunctionState::computeCallResult(ApplyInst *apply) {
   // Return the error value the callee evaluation failed.
   if (callResult.has_value())
     return callResult.value();
+  evaluator.memoizeCallResult(callee, calleeSubMap, paramConstants, result);
   setValue(apply, result);
   return std::nullopt;
 }
@@ -2035,7 +2044,6 @@ evaluateAndCacheCall(SILFunction &fn, SubstitutionMap substitutionMap,
                                numInstEvaluated,
                                /*TopLevelEvaluation*/ false);
 
-  // TODO: implement caching.
   // TODO: reject code that is too complex.
 
   unsigned nextBBArg = 0;
@@ -2077,8 +2085,6 @@ evaluateAndCacheCall(SILFunction &fn, SubstitutionMap substitutionMap,
       // values as well as any indirect results.
       result = val;
 
-      // TODO: Handle caching of results.
-
       LLVM_DEBUG(llvm::dbgs() << "\n");
       return std::nullopt;
     }
@@ -2098,6 +2104,195 @@ evaluateAndCacheCall(SILFunction &fn, SubstitutionMap substitutionMap,
   }
 }
 
+//===----------------------------------------------------------------------===//
+// Call result memoization
+//===----------------------------------------------------------------------===//
+
+/// Return true if \p value can participate in memoization of a call, as an
+/// argument or as the result. Only constants that carry no memory identity
+/// qualify: sharing an address, an array (which is modeled as a mutable
+/// memory cell holding its storage) or a closure between call sites could
+/// alias mutable state across the sites.
+static bool isMemoizableConstant(SymbolicValue value) {
+  switch (value.getKind()) {
+  case SymbolicValue::Integer:
+  case SymbolicValue::String:
+  case SymbolicValue::Function:
+  case SymbolicValue::Metatype:
+  case SymbolicValue::Enum:
+    return true;
+  case SymbolicValue::EnumWithPayload:
+    return isMemoizableConstant(value.getEnumPayloadValue());
+  case SymbolicValue::Aggregate: {
+    for (auto member : value.getAggregateMembers()) {
+      if (!isMemoizableConstant(member))
+        return false;
+    }
+    return true;
+  }
+  default:
+    return false;
+  }
+}
+
+/// Hash a memoizable constant by its structure. \p value must satisfy
+/// isMemoizableConstant.
+static llvm::hash_code getMemoizationHash(SymbolicValue value) {
+  auto kind = value.getKind();
+  switch (kind) {
+  case SymbolicValue::Integer:
+    return llvm::hash_combine(kind, hash_value(value.getIntegerValue()));
+  case SymbolicValue::String:
+    return llvm::hash_combine(kind, llvm::hash_value(value.getStringValue()));
+  case SymbolicValue::Function:
+    return llvm::hash_combine(kind, value.getFunctionValue());
+  case SymbolicValue::Metatype:
+    return llvm::hash_combine(kind, value.getMetatypeValue().getPointer());
+  case SymbolicValue::Enum:
+    return llvm::hash_combine(kind, value.getEnumValue());
+  case SymbolicValue::EnumWithPayload:
+    return llvm::hash_combine(kind, value.getEnumValue(),
+                              getMemoizationHash(value.getEnumPayloadValue()));
+  case SymbolicValue::Aggregate: {
+    llvm::hash_code hash =
+        llvm::hash_combine(kind, value.getAggregateType().getPointer());
+    for (auto member : value.getAggregateMembers())
+      hash = llvm::hash_combine(hash, getMemoizationHash(member));
+    return hash;
+  }
+  default:
+    llvm_unreachable("hashing a value that is not memoizable");
+  }
+}
+
+/// Compare two memoizable constants structurally. Both values must satisfy
+/// isMemoizableConstant.
+static bool areMemoizedValuesEqual(SymbolicValue lhs, SymbolicValue rhs) {
+  if (lhs.getKind() != rhs.getKind())
+    return false;
+  switch (lhs.getKind()) {
+  case SymbolicValue::Integer: {
+    APInt lhsValue = lhs.getIntegerValue();
+    APInt rhsValue = rhs.getIntegerValue();
+    return lhsValue.getBitWidth() == rhsValue.getBitWidth() &&
+           lhsValue == rhsValue;
+  }
+  case SymbolicValue::String:
+    return lhs.getStringValue() == rhs.getStringValue();
+  case SymbolicValue::Function:
+    return lhs.getFunctionValue() == rhs.getFunctionValue();
+  case SymbolicValue::Metatype:
+    return lhs.getMetatypeValue() == rhs.getMetatypeValue();
+  case SymbolicValue::Enum:
+    return lhs.getEnumValue() == rhs.getEnumValue();
+  case SymbolicValue::EnumWithPayload:
+    return lhs.getEnumValue() == rhs.getEnumValue() &&
+           areMemoizedValuesEqual(lhs.getEnumPayloadValue(),
+                                  rhs.getEnumPayloadValue());
+  case SymbolicValue::Aggregate: {
+    if (lhs.getAggregateType().getPointer() !=
+        rhs.getAggregateType().getPointer())
+      return false;
+    auto lhsMembers = lhs.getAggregateMembers();
+    auto rhsMembers = rhs.getAggregateMembers();
+    if (lhsMembers.size() != rhsMembers.size())
+      return false;
+    for (unsigned i = 0, e = lhsMembers.size(); i != e; ++i) {
+      if (!areMemoizedValuesEqual(lhsMembers[i], rhsMembers[i]))
+        return false;
+    }
+    return true;
+  }
+  default:
+    llvm_unreachable("comparing values that are not memoizable");
+  }
+}
+
+namespace {
+/// A call to a constant-evaluable function, identified by the callee, the
+/// substitutions of the call and the constant argument values.
+struct MemoizedCallKey {
+  SILFunction *callee;
+  SubstitutionMap substitutionMap;
+  ArrayRef<SymbolicValue> arguments;
+  llvm::hash_code hash;
+
+  static MemoizedCallKey get(SILFunction *callee,
+                             SubstitutionMap substitutionMap,
+                             ArrayRef<SymbolicValue> arguments) {
+    llvm::hash_code hash =
+        llvm::hash_combine(callee, substitutionMap.getOpaqueValue());
+    for (auto argument : arguments)
+      hash = llvm::hash_combine(hash, getMemoizationHash(argument));
+    return {callee, substitutionMap, arguments, hash};
+  }
+};
+} // end anonymous namespace
+
+namespace llvm {
+template <> struct DenseMapInfo<MemoizedCallKey> {
+  static MemoizedCallKey getEmptyKey() {
+    return {DenseMapInfo<swift::SILFunction *>::getEmptyKey(), {}, {},
+            llvm::hash_code()};
+  }
+  static MemoizedCallKey getTombstoneKey() {
+    return {DenseMapInfo<swift::SILFunction *>::getTombstoneKey(), {}, {},
+            llvm::hash_code()};
+  }
+  static unsigned getHashValue(const MemoizedCallKey &key) {
+    return unsigned(key.hash);
+  }
+  static bool isEqual(const MemoizedCallKey &lhs, const MemoizedCallKey &rhs) {
+    if (lhs.callee != rhs.callee ||
+        lhs.substitutionMap.getOpaqueValue() !=
+            rhs.substitutionMap.getOpaqueValue() ||
+        lhs.arguments.size() != rhs.arguments.size())
+      return false;
+    for (unsigned i = 0, e = lhs.arguments.size(); i != e; ++i) {
+      if (!areMemoizedValuesEqual(lhs.arguments[i], rhs.arguments[i]))
+        return false;
+    }
+    return true;
+  }
+};
+} // end namespace llvm
+
+namespace swift {
+/// A cache of memoized call results owned by a ConstExprEvaluator. The keys'
+/// argument arrays are copied into the evaluator's allocator; the cached
+/// results were allocated by the evaluation itself, so every entry shares the
+/// evaluator's lifetime.
+class ConstExprCallCache {
+  SymbolicValueAllocator &allocator;
+  llvm::DenseMap<MemoizedCallKey, SymbolicValue> results;
+
+public:
+  ConstExprCallCache(SymbolicValueAllocator &allocator)
+      : allocator(allocator) {}
+
+  std::optional<SymbolicValue> lookup(SILFunction *callee,
+                                      SubstitutionMap substitutionMap,
+                                      ArrayRef<SymbolicValue> arguments) const {
+    auto it =
+        results.find(MemoizedCallKey::get(callee, substitutionMap, arguments));
+    if (it == results.end())
+      return std::nullopt;
+    return it->second;
+  }
+
+  void insert(SILFunction *callee, SubstitutionMap substitutionMap,
+              ArrayRef<SymbolicValue> arguments, SymbolicValue result) {
+    auto *argumentStorage = allocator.allocate<SymbolicValue>(arguments.size());
+    std::uninitialized_copy(arguments.begin(), arguments.end(),
+                            argumentStorage);
+    results.insert({MemoizedCallKey::get(
+                        callee, substitutionMap,
+                        {argumentStorage, arguments.size()}),
+                    result});
+  }
+};
+} // end namespace swift
+
 //===----------------------------------------------------------------------===//
 // ConstExprEvaluator implementation.
 //===----------------------------------------------------------------------===//
@@ -2110,10 +2305,46 @@ ConstExprEvaluator::~ConstExprEvaluator() {}
 
 /// An explicit copy constructor.
 ConstExprEvaluator::ConstExprEvaluator(const ConstExprEvaluator &other)
-    : allocator(other.allocator) {
+    : allocator(other.allocator), assertConfig(other.assertConfig),
+      trackCallees(other.trackCallees) {
   callStack = other.callStack;
 }
 
+bool ConstExprEvaluator::lookupMemoizedCallResult(
+    SILFunction *callee, SubstitutionMap substitutionMap,
+    ArrayRef<SymbolicValue> arguments, SymbolicValue &result) {
+  if (!callResultCache)
+    return false;
+  for (auto argument : arguments) {
+    if (!isMemoizableConstant(argument))
+      return false;
+  }
+  auto cached = callResultCache->lookup(callee, substitutionMap, arguments);
+  if (!cached)
+    return false;
+  result = *cached;
+  return true;
+}
+
+void ConstExprEvaluator::memoizeCallResult(SILFunction *callee,
+                                           SubstitutionMap substitutionMap,
+                                           ArrayRef<SymbolicValue> arguments,
+                                           SymbolicValue result) {
+  // A cache hit would not replay the transitive callees of the memoized
+  // evaluation, so stay out of the way of clients that track callees.
+  if (trackCallees)
+    return;
+  if (!isMemoizableConstant(result))
+    return;
+  for (auto argument : arguments) {
+    if (!isMemoizableConstant(argument))
+      return;
+  }
+  if (!callResultCache)
+    callResultCache = std::make_unique<ConstExprCallCache>(allocator);
+  callResultCache->insert(callee, substitutionMap, arguments, result);
+}
+
 SymbolicValue ConstExprEvaluator::getUnknown(SILNode *node,
                                              UnknownReason reason) {
   return SymbolicValue::getUnknown(node, reason, getCallStack(),
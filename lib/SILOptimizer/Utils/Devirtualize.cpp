@@ -146,8 +146,10 @@ static bool isKnownFinalClass(ClassDecl *cd, SILModule &module,
   if (cd->isFinal())
     return true;
 
-  // Only handle classes defined within the SILModule's associated context.
-  if (!cd->isChildContextOf(module.getAssociatedContext()))
+  // Only handle classes defined within the SILModule's associated context,
+  // unless they come from a co-built module of the same package.
+  if (!cd->isChildContextOf(module.getAssociatedContext()) &&
+      !isDeclInCoBuiltPackageModule(module, cd))
     return false;
 
   if (!cd->hasAccess())
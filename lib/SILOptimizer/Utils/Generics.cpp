@@ -2908,10 +2908,24 @@ bool usePrespecialized(
     if (!deploymentAvail.isContainedIn(specializationAvail))
       continue;
 
+    // A candidate whose specialized type is already known not to match can be
+    // rejected without rebuilding its ReabstractionInfo, unless layout
+    // prespecialization may still find a layout-compatible match below.
+    // Building the ReabstractionInfo lowers the entire specialized signature,
+    // which dominates this scan for callees with many prespecializations.
+    bool mayMatchByLayout =
+        ctxt.LangOpts.hasFeature(Feature::LayoutPrespecialization) &&
+        !SA->getTypeErasedParams().empty();
+    if (auto cachedType = SA->getCachedSpecializedType())
+      if (cachedType != specializedReInfo.getSpecializedType() &&
+          !mayMatchByLayout)
+        continue;
+
     ReabstractionInfo reInfo(funcBuilder.getModule().getSwiftModule(),
                              funcBuilder.getModule().isWholeModule(), refF,
                              SA->getSpecializedSignature(),
                              /*isPrespecialization*/ true);
+    SA->setCachedSpecializedType(reInfo.getSpecializedType());
 
     if (specializedReInfo.getSpecializedType() != reInfo.getSpecializedType()) {
       SmallVector<Type, 4> newSubs;
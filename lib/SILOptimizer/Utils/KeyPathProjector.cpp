@@ -674,6 +674,7 @@ private:
 
 KeyPathInst *
 KeyPathProjector::getLiteralKeyPath(SILValue keyPath) {
+  keyPath = lookThroughOwnershipInsts(keyPath);
   while (auto *upCast = dyn_cast<UpcastInst>(keyPath)) {
     keyPath = lookThroughOwnershipInsts(upCast->getOperand());
   }
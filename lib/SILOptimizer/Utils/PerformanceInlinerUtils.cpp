@@ -747,8 +747,9 @@ static bool isCallerAndCalleeLayoutConstraintsCompatible(FullApplySite AI) {
 }
 
 // Returns the callee of an apply_inst if it is basically inlinable.
-SILFunction *swift::getEligibleFunction(FullApplySite AI,
-                                        InlineSelection WhatToInline) {
+SILFunction *swift::getEligibleFunction(
+    FullApplySite AI, InlineSelection WhatToInline,
+    llvm::DenseMap<SILFunction *, bool> *selfRecursionCache) {
   SILFunction *Callee = AI.getReferencedFunctionOrNull();
 
   if (!Callee) {
@@ -861,9 +862,13 @@ SILFunction *swift::getEligibleFunction(FullApplySite AI,
   // Inlining self-recursive functions into other functions can result
   // in excessive code duplication since we run the inliner multiple
   // times in our pipeline
-  //
-  // FIXME: This should be cached!
-  if (calleeIsSelfRecursive(Callee)) {
+  if (selfRecursionCache) {
+    auto entry = selfRecursionCache->try_emplace(Callee, false);
+    if (entry.second)
+      entry.first->second = calleeIsSelfRecursive(Callee);
+    if (entry.first->second)
+      return nullptr;
+  } else if (calleeIsSelfRecursive(Callee)) {
     return nullptr;
   }
 
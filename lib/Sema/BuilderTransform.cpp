@@ -1153,14 +1153,29 @@ ConstraintSystem::matchResultBuilder(AnyFunctionRef fn, Type builderType,
   // If this builder transform has not yet been applied to this function,
   // let's do it and cache the result.
   if (!transformedBody) {
-    ResultBuilderTransform transform(*this, fn.getAsDeclContext(),
-                                     fn.getBody()->getSourceRange(),
-                                     builderType, bodyResultType);
-    auto *body = transform.apply(fn.getBody());
-
-    if (auto unsupported = transform.getUnsupportedElement()) {
-      assert(!body || getASTContext().CompletionCallback);
+    // If a previous solver attempt already failed to apply this transform,
+    // don't synthesize (and discard) another copy of the body; replay the
+    // recorded unhandled construct instead.
+    auto unsupported = getUnsupportedResultBuilderElement(fn, builder);
+    if (!unsupported) {
+      ResultBuilderTransform transform(*this, fn.getAsDeclContext(),
+                                       fn.getBody()->getSourceRange(),
+                                       builderType, bodyResultType);
+      auto *body = transform.apply(fn.getBody());
+
+      if (auto firstUnsupported = transform.getUnsupportedElement()) {
+        assert(!body || getASTContext().CompletionCallback);
+        unsupported = firstUnsupported;
+        setUnsupportedResultBuilderElement(fn, builder, firstUnsupported);
+      } else {
+        transformedBody = std::make_pair(transform.getBuilderSelf(), body);
+        // Record the transformation so it could be re-used if needed.
+        setBuilderTransformedBody(fn, builder, transformedBody->first,
+                                  transformedBody->second);
+      }
+    }
 
+    if (unsupported) {
       // If we aren't supposed to attempt fixes, fail.
       if (!shouldAttemptFixes()) {
         return getTypeMatchFailure(locator);
@@ -1177,7 +1192,7 @@ ConstraintSystem::matchResultBuilder(AnyFunctionRef fn, Type builderType,
       // Record the first unhandled construct as a fix.
       if (recordFix(
               SkipUnhandledConstructInResultBuilder::create(
-                  *this, unsupported, builder, getConstraintLocator(locator)),
+                  *this, *unsupported, builder, getConstraintLocator(locator)),
               /*impact=*/100)) {
         return getTypeMatchFailure(locator);
       }
@@ -1189,11 +1204,6 @@ ConstraintSystem::matchResultBuilder(AnyFunctionRef fn, Type builderType,
 
       return getTypeMatchSuccess();
     }
-
-    transformedBody = std::make_pair(transform.getBuilderSelf(), body);
-    // Record the transformation so it could be re-used if needed.
-    setBuilderTransformedBody(fn, builder, transformedBody->first,
-                              transformedBody->second);
   }
 
   // Set the type of `$__builderSelf` variable before constraint generation.
@@ -8630,8 +8630,19 @@ ConstraintSystem::SolutionKind ConstraintSystem::simplifyConformsToConstraint(
       }
     }
 
-    // Check whether this type conforms to the protocol.
-    auto conformance = lookupConformance(type, protocol);
+    // Check whether this type conforms to the protocol. Literal protocols
+    // are almost always witnessed by their default types (Int, String,
+    // Array, ...), which recur in every constraint system, so resolve those
+    // through the ASTContext-wide cache instead of repeating the module
+    // lookup per expression.
+    ProtocolConformanceRef conformance;
+    if (kind == ConstraintKind::LiteralConformsTo && !type->hasTypeVariable() &&
+        !type->hasPlaceholder() && !type->hasArchetype()) {
+      conformance = getASTContext().getLiteralProtocolConformance(type,
+                                                                  protocol);
+    } else {
+      conformance = lookupConformance(type, protocol);
+    }
     if (conformance) {
       return recordConformance(conformance);
     }
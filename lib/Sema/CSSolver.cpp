@@ -44,6 +44,8 @@ using namespace constraints;
 #define JOIN2(X,Y) X##Y
 STATISTIC(NumSolutionAttempts, "# of solution attempts");
 STATISTIC(TotalNumTypeVariables, "# of type variables created");
+STATISTIC(NumDuplicateSolverShapes,
+          "# of solved systems with a previously-seen constraint shape");
 
 #define CS_STATISTIC(Name, Description) \
   STATISTIC(Overall##Name, Description);
@@ -657,6 +659,61 @@ ConstraintSystem::SolverState::~SolverState() {
 #endif
 }
 
+void SolverScopeArena::growSlab() {
+  // Remember where the current slab left off so that rewinding can
+  // restore the bump pointer once this slab is exhausted again.
+  SavedPtrs.push_back(CurPtr);
+
+  char *slab;
+  if (SpareSlab) {
+    slab = SpareSlab;
+    SpareSlab = nullptr;
+  } else {
+    slab = static_cast<char *>(llvm::safe_malloc(SlabSize));
+  }
+
+  Slabs.push_back(slab);
+  CurPtr = slab;
+  End = slab + SlabSize;
+}
+
+void SolverScopeArena::deallocate(void *ptr) {
+  auto *p = static_cast<char *>(ptr);
+  assert(!Slabs.empty() && "deallocating from an empty arena");
+
+  // If the allocation being reclaimed lives in an older slab, drop
+  // the newer slabs and restore the bump pointer they displaced.
+  while (p < Slabs.back() || p >= Slabs.back() + SlabSize) {
+    if (SpareSlab) {
+      free(Slabs.back());
+    } else {
+      SpareSlab = Slabs.back();
+    }
+    Slabs.pop_back();
+    CurPtr = SavedPtrs.pop_back_val();
+    assert(!Slabs.empty() && "deallocation not in LIFO order?");
+    End = Slabs.back() + SlabSize;
+  }
+
+  CurPtr = p;
+}
+
+SolverScopeArena::~SolverScopeArena() {
+  for (char *slab : Slabs)
+    free(slab);
+  free(SpareSlab);
+}
+
+ConstraintSystem::SolverScope *ConstraintSystem::SolverState::allocateScope() {
+  void *mem = ScopeArena.allocate(sizeof(SolverScope));
+  return new (mem) SolverScope(CS);
+}
+
+void ConstraintSystem::SolverState::reclaimScope(SolverScope *scope) {
+  scope->~SolverScope();
+  ScopeArena.deallocate(scope);
+}
+
 ConstraintSystem::SolverScope::SolverScope(ConstraintSystem &cs)
   : cs(cs), CGScope(cs.CG)
 {
@@ -1629,11 +1686,39 @@ ConstraintSystem::solveImpl(SyntacticElementTarget &target,
   }
 }
 
+#if LLVM_ENABLE_STATS
+/// Record a coarse, canonicalized hash of the "shape" of the given
+/// constraint system: the kinds and classifications of the constraints
+/// awaiting solving together with the number of type variables involved.
+///
+/// Structurally identical expressions (e.g. repeated string interpolation
+/// segments or literal-heavy collection literals) produce the same shape,
+/// so the number of duplicate shapes is an upper bound on what a
+/// solution-reuse cache keyed on this hash could save.
+static void recordSolverShape(ConstraintSystem &cs) {
+  llvm::hash_code shape = llvm::hash_value(cs.getTypeVariables().size());
+  for (auto &constraint : cs.getConstraints())
+    shape = llvm::hash_combine(shape, unsigned(constraint.getKind()),
+                               unsigned(constraint.getClassification()));
+
+  // FIXME: Like the "largest system" statistics above, this is not at all
+  // thread-safe.
+  static llvm::DenseSet<uint64_t> seenShapes;
+  if (!seenShapes.insert(uint64_t(shape)).second)
+    ++NumDuplicateSolverShapes;
+}
+#endif
+
 bool ConstraintSystem::solve(SmallVectorImpl<Solution> &solutions,
                              FreeTypeVariableBinding allowFreeTypeVariables) {
   // Set up solver state.
   SolverState state(*this, allowFreeTypeVariables);
 
+#if LLVM_ENABLE_STATS
+  if (llvm::AreStatisticsEnabled())
+    recordSolverShape(*this);
+#endif
+
   // Solve the system.
   solveImpl(solutions);
 
@@ -41,7 +41,7 @@ ComponentStep::Scope::Scope(ComponentStep &component)
   auto &workList = CS.InactiveConstraints;
   workList.splice(workList.end(), *component.Constraints);
 
-  SolverScope = new ConstraintSystem::SolverScope(CS);
+  SolverScope = CS.solverState->allocateScope();
   PrevPartialScope = CS.solverState->PartialSolutionScope;
   CS.solverState->PartialSolutionScope = SolverScope;
 }
@@ -351,7 +351,9 @@ class ComponentStep final : public SolverStep {
     Scope(ComponentStep &component);
 
     ~Scope() {
-      delete SolverScope; // rewind back all of the changes.
+      // Rewind back all of the changes and return the scope's memory
+      // to the arena.
+      CS.solverState->reclaimScope(SolverScope);
       CS.solverState->PartialSolutionScope = PrevPartialScope;
 
       // return all of the saved type variables back to the system.
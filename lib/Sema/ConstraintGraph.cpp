@@ -48,11 +48,23 @@ ConstraintGraph::~ConstraintGraph() {
 
   for (unsigned i = 0, n = TypeVariables.size(); i != n; ++i) {
     auto &impl = TypeVariables[i]->getImpl();
-    delete impl.getGraphNode();
+    impl.getGraphNode()->~ConstraintGraphNode();
     impl.setGraphNode(nullptr);
   }
 }
 
+void *ConstraintGraph::allocateNode() {
+  if (!FreedNodes.empty())
+    return FreedNodes.pop_back_val();
+  return CS.getAllocator().Allocate(sizeof(ConstraintGraphNode),
+                                    alignof(ConstraintGraphNode));
+}
+
+void ConstraintGraph::deallocateNode(ConstraintGraphNode *node) {
+  node->~ConstraintGraphNode();
+  FreedNodes.push_back(node);
+}
+
 #pragma mark Graph accessors
 
 std::pair<ConstraintGraphNode &, unsigned>
@@ -66,8 +78,8 @@ ConstraintGraph::lookupNode(TypeVariableType *typeVar) {
     return { *nodePtr, impl.getGraphIndex() };
   }
 
-  // Allocate the new node.
-  auto nodePtr = new ConstraintGraphNode(*this, typeVar);
+  // Allocate the new node out of the constraint system's arena.
+  auto nodePtr = new (allocateNode()) ConstraintGraphNode(*this, typeVar);
   unsigned index = TypeVariables.size();
   impl.setGraphNode(nodePtr);
   impl.setGraphIndex(index);
@@ -518,7 +530,7 @@ void ConstraintGraph::removeNode(TypeVariableType *typeVar) {
   // Remove this node.
   auto &impl = typeVar->getImpl();
   unsigned index = impl.getGraphIndex();
-  delete impl.getGraphNode();
+  deallocateNode(impl.getGraphNode());
   impl.setGraphNode(nullptr);
 
   // Remove this type variable from the list.
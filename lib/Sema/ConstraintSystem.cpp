@@ -116,6 +116,7 @@ ExpressionTimer::~ExpressionTimer() {
 ConstraintSystem::ConstraintSystem(DeclContext *dc,
                                    ConstraintSystemOptions options)
   : Context(dc->getASTContext()), DC(dc), Options(options),
+    Allocator(dc->getASTContext().takeSolverMemory()),
     Arena(dc->getASTContext(), Allocator),
     CG(*new ConstraintGraph(*this))
 {
@@ -132,6 +133,10 @@ ConstraintSystem::ConstraintSystem(DeclContext *dc,
 
 ConstraintSystem::~ConstraintSystem() {
   delete &CG;
+
+  // All solver-arena memory is dead at this point, so the allocator can
+  // serve the next constraint system.
+  getASTContext().recycleSolverMemory(std::move(Allocator));
 }
 
 void ConstraintSystem::incrementScopeCounter() {
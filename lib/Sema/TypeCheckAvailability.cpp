@@ -1386,9 +1386,18 @@ TypeChecker::overApproximateAvailabilityAtLocation(SourceLoc loc,
   if (SF && loc.isValid()) {
     TypeRefinementContext *rootTRC = getOrBuildTypeRefinementContext(SF);
     if (rootTRC) {
-      TypeRefinementContext *TRC =
-          rootTRC->findMostRefinedSubContext(loc, Context);
+      // Queries cluster in the scope currently being checked, so the context
+      // found last time usually still contains this location; searching its
+      // subtree first skips the descent from the root. If the location is
+      // outside the cached context, the search returns null and we fall back
+      // to the full search.
+      TypeRefinementContext *TRC = nullptr;
+      if (auto *lastTRC = SF->getLastQueriedTypeRefinementContext())
+        TRC = lastTRC->findMostRefinedSubContext(loc, Context);
+      if (!TRC)
+        TRC = rootTRC->findMostRefinedSubContext(loc, Context);
       if (TRC) {
+        SF->setLastQueriedTypeRefinementContext(TRC);
         OverApproximateContext.constrainWith(TRC->getAvailabilityInfo());
         if (MostRefined) {
           *MostRefined = TRC;
@@ -1476,6 +1476,13 @@ static llvm::Error skipRequirementSignature(llvm::BitstreamCursor &Cursor) {
   return skipRecords(Cursor, REQUIREMENT_SIGNATURE);
 }
 
+/// Advances past a lazy inherited protocols record.
+static llvm::Error skipInheritedProtocols(llvm::BitstreamCursor &Cursor) {
+  using namespace decls_block;
+
+  return skipRecords(Cursor, INHERITED_PROTOCOLS);
+}
+
 /// Advances past any lazy associated type member records.
 static llvm::Error skipAssociatedTypeMembers(llvm::BitstreamCursor &Cursor) {
   using namespace decls_block;
@@ -4650,12 +4657,9 @@ public:
     else
       return MF.diagnoseFatal();
 
-    SmallVector<ProtocolDecl *, 2> inherited;
-    if (!MF.readInheritedProtocols(inherited))
-      return MF.diagnoseFatal();
-
-    ctx.evaluator.cacheOutput(InheritedProtocolsRequest{proto},
-                              ctx.AllocateCopy(inherited));
+    proto->setLazyInheritedProtocols(&MF, MF.DeclTypeCursor.GetCurrentBitNo());
+    if (llvm::Error Err = skipInheritedProtocols(MF.DeclTypeCursor))
+      MF.fatal(std::move(Err));
 
     auto genericParams = MF.maybeReadGenericParams(DC);
     assert(genericParams && "protocol with no generic parameters?");
@@ -8669,6 +8673,17 @@ void ModuleFile::loadRequirementSignature(const ProtocolDecl *decl,
   readRequirementSignature(reqs, typeAliases, DeclTypeCursor);
 }
 
+void ModuleFile::loadInheritedProtocols(
+    const ProtocolDecl *decl, uint64_t contextData,
+    SmallVectorImpl<ProtocolDecl *> &inherited) {
+  BCOffsetRAII restoreOffset(DeclTypeCursor);
+  if (diagnoseAndConsumeFatalIfNotSuccess(
+          DeclTypeCursor.JumpToBit(contextData)))
+    return;
+  if (!readInheritedProtocols(inherited))
+    diagnoseAndConsumeFatal();
+}
+
 void ModuleFile::loadAssociatedTypes(const ProtocolDecl *decl,
                                      uint64_t contextData,
                            SmallVectorImpl<AssociatedTypeDecl *> &assocTypes) {
@@ -329,7 +329,10 @@ void ModuleFile::lookupValue(DeclName name,
                              SmallVectorImpl<ValueDecl*> &results) {
   PrettyStackTraceModuleFile stackEntry(*this);
 
-  if (Core->TopLevelDecls) {
+  // Consult the base name filters first so that guaranteed misses don't
+  // have to probe the on-disk hash tables at all.
+  if (Core->TopLevelDecls &&
+      Core->mayContainTopLevelDecl(name.getBaseName())) {
     // Find top-level declarations with the given name.
     // FIXME: As a bit of a hack, do lookup by the simple name, then filter
     // compound decls, to avoid having to completely redo how modules are
@@ -352,7 +355,8 @@ void ModuleFile::lookupValue(DeclName name,
   }
 
   // If the name is an operator name, also look for operator methods.
-  if (name.isOperator() && Core->OperatorMethodDecls) {
+  if (name.isOperator() && Core->OperatorMethodDecls &&
+      Core->mayContainOperatorMethod(name.getBaseName())) {
     auto iter = Core->OperatorMethodDecls->find(name.getBaseName());
     if (iter != Core->OperatorMethodDecls->end()) {
       for (auto item : *iter) {
@@ -768,11 +772,18 @@ ModuleFile::loadNamedMembers(const IterableDeclContext *IDC, DeclBaseName N,
   assert(Core->DeclMemberNames);
 
   TinyPtrVector<ValueDecl *> results;
-  auto i = Core->DeclMemberNames->find(N);
-  if (i == Core->DeclMemberNames->end())
+  auto cached = DeclMemberNamesCache.find(N);
+  if (cached == DeclMemberNamesCache.end()) {
+    std::optional<BitOffset> offset;
+    auto i = Core->DeclMemberNames->find(N);
+    if (i != Core->DeclMemberNames->end())
+      offset = *i;
+    cached = DeclMemberNamesCache.insert({N, offset}).first;
+  }
+  if (!cached->second)
     return results;
 
-  BitOffset subTableOffset = *i;
+  BitOffset subTableOffset = *cached->second;
   std::unique_ptr<SerializedDeclMembersTable> &subTable =
     DeclMembersTables[subTableOffset];
   if (!subTable) {
@@ -1007,6 +1018,14 @@ void ModuleFile::getExportedPrespecializations(
   }
 }
 
+bool ModuleFile::hasOperatorDeclarations() const {
+  return Core->OperatorDecls != nullptr;
+}
+
+bool ModuleFile::hasPrecedenceGroupDecls() const {
+  return Core->PrecedenceGroupDecls != nullptr;
+}
+
 void ModuleFile::getOperatorDecls(SmallVectorImpl<OperatorDecl *> &results) {
   PrettyStackTraceModuleFile stackEntry(*this);
   if (!Core->OperatorDecls)
@@ -309,6 +309,15 @@ private:
   llvm::DenseMap<uint32_t,
            std::unique_ptr<SerializedDeclMembersTable>> DeclMembersTables;
 
+  /// Caches the result of probing \c Core->DeclMemberNames for a base name,
+  /// as the offset of the name's members sub-table (or \c std::nullopt when
+  /// no member in this module has the name). Named lazy member loading asks
+  /// every extension of a nominal separately, and sibling extensions share
+  /// this module file; memoizing the probe turns one on-disk hash table
+  /// lookup per extension into one per module.
+  llvm::DenseMap<DeclBaseName, std::optional<serialization::BitOffset>>
+      DeclMemberNamesCache;
+
   llvm::DenseMap<const Decl *, Identifier> PrivateDiscriminatorsByValue;
   llvm::DenseMap<const Decl *, StringRef> FilenamesForPrivateValues;
 
@@ -846,6 +855,14 @@ public:
 
   void getExportedPrespecializations(SmallVectorImpl<Decl *> &results);
 
+  /// Returns whether the module declares any operators at all, without
+  /// deserializing anything.
+  bool hasOperatorDeclarations() const;
+
+  /// Returns whether the module declares any precedence groups at all,
+  /// without deserializing anything.
+  bool hasPrecedenceGroupDecls() const;
+
   /// Adds all operators to the given vector.
   void getOperatorDecls(SmallVectorImpl<OperatorDecl *> &Results);
 
@@ -938,6 +955,10 @@ public:
       const ProtocolDecl *proto, uint64_t contextData,
       SmallVectorImpl<AssociatedTypeDecl *> &assocTypes) override;
 
+  void
+  loadInheritedProtocols(const ProtocolDecl *proto, uint64_t contextData,
+                         SmallVectorImpl<ProtocolDecl *> &inherited) override;
+
   std::optional<StringRef> getGroupNameById(unsigned Id) const;
   std::optional<StringRef> getSourceFileNameById(unsigned Id) const;
   std::optional<StringRef> getGroupNameForDecl(const Decl *D) const;
@@ -724,6 +724,32 @@ ModuleFileSharedCore::readDeclTable(ArrayRef<uint64_t> fields,
                                                 base + sizeof(uint32_t), base));
 }
 
+void ModuleFileSharedCore::populateDeclNameFilter(
+    SerializedDeclTable &table, llvm::DenseSet<uint32_t> &filter) const {
+  for (auto keyIt = table.key_begin(), keyEnd = table.key_end();
+       keyIt != keyEnd; ++keyIt) {
+    auto key = keyIt.getInternalKey();
+    if (key.first != DeclBaseName::Kind::Normal)
+      continue;
+    filter.insert(
+        llvm::djbHash(key.second, serialization::SWIFTMODULE_HASH_SEED));
+  }
+}
+
+bool ModuleFileSharedCore::mayContainTopLevelDecl(DeclBaseName name) const {
+  if (name.getKind() != DeclBaseName::Kind::Normal)
+    return true;
+  return TopLevelDeclNameFilter.contains(llvm::djbHash(
+      name.getIdentifier().str(), serialization::SWIFTMODULE_HASH_SEED));
+}
+
+bool ModuleFileSharedCore::mayContainOperatorMethod(DeclBaseName name) const {
+  if (name.getKind() != DeclBaseName::Kind::Normal)
+    return true;
+  return OperatorMethodNameFilter.contains(llvm::djbHash(
+      name.getIdentifier().str(), serialization::SWIFTMODULE_HASH_SEED));
+}
+
 std::unique_ptr<ModuleFileSharedCore::SerializedExtensionTable>
 ModuleFileSharedCore::readExtensionTable(ArrayRef<uint64_t> fields,
                                    StringRef blobData) const {
@@ -909,6 +935,7 @@ bool ModuleFileSharedCore::readIndexBlock(llvm::BitstreamCursor &cursor) {
         break;
       case index_block::TOP_LEVEL_DECLS:
         TopLevelDecls = readDeclTable(scratch, blobData);
+        populateDeclNameFilter(*TopLevelDecls, TopLevelDeclNameFilter);
         break;
       case index_block::OPERATORS:
         OperatorDecls = readDeclTable(scratch, blobData);
@@ -924,6 +951,7 @@ bool ModuleFileSharedCore::readIndexBlock(llvm::BitstreamCursor &cursor) {
         break;
       case index_block::OPERATOR_METHODS:
         OperatorMethodDecls = readDeclTable(scratch, blobData);
+        populateDeclNameFilter(*OperatorMethodDecls, OperatorMethodNameFilter);
         break;
       case index_block::OBJC_METHODS:
         ObjCMethods = readObjCMethodTable(scratch, blobData);
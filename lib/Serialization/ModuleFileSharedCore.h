@@ -17,6 +17,7 @@
 #include "swift/AST/LinkLibrary.h"
 #include "swift/AST/Module.h"
 #include "swift/Serialization/Validation.h"
+#include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/bit.h"
 #include "llvm/Bitstream/BitstreamReader.h"
 
@@ -296,6 +297,27 @@ private:
   std::unique_ptr<SerializedDeclMemberNamesTable> DeclMemberNames;
   std::unique_ptr<SerializedDeclFingerprintsTable> DeclFingerprints;
 
+  /// Hashes of the normal base names in \c TopLevelDecls and
+  /// \c OperatorMethodDecls, used to reject guaranteed-miss qualified
+  /// lookups without probing the on-disk hash tables. Populated once when
+  /// the tables are read; the module file is immutable afterwards.
+  llvm::DenseSet<uint32_t> TopLevelDeclNameFilter;
+  llvm::DenseSet<uint32_t> OperatorMethodNameFilter;
+
+  /// Records the hash of every normal base name in \p table in \p filter.
+  /// Special names (init, subscript, ...) are rare and are not filtered.
+  void populateDeclNameFilter(SerializedDeclTable &table,
+                              llvm::DenseSet<uint32_t> &filter) const;
+
+  /// Whether \c TopLevelDecls may contain the given base name. Returns
+  /// false only for guaranteed misses; on a hit the table must be probed.
+  bool mayContainTopLevelDecl(DeclBaseName name) const;
+
+  /// Whether \c OperatorMethodDecls may contain the given base name.
+  /// Returns false only for guaranteed misses; on a hit the table must be
+  /// probed.
+  bool mayContainOperatorMethod(DeclBaseName name) const;
+
   class ObjCMethodTableInfo;
   using SerializedObjCMethodTable =
     llvm::OnDiskIterableChainedHashTable<ObjCMethodTableInfo>;
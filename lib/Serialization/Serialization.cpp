@@ -694,8 +694,11 @@ IdentifierID Serializer::addDeclBaseNameRef(DeclBaseName ident) {
     if (id != 0)
       return id;
 
-    id = ++LastUniquedStringID;
-    StringsToWrite.push_back(ident.getIdentifier().str());
+    // Identifiers and non-identifier strings share one uniqued string table,
+    // so an identifier whose text was already recorded -- say, as a filename
+    // or an attribute string -- reuses that entry instead of writing the
+    // text again.
+    id = addUniquedString(ident.getIdentifier().str()).second;
     return id;
   }
   case DeclBaseName::Kind::Subscript:
@@ -86,17 +86,17 @@ class Serializer : public SerializerBase {
 
   const SerializationOptions &Options;
 
-  /// A map from non-identifier uniqued strings to their serialized IDs.
+  /// A map from uniqued strings (identifiers and non-identifiers) to their
+  /// serialized IDs.
   ///
   /// Since we never remove items from this map, we can use a BumpPtrAllocator
   /// to back the entries.
   llvm::StringMap<IdentifierID, llvm::BumpPtrAllocator> UniquedStringIDs;
 
-  /// A map from Identifiers to their serialized IDs.
+  /// A cache of the IDs assigned to Identifiers via \p UniquedStringIDs.
   ///
-  /// This is stored separately from \p UniquedStringIDs because it's faster
-  /// to do lookups in, even though that may lead to some duplication between
-  /// identifier and non-identifier strings.
+  /// Identifier lookups are much more common than non-identifier ones, and a
+  /// pointer-keyed DenseMap probe is faster than hashing the text again.
   llvm::DenseMap<Identifier, IdentifierID> IdentifierIDs;
 
   /// All uniqued strings that need to be serialized (identifiers and
@@ -283,8 +283,13 @@ std::error_code SerializedModuleLoaderBase::openModuleDocFileIfPresent(
   SmallString<256>
   ModuleDocPath{BaseName.getName(file_types::TY_SwiftModuleDocFile)};
 
+  if (!maybeFileExists(FS, ModuleDocPath))
+    return std::error_code();
+
   llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> ModuleDocOrErr =
-    FS.getBufferForFile(ModuleDocPath);
+    FS.getBufferForFile(ModuleDocPath,
+                        /*FileSize=*/-1,
+                        /*RequiresNullTerminator=*/false);
   if (ModuleDocOrErr) {
     *ModuleDocBuffer = std::move(*ModuleDocOrErr);
   } else if (ModuleDocOrErr.getError() !=
@@ -301,6 +306,44 @@ SerializedModuleLoaderBase::getModuleName(ASTContext &Ctx, StringRef modulePath,
   return ModuleFile::getModuleName(Ctx, modulePath, Name);
 }
 
+bool SerializedModuleLoaderBase::maybeFileExists(llvm::vfs::FileSystem &FS,
+                                                 StringRef path) {
+  if (DirectoryListingFS != &FS) {
+    DirectoryListings.clear();
+    DirectoryListingFS = &FS;
+  }
+
+  StringRef dir = llvm::sys::path::parent_path(path);
+  if (dir.empty())
+    return true;
+
+  auto known = DirectoryListings.find(dir);
+  if (known == DirectoryListings.end()) {
+    std::optional<llvm::StringSet<>> listing;
+
+    std::error_code errorCode;
+    llvm::StringSet<> entries;
+    for (llvm::vfs::directory_iterator DI = FS.dir_begin(dir, errorCode), End;
+         !errorCode && DI != End; DI.increment(errorCode))
+      entries.insert(llvm::sys::path::filename(DI->path()));
+
+    if (!errorCode)
+      listing = std::move(entries);
+    else if (errorCode != std::errc::no_such_file_or_directory)
+      // The directory exists but could not be listed; don't draw any
+      // conclusions about its contents.
+      return true;
+
+    known = DirectoryListings.try_emplace(dir, std::move(listing)).first;
+  }
+
+  // A directory that doesn't exist contains no module files.
+  if (!known->second.has_value())
+    return false;
+
+  return known->second->contains(llvm::sys::path::filename(path));
+}
+
 std::error_code
 SerializedModuleLoaderBase::openModuleSourceInfoFileIfPresent(
     ImportPath::Element ModuleID,
@@ -323,13 +366,22 @@ SerializedModuleLoaderBase::openModuleSourceInfoFileIfPresent(
   llvm::sys::path::append(PathWithProjectDir, FileName);
 
   // Try to open the module source info file from the "Project" directory.
-  llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>>
-  ModuleSourceInfoOrErr = FS.getBufferForFile(PathWithProjectDir);
+  llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> ModuleSourceInfoOrErr =
+      std::make_error_code(std::errc::no_such_file_or_directory);
+  if (maybeFileExists(FS, PathWithProjectDir))
+    ModuleSourceInfoOrErr = FS.getBufferForFile(PathWithProjectDir,
+                                                /*FileSize=*/-1,
+                                                /*RequiresNullTerminator=*/false);
 
   // If it does not exist, try to open the module source info file adjacent to
   // the .swiftmodule file.
-  if (ModuleSourceInfoOrErr.getError() == std::errc::no_such_file_or_directory)
-    ModuleSourceInfoOrErr = FS.getBufferForFile(PathWithoutProjectDir);
+  if (ModuleSourceInfoOrErr.getError() ==
+          std::errc::no_such_file_or_directory &&
+      maybeFileExists(FS, PathWithoutProjectDir))
+    ModuleSourceInfoOrErr =
+        FS.getBufferForFile(PathWithoutProjectDir,
+                            /*FileSize=*/-1,
+                            /*RequiresNullTerminator=*/false);
 
   // If we ended up with a different file system error, return it.
   if (ModuleSourceInfoOrErr)
@@ -350,6 +402,12 @@ std::error_code SerializedModuleLoaderBase::openModuleFile(
   // module documentation file.
   SmallString<256> ModulePath{BaseName.getName(file_types::TY_SwiftModuleFile)};
 
+  // Most lookups probe search paths that don't contain the module at all;
+  // answer those misses from the cached listing of the enclosing directory
+  // instead of issuing a filesystem access per candidate path.
+  if (!maybeFileExists(FS, ModulePath))
+    return std::make_error_code(std::errc::no_such_file_or_directory);
+
   // If there's no buffer to load into, simply check for the existence of
   // the module file.
   if (!ModuleBuffer) {
@@ -381,11 +439,17 @@ std::error_code SerializedModuleLoaderBase::openModuleFile(
   // the surface look like memory corruption.
   //
   // rdar://63755989
+  //
+  // The serialized module format is read through a bitstream cursor and
+  // never relies on a trailing null terminator. Dropping the requirement
+  // means the buffer can stay memory-mapped even when the file size is an
+  // exact multiple of the page size, where requiring a terminator would
+  // force the whole file to be read into memory up front.
   bool enableVolatileModules = Ctx.LangOpts.EnableVolatileModules;
   llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> ModuleOrErr =
       FS.getBufferForFile(ModulePath,
                           /*FileSize=*/-1,
-                          /*RequiresNullTerminator=*/true,
+                          /*RequiresNullTerminator=*/false,
                           /*IsVolatile=*/enableVolatileModules);
   if (!ModuleOrErr)
     return ModuleOrErr.getError();
@@ -445,7 +509,10 @@ SerializedModuleLoaderBase::scanModuleFile(Twine modulePath, bool isFramework,
   const std::string sourceInfoPath;
 
   // Read and valid module.
-  auto moduleBuf = Ctx.SourceMgr.getFileSystem()->getBufferForFile(modulePath);
+  auto moduleBuf = Ctx.SourceMgr.getFileSystem()->getBufferForFile(
+      modulePath,
+      /*FileSize=*/-1,
+      /*RequiresNullTerminator=*/false);
   if (!moduleBuf)
     return moduleBuf.getError();
 
@@ -1858,6 +1925,14 @@ void SerializedASTFile::getTopLevelDeclsWhereAttributesMatch(
   File.getTopLevelDecls(results, matchAttributes);
 }
 
+bool SerializedASTFile::maybeHasOperatorDeclarations() const {
+  return File.hasOperatorDeclarations();
+}
+
+bool SerializedASTFile::maybeHasPrecedenceGroupDecls() const {
+  return File.hasPrecedenceGroupDecls();
+}
+
 void SerializedASTFile::getOperatorDecls(
     SmallVectorImpl<OperatorDecl *> &results) const {
   File.getOperatorDecls(results);
@@ -376,7 +376,12 @@ void Symbol::serializeDocComment(llvm::json::OStream &OS) const {
     if (const auto *ModuleD = DocCommentProvidingDecl->getModuleContext()) {
       OS.attribute("module", ModuleD->getNameStr());
     }
-    auto LL = Graph->Ctx.getLineList(RC);
+    // Build the line list in a transient context so its storage is released
+    // once this symbol has been serialized. Building it in the graph's shared
+    // context would retain every doc comment in the module for the duration
+    // of the emission.
+    markup::MarkupContext TransientCtx;
+    auto LL = TransientCtx.getLineList(RC);
     StringRef FirstNonBlankLine;
     for (const auto &Line : LL.getLines()) {
       if (!Line.Text.empty()) {
@@ -549,11 +549,11 @@ void SymbolGraph::serialize(llvm::json::OStream &OS) {
       if (DeclaringModule) {
         // A cross-import overlay can be considered part of its declaring module
         OS.attribute("name", (*DeclaringModule)->getNameStr());
-        std::vector<StringRef> B;
-        for (auto BModule : BystanderModules) {
-          B.push_back(BModule.str());
-        }
-        OS.attribute("bystanders", B);
+        OS.attributeArray("bystanders", [&](){
+          for (auto BModule : BystanderModules) {
+            OS.value(BModule.str());
+          }
+        });
       } else {
         OS.attribute("name", M.getNameStr());
       }
@@ -579,13 +579,22 @@ void SymbolGraph::serialize(llvm::json::OStream &OS) {
     // the string representation of the symbolgraph between the solver-based
     // and AST-based result.
     // This can be removed once the AST-based cursor info has been removed.
-    SmallVector<Edge> Edges(this->Edges.begin(), this->Edges.end());
-    std::sort(Edges.begin(), Edges.end(), [](const Edge &LHS, const Edge &RHS) {
-      SmallString<256> LHSTargetUSR, RHSTargetUSR;
-      LHS.Target.getUSR(LHSTargetUSR);
-      RHS.Target.getUSR(RHSTargetUSR);
-      return LHSTargetUSR < RHSTargetUSR;
+    // Compute each edge's sort key once up front rather than re-deriving
+    // the USRs inside the comparator on every comparison.
+    SmallVector<std::pair<SmallString<256>, const Edge *>> SortedEdges;
+    SortedEdges.reserve(this->Edges.size());
+    for (const auto &E : this->Edges) {
+      SmallString<256> TargetUSR;
+      E.Target.getUSR(TargetUSR);
+      SortedEdges.emplace_back(std::move(TargetUSR), &E);
+    }
+    llvm::sort(SortedEdges, [](const auto &LHS, const auto &RHS) {
+      return LHS.first < RHS.first;
     });
+    SmallVector<Edge> Edges;
+    Edges.reserve(SortedEdges.size());
+    for (const auto &Entry : SortedEdges)
+      Edges.push_back(*Entry.second);
 #endif
 
     OS.attributeArray("relationships", [&](){
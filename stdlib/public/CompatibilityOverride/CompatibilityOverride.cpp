@@ -68,6 +68,9 @@ static void *lookupSection(const char *segment, const char *section,
   return static_cast<void *>(data);
 }
 
+std::atomic<CompatibilityOverrideSectionState> swift::CompatibilityOverrideSection{
+    CompatibilityOverrideSectionState::Unchecked};
+
 static OverrideSection *getOverrideSectionPtr() {
   static OverrideSection *OverrideSectionPtr;
   static swift_once_t Predicate;
@@ -77,8 +80,14 @@ static OverrideSection *getOverrideSectionPtr() {
         lookupSection("__DATA", COMPATIBILITY_OVERRIDE_SECTION_NAME, &Size));
     if (Size < sizeof(OverrideSection))
       OverrideSectionPtr = nullptr;
+    // Publish the result so that the override points can skip their lookup
+    // entirely when no override library is present.
+    CompatibilityOverrideSection.store(
+        OverrideSectionPtr == nullptr ? CompatibilityOverrideSectionState::Absent
+                                      : CompatibilityOverrideSectionState::Present,
+        std::memory_order_relaxed);
   }, nullptr);
-  
+
   return OverrideSectionPtr;
 }
 
@@ -86,6 +86,7 @@
 #include "swift/Runtime/Metadata.h"
 #include "swift/Runtime/Once.h"
 #include "swift/Runtime/CMakeConfig.h"
+#include <atomic>
 #include <type_traits>
 
 namespace swift {
@@ -186,6 +187,23 @@ namespace swift {
   Override_ ## name getOverride_ ## name();
 #include COMPATIBILITY_OVERRIDE_INCLUDE_PATH
 
+/// The process-wide result of looking up the override section for the current
+/// library. Starts out Unchecked and is set exactly once, by the first
+/// override accessor to run. Once it reads Absent, every override point in
+/// the library can skip its own once and call the standard implementation
+/// directly, which is the common case: most processes don't link a
+/// compatibility override library at all.
+enum class CompatibilityOverrideSectionState : uint32_t {
+  Unchecked,
+  Absent,
+  Present,
+};
+
+/// Defined in CompatibilityOverride.cpp for each runtime component; updated
+/// by the section lookup that backs the getOverride functions.
+extern std::atomic<CompatibilityOverrideSectionState>
+    CompatibilityOverrideSection;
+
 /// Used to define an override point. The override point #defines the appropriate
 /// OVERRIDE macro from CompatibilityOverride.def to this macro, then includes
 /// the file to generate the override points. The original implementation of the
@@ -193,6 +211,10 @@ namespace swift {
 #define COMPATIBILITY_OVERRIDE(name, ret, attrs, ccAttrs, namespace,           \
                                typedArgs, namedArgs)                           \
   attrs ccAttrs ret namespace swift_##name COMPATIBILITY_PAREN(typedArgs) {    \
+    if (SWIFT_LIKELY(CompatibilityOverrideSection.load(                        \
+                         std::memory_order_relaxed) ==                         \
+                     CompatibilityOverrideSectionState::Absent))               \
+      return swift_##name##Impl COMPATIBILITY_PAREN(namedArgs);                \
     static Override_##name Override;                                           \
     static swift_once_t Predicate;                                             \
     swift_once(                                                                \
@@ -1512,15 +1512,9 @@ void DefaultActorImpl::processIncomingQueue() {
 
 // Called with actor lock held on current thread
 void DefaultActorImpl::handleUnprioritizedJobs(Job *head) {
-  // Reverse jobs from LIFO to FIFO order
-  Job *reversed = nullptr;
-  while (head) {
-    auto next = getNextJob(head);
-    setNextJob(head, reversed);
-    reversed = head;
-    head = next;
-  }
-  prioritizedJobs.enqueueContentsOf(reversed);
+  // The incoming chain is in LIFO order; prepending each job to its priority
+  // bucket restores FIFO order in a single pass over the chain.
+  prioritizedJobs.enqueueContentsOfReversed(head);
 }
 
 // Called with actor lock held on current thread
@@ -10,6 +10,7 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <atomic>
 #include <new>
 
 #include "swift/Runtime/Config.h"
@@ -35,4 +36,103 @@ extern "C" void _swift_async_stream_lock_lock(Mutex &lock) { lock.lock(); }
 
 SWIFT_CC(swift)
 extern "C" void _swift_async_stream_lock_unlock(Mutex &lock) { lock.unlock(); }
+
+// A bounded multi-producer, single-consumer ring of pointer-sized values,
+// in the style of Vyukov's bounded queue. Producers enqueue lock-free; the
+// single consumer dequeues in batches, so a resumer can drain every waiting
+// value with one call instead of taking a lock per element. As with the lock
+// above, the caller allocates the storage: it asks for the size in words,
+// hands us the memory, and addresses it through these entry points only.
+struct RingSlot {
+  std::atomic<size_t> sequence;
+  void *value;
+};
+
+struct Ring {
+  std::atomic<size_t> enqueuePos;
+  // Only read by producers; written by the single consumer.
+  std::atomic<size_t> dequeuePos;
+  size_t mask;
+
+  RingSlot *slots() { return reinterpret_cast<RingSlot *>(this + 1); }
+};
+
+// Round the requested capacity up to a power of two so slot indexing can
+// mask rather than divide. Capacities of 0 and 1 both get a two-slot ring.
+static size_t ringCapacity(size_t requestedCapacity) {
+  size_t capacity = 2;
+  while (capacity < requestedCapacity)
+    capacity <<= 1;
+  return capacity;
+}
+
+// return the size in words of a ring with the given capacity
+SWIFT_CC(swift)
+extern "C" size_t _swift_async_stream_ring_size(size_t requestedCapacity) {
+  size_t bytes =
+      sizeof(Ring) + ringCapacity(requestedCapacity) * sizeof(RingSlot);
+  return (bytes + sizeof(void *) - 1) / sizeof(void *);
+}
+
+SWIFT_CC(swift)
+extern "C" void _swift_async_stream_ring_init(Ring &ring,
+                                              size_t requestedCapacity) {
+  size_t capacity = ringCapacity(requestedCapacity);
+  new (&ring) Ring();
+  ring.enqueuePos.store(0, std::memory_order_relaxed);
+  ring.dequeuePos.store(0, std::memory_order_relaxed);
+  ring.mask = capacity - 1;
+  for (size_t i = 0; i < capacity; ++i) {
+    auto *slot = new (&ring.slots()[i]) RingSlot();
+    slot->sequence.store(i, std::memory_order_relaxed);
+    slot->value = nullptr;
+  }
+}
+
+// Returns false if the ring is full; the caller falls back to its locked
+// overflow path rather than spinning.
+SWIFT_CC(swift)
+extern "C" bool _swift_async_stream_ring_enqueue(Ring &ring, void *value) {
+  size_t pos = ring.enqueuePos.load(std::memory_order_relaxed);
+  for (;;) {
+    RingSlot &slot = ring.slots()[pos & ring.mask];
+    size_t sequence = slot.sequence.load(std::memory_order_acquire);
+    intptr_t difference = (intptr_t)sequence - (intptr_t)pos;
+    if (difference == 0) {
+      if (ring.enqueuePos.compare_exchange_weak(pos, pos + 1,
+                                                std::memory_order_relaxed)) {
+        slot.value = value;
+        slot.sequence.store(pos + 1, std::memory_order_release);
+        return true;
+      }
+    } else if (difference < 0) {
+      return false;
+    } else {
+      pos = ring.enqueuePos.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+// Dequeues up to maxCount values into outValues and returns the number
+// dequeued. Must only be called from one thread at a time; this is the
+// single-consumer half of the contract.
+SWIFT_CC(swift)
+extern "C" size_t _swift_async_stream_ring_dequeue(Ring &ring,
+                                                   void **outValues,
+                                                   size_t maxCount) {
+  size_t count = 0;
+  size_t pos = ring.dequeuePos.load(std::memory_order_relaxed);
+  while (count < maxCount) {
+    RingSlot &slot = ring.slots()[pos & ring.mask];
+    size_t sequence = slot.sequence.load(std::memory_order_acquire);
+    if ((intptr_t)sequence - (intptr_t)(pos + 1) != 0)
+      break;
+    outValues[count++] = slot.value;
+    slot.value = nullptr;
+    slot.sequence.store(pos + ring.mask + 1, std::memory_order_release);
+    ++pos;
+  }
+  ring.dequeuePos.store(pos, std::memory_order_relaxed);
+  return count;
+}
 }
@@ -683,6 +683,7 @@ swift_task_create_commonImpl(size_t rawTaskCreateFlags,
   AsyncLet *asyncLet = nullptr;
   bool hasAsyncLetResultBuffer = false;
   RunInlineTaskOptionRecord *runInlineOption = nullptr;
+  size_t requestedAllocatorCapacity = 0;
   for (auto option = options; option; option = option->getParent()) {
     switch (option->getKind()) {
     case TaskOptionRecordKind::InitialSerialExecutor:
@@ -734,6 +735,11 @@ swift_task_create_commonImpl(size_t rawTaskCreateFlags,
       jobFlags.task_setIsChildTask(true);
       break;
     }
+    case TaskOptionRecordKind::InitialAllocatorCapacity:
+      requestedAllocatorCapacity =
+          cast<InitialAllocatorCapacityTaskOptionRecord>(option)->getCapacity();
+      break;
+
     case TaskOptionRecordKind::RunInline: {
       runInlineOption = cast<RunInlineTaskOptionRecord>(option);
       // TODO (rokhinip): We seem to be creating runInline tasks like detached
@@ -861,6 +867,7 @@ swift_task_create_commonImpl(size_t rawTaskCreateFlags,
       parent, group, futureResultType, initialContextSize);
 
   unsigned initialSlabSize = 512;
+  size_t preflightSlabSize = 0;
 
   void *allocation = nullptr;
   if (asyncLet) {
@@ -897,6 +904,15 @@ swift_task_create_commonImpl(size_t rawTaskCreateFlags,
     assert(amountToAllocate <= runInlineBufferBytes);
     allocation = runInlineOption->getAllocation();
     initialSlabSize = runInlineBufferBytes - amountToAllocate;
+  } else if (requestedAllocatorCapacity > 0) {
+    // The creator supplied an estimate of the task's allocator footprint.
+    // Co-allocate a first slab of at least that capacity with the task, so
+    // a correctly estimated task never has to grow the allocator slab by
+    // slab.
+    preflightSlabSize = llvm::alignTo(
+        TaskAllocator::slabHeaderSize() + requestedAllocatorCapacity,
+        llvm::Align(MaximumAlignment));
+    allocation = malloc(amountToAllocate + preflightSlabSize);
   } else {
     allocation = malloc(amountToAllocate);
   }
@@ -1010,6 +1026,10 @@ swift_task_create_commonImpl(size_t rawTaskCreateFlags,
     void *initialSlab = (char*)allocation + amountToAllocate;
     task->Private.initializeWithSlab(basePriority, initialSlab,
                                      initialSlabSize);
+  } else if (preflightSlabSize > 0) {
+    void *initialSlab = (char*)allocation + amountToAllocate;
+    task->Private.initializeWithSlab(basePriority, initialSlab,
+                                     preflightSlabSize);
   } else {
     task->Private.initialize(basePriority);
   }
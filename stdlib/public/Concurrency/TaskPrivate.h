@@ -826,6 +826,11 @@ struct AsyncTask::PrivateStorage {
       }
     }
 
+    SWIFT_TASK_DEBUG_LOG("task %p allocator grew to %d slabs, %zu bytes "
+                         "capacity",
+                         task, Allocator.getNumAllocatedSlabs(),
+                         Allocator.getTotalSlabCapacity());
+
     // Destroy and deallocate any remaining task local items since the task is
     // completed. We need to do this before we destroy the task local
     // deallocator.
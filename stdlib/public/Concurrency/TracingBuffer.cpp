@@ -0,0 +1,292 @@
+//===--- TracingBuffer.cpp - In-memory task event ring buffer ------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+// A lock-free, per-thread ring buffer of recent task lifecycle events.
+//
+// Each thread that records an event gets its own fixed-size buffer, so the
+// only memory shared between recording threads is a single global sequence
+// counter that provides a total order over events. Recording an event is a
+// relaxed fetch_add plus one entry store into thread-local memory; there is
+// no locking anywhere on the recording path, so it is safe to record from
+// any context the concurrency runtime runs in.
+//
+// swift_task_dumpTraceBuffer walks every thread's buffer and prints the
+// retained events in sequence order. The dump is best-effort: other threads
+// keep recording while it runs, and an entry being overwritten concurrently
+// may print torn values. That is the right trade-off for the intended use,
+// which is reconstructing the recent create/wait/resume history of tasks
+// from a hang or crash report in production.
+//
+//===----------------------------------------------------------------------===//
+
+#include "TracingBuffer.h"
+#include "swift/ABI/Task.h"
+#include "swift/Runtime/Concurrency.h"
+#include "swift/Runtime/EnvironmentVariables.h"
+#include "swift/Threading/ThreadLocalStorage.h"
+#include <atomic>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace swift;
+using namespace swift::concurrency;
+
+namespace {
+
+/// The kind of event a ring buffer entry records.
+enum class EntryKind : uint8_t {
+  Invalid = 0,
+  TaskCreate,
+  TaskDestroy,
+  TaskWait,
+  TaskResume,
+  TaskStatusChanged,
+  JobRunBegin,
+  JobRunEnd,
+};
+
+struct TraceEntry {
+  /// Globally unique, monotonically increasing across all threads. Zero
+  /// means the entry has never been written.
+  uint64_t sequence;
+
+  /// The ID of the task the event is about.
+  uint64_t taskId;
+
+  /// The other task involved, if any: the parent for TaskCreate, the awaited
+  /// task for TaskWait, zero otherwise.
+  uint64_t otherId;
+
+  EntryKind kind;
+
+  /// The job priority for TaskCreate, the max priority for
+  /// TaskStatusChanged, zero otherwise.
+  uint8_t priority;
+
+  /// For TaskStatusChanged: bit 0 is isCancelled, bit 1 is isEscalated.
+  uint8_t flags;
+};
+
+/// The number of events retained per thread. The buffer for a thread is
+/// allocated lazily on its first event, so threads that never touch the
+/// concurrency runtime cost nothing.
+constexpr uint32_t EntriesPerThread = 256;
+
+struct TraceBuffer {
+  /// Links the global registry of buffers; only written when a buffer is
+  /// created. Buffers are never unlinked or freed: a buffer whose thread
+  /// has exited keeps its events visible to swift_task_dumpTraceBuffer,
+  /// which is exactly what a post-mortem dump wants.
+  TraceBuffer *next;
+
+  /// Only written by the owning thread.
+  uint32_t nextIndex;
+
+  TraceEntry entries[EntriesPerThread];
+};
+
+// Match the idiom in Actor.cpp for pointer-valued thread-locals.
+template <class T>
+struct Pointer {
+  T *Value;
+  constexpr Pointer() : Value(nullptr) {}
+  constexpr Pointer(T *value) : Value(value) {}
+  operator T *() const { return Value; }
+  T *operator->() const { return Value; }
+};
+
+} // end anonymous namespace
+
+static SWIFT_THREAD_LOCAL_TYPE(Pointer<TraceBuffer>,
+                               tls_key::concurrency_trace_buffer)
+    ThreadBuffer;
+
+/// The head of the registry of all per-thread buffers ever created.
+static std::atomic<TraceBuffer *> BufferRegistry{nullptr};
+
+/// The global event sequence. This is the only cache line recording threads
+/// share, and it is only touched with relaxed atomics.
+static std::atomic<uint64_t> NextSequence{1};
+
+static bool isBufferTracingEnabled() {
+#if SWIFT_STDLIB_HAS_ENVIRON && !SWIFT_CONCURRENCY_EMBEDDED
+  return runtime::environment::concurrencyTaskTraceBufferEnabled();
+#else
+  return true;
+#endif
+}
+
+static TraceBuffer *getOrCreateThreadBuffer() {
+  TraceBuffer *buffer = ThreadBuffer.get();
+  if (buffer)
+    return buffer;
+
+  if (!isBufferTracingEnabled())
+    return nullptr;
+
+  buffer = static_cast<TraceBuffer *>(calloc(1, sizeof(TraceBuffer)));
+  if (!buffer)
+    return nullptr;
+
+  // Push onto the registry with a lock-free CAS loop.
+  buffer->next = BufferRegistry.load(std::memory_order_relaxed);
+  while (!BufferRegistry.compare_exchange_weak(buffer->next, buffer,
+                                               std::memory_order_release,
+                                               std::memory_order_relaxed)) {
+  }
+
+  ThreadBuffer.set(buffer);
+  return buffer;
+}
+
+static void record(EntryKind kind, uint64_t taskId, uint64_t otherId = 0,
+                   uint8_t priority = 0, uint8_t flags = 0) {
+  TraceBuffer *buffer = getOrCreateThreadBuffer();
+  if (!buffer)
+    return;
+
+  TraceEntry &entry = buffer->entries[buffer->nextIndex % EntriesPerThread];
+  buffer->nextIndex++;
+
+  entry.sequence = NextSequence.fetch_add(1, std::memory_order_relaxed);
+  entry.taskId = taskId;
+  entry.otherId = otherId;
+  entry.kind = kind;
+  entry.priority = priority;
+  entry.flags = flags;
+}
+
+void trace::buffer_task_create(AsyncTask *task, AsyncTask *parent,
+                               uint8_t jobPriority) {
+  record(EntryKind::TaskCreate, task->getTaskId(),
+         parent ? parent->getTaskId() : 0, jobPriority);
+}
+
+void trace::buffer_task_destroy(AsyncTask *task) {
+  record(EntryKind::TaskDestroy, task->getTaskId());
+}
+
+void trace::buffer_task_wait(AsyncTask *task, AsyncTask *waitingOn) {
+  record(EntryKind::TaskWait, task->getTaskId(),
+         waitingOn ? waitingOn->getTaskId() : 0);
+}
+
+void trace::buffer_task_resume(AsyncTask *task) {
+  record(EntryKind::TaskResume, task->getTaskId());
+}
+
+void trace::buffer_task_status_changed(AsyncTask *task, uint8_t maxPriority,
+                                       bool isCancelled, bool isEscalated) {
+  uint8_t flags = (isCancelled ? 1 : 0) | (isEscalated ? 2 : 0);
+  record(EntryKind::TaskStatusChanged, task->getTaskId(), 0, maxPriority,
+         flags);
+}
+
+uint64_t trace::buffer_job_run_begin(Job *job) {
+  if (AsyncTask *task = dyn_cast<AsyncTask>(job)) {
+    auto taskId = task->getTaskId();
+    record(EntryKind::JobRunBegin, taskId);
+    return taskId;
+  }
+  return 0;
+}
+
+void trace::buffer_job_run_end(uint64_t taskId) {
+  record(EntryKind::JobRunEnd, taskId);
+}
+
+static const char *entryKindName(EntryKind kind) {
+  switch (kind) {
+  case EntryKind::Invalid:
+    return "invalid";
+  case EntryKind::TaskCreate:
+    return "task_create";
+  case EntryKind::TaskDestroy:
+    return "task_destroy";
+  case EntryKind::TaskWait:
+    return "task_wait";
+  case EntryKind::TaskResume:
+    return "task_resume";
+  case EntryKind::TaskStatusChanged:
+    return "task_status_changed";
+  case EntryKind::JobRunBegin:
+    return "job_run_begin";
+  case EntryKind::JobRunEnd:
+    return "job_run_end";
+  }
+  return "unknown";
+}
+
+static void dumpEntry(unsigned threadIndex, const TraceEntry &entry) {
+  fprintf(stderr, "  [%" PRIu64 "] thread#%u %s task=%" PRIx64, entry.sequence,
+          threadIndex, entryKindName(entry.kind), entry.taskId);
+  switch (entry.kind) {
+  case EntryKind::TaskCreate:
+    fprintf(stderr, " parent=%" PRIx64 " priority=%u", entry.otherId,
+            entry.priority);
+    break;
+  case EntryKind::TaskWait:
+    fprintf(stderr, " waitingOn=%" PRIx64, entry.otherId);
+    break;
+  case EntryKind::TaskStatusChanged:
+    fprintf(stderr, " maxPriority=%u isCancelled=%d isEscalated=%d",
+            entry.priority, (entry.flags & 1) != 0, (entry.flags & 2) != 0);
+    break;
+  default:
+    break;
+  }
+  fprintf(stderr, "\n");
+}
+
+SWIFT_EXPORT_FROM(swift_Concurrency) SWIFT_CC(swift)
+void swift_task_dumpTraceBuffer(void) {
+  // Snapshot the registry head; buffers pushed after this point are not
+  // included. Print each buffer's entries in sequence order by repeatedly
+  // scanning for the smallest sequence we have not printed yet. The scan is
+  // quadratic in the number of retained events, which is fine for a
+  // diagnostic dump over small fixed-size buffers.
+  TraceBuffer *head = BufferRegistry.load(std::memory_order_acquire);
+
+  unsigned bufferCount = 0;
+  for (TraceBuffer *buffer = head; buffer; buffer = buffer->next)
+    bufferCount++;
+
+  fprintf(stderr, "Swift task trace buffer: %u thread buffer(s)\n",
+          bufferCount);
+
+  uint64_t lastPrinted = 0;
+  while (true) {
+    const TraceEntry *best = nullptr;
+    unsigned bestThread = 0;
+
+    unsigned threadIndex = 0;
+    for (TraceBuffer *buffer = head; buffer;
+         buffer = buffer->next, threadIndex++) {
+      for (uint32_t i = 0; i != EntriesPerThread; ++i) {
+        const TraceEntry &entry = buffer->entries[i];
+        if (entry.sequence <= lastPrinted)
+          continue;
+        if (!best || entry.sequence < best->sequence) {
+          best = &entry;
+          bestThread = threadIndex;
+        }
+      }
+    }
+
+    if (!best)
+      break;
+
+    lastPrinted = best->sequence;
+    dumpEntry(bestThread, *best);
+  }
+}
@@ -0,0 +1,64 @@
+//===--- TracingBuffer.h - In-memory task event ring buffer --------*- C++ -*-//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+// An always-available, in-memory ring buffer of task lifecycle events. Unlike
+// the signpost tracing in TracingSignpost.h, which requires an external
+// observer to be attached before the events of interest occur, the ring buffer
+// retains the most recent task create/wait/resume/run edges on every thread so
+// they can be dumped after the fact, e.g. from a hang or crash handler in
+// production. It is available on all platforms, independent of
+// SWIFT_STDLIB_CONCURRENCY_TRACING.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef SWIFT_CONCURRENCY_TRACINGBUFFER_H
+#define SWIFT_CONCURRENCY_TRACINGBUFFER_H
+
+#include <stdint.h>
+
+namespace swift {
+class AsyncTask;
+class Job;
+
+namespace concurrency {
+namespace trace {
+
+// Ring buffer trace calls. These take the same arguments as the corresponding
+// tracing hooks in Tracing.h and are invoked from both tracing backends, so
+// recording works whether or not signpost tracing is compiled in. Each call is
+// a single entry written into the calling thread's ring buffer; recording
+// never blocks and never allocates after a thread's buffer is created.
+
+void buffer_task_create(AsyncTask *task, AsyncTask *parent,
+                        uint8_t jobPriority);
+
+void buffer_task_destroy(AsyncTask *task);
+
+void buffer_task_wait(AsyncTask *task, AsyncTask *waitingOn);
+
+void buffer_task_resume(AsyncTask *task);
+
+void buffer_task_status_changed(AsyncTask *task, uint8_t maxPriority,
+                                bool isCancelled, bool isEscalated);
+
+// Returns the ID of the task that started running, or 0 if the job is not a
+// task. Pass the returned value to buffer_job_run_end; a zero taskId there
+// pairs the entry with the preceding job_run_begin on the same thread.
+uint64_t buffer_job_run_begin(Job *job);
+
+void buffer_job_run_end(uint64_t taskId);
+
+} // namespace trace
+} // namespace concurrency
+} // namespace swift
+
+#endif
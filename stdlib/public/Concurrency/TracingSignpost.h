@@ -19,6 +19,7 @@
 
 #include "TaskPrivate.h"
 #include "Tracing.h"
+#include "TracingBuffer.h"
 #include "swift/ABI/Task.h"
 #include "swift/Basic/Lazy.h"
 #include "swift/Runtime/Casting.h"
@@ -183,6 +184,7 @@ inline void task_create(AsyncTask *task, AsyncTask *parent, TaskGroup *group,
                         AsyncLet *asyncLet, uint8_t jobPriority,
                         bool isChildTask, bool isFuture, bool isGroupChildTask,
                         bool isAsyncLetTask) {
+  buffer_task_create(task, parent, jobPriority);
   ENSURE_LOGS();
   auto id = os_signpost_id_make_with_pointer(TaskLog, task);
   auto parentID = parent ? parent->getTaskId() : 0;
@@ -198,6 +200,7 @@ inline void task_create(AsyncTask *task, AsyncTask *parent, TaskGroup *group,
 }
 
 inline void task_destroy(AsyncTask *task) {
+  buffer_task_destroy(task);
   ENSURE_LOGS();
   auto id = os_signpost_id_make_with_pointer(TaskLog, task);
   os_signpost_interval_end(TaskLog, id, SWIFT_LOG_TASK_LIFETIME_NAME,
@@ -207,6 +210,7 @@ inline void task_destroy(AsyncTask *task) {
 inline void task_status_changed(AsyncTask *task, uint8_t maxPriority,
                                 bool isCancelled, bool isEscalated,
                                 bool isStarting, bool isRunning, bool isEnqueued) {
+  buffer_task_status_changed(task, maxPriority, isCancelled, isEscalated);
   ENSURE_LOGS();
   auto id = os_signpost_id_make_with_pointer(TaskLog, task);
   os_signpost_event_emit(
@@ -232,6 +236,7 @@ inline void task_flags_changed(AsyncTask *task, uint8_t jobPriority,
 }
 
 inline void task_wait(AsyncTask *task, AsyncTask *waitingOn, uintptr_t status) {
+  buffer_task_wait(task, waitingOn);
   ENSURE_LOGS();
   auto id = os_signpost_id_make_with_pointer(TaskLog, task);
   auto waitingID = waitingOn ? waitingOn->getTaskId() : 0;
@@ -242,6 +247,7 @@ inline void task_wait(AsyncTask *task, AsyncTask *waitingOn, uintptr_t status) {
 }
 
 inline void task_resume(AsyncTask *task) {
+  buffer_task_resume(task);
   auto id = os_signpost_id_make_with_pointer(TaskLog, task);
   os_signpost_interval_end(TaskLog, id, SWIFT_LOG_TASK_WAIT_NAME,
                            "task=%" PRIx64, task->getTaskId());
@@ -301,8 +307,9 @@ inline void job_enqueue_main_executor(Job *job) {
 }
 
 inline job_run_info job_run_begin(Job *job) {
-  auto invalidInfo = []{
-    return job_run_info{ 0, OS_SIGNPOST_ID_INVALID };
+  auto bufferTaskId = buffer_job_run_begin(job);
+  auto invalidInfo = [=]{
+    return job_run_info{ bufferTaskId, OS_SIGNPOST_ID_INVALID };
   };
 
   if (AsyncTask *task = dyn_cast<AsyncTask>(job)) {
@@ -317,6 +324,8 @@ inline job_run_info job_run_begin(Job *job) {
 }
 
 inline void job_run_end(job_run_info info) {
+  if (info.taskId)
+    buffer_job_run_end(info.taskId);
   if (info.handle != OS_SIGNPOST_ID_INVALID) {
     ENSURE_LOGS();
     os_signpost_interval_end(TaskLog, info.handle, SWIFT_LOG_JOB_RUN_NAME,
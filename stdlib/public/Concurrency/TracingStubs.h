@@ -10,7 +10,9 @@
 //
 //===----------------------------------------------------------------------===//
 //
-// Concurrency tracing stubs for OSes without tracing support.
+// Concurrency tracing stubs for OSes without tracing support. Only the
+// external tracing is stubbed out; the in-memory trace ring buffer is still
+// recorded here.
 //
 //===----------------------------------------------------------------------===//
 
@@ -18,6 +20,7 @@
 #define SWIFT_CONCURRENCY_TRACINGSIGNPOST_H
 
 #include "Tracing.h"
+#include "TracingBuffer.h"
 
 namespace swift {
 namespace concurrency {
@@ -44,18 +47,23 @@ inline void actor_note_job_queue(HeapObject *actor, Job *first,
 inline void task_create(AsyncTask *task, AsyncTask *parent, TaskGroup *group,
                         AsyncLet *asyncLet, uint8_t jobPriority,
                         bool isChildTask, bool isFuture, bool isGroupChildTask,
-                        bool isAsyncLetTask) {}
+                        bool isAsyncLetTask) {
+  buffer_task_create(task, parent, jobPriority);
+}
 
-inline void task_destroy(AsyncTask *task) {}
+inline void task_destroy(AsyncTask *task) { buffer_task_destroy(task); }
 
 inline void task_wait(AsyncTask *task, AsyncTask *waitingOn, uintptr_t status) {
+  buffer_task_wait(task, waitingOn);
 }
 
-inline void task_resume(AsyncTask *task) {}
+inline void task_resume(AsyncTask *task) { buffer_task_resume(task); }
 
 inline void task_status_changed(AsyncTask *task, uint8_t maxPriority,
                                 bool isCancelled, bool isEscalated,
-                                bool isStarting, bool isRunning, bool isEnqueued) {}
+                                bool isStarting, bool isRunning, bool isEnqueued) {
+  buffer_task_status_changed(task, maxPriority, isCancelled, isEscalated);
+}
 
 inline void task_flags_changed(AsyncTask *task, uint8_t jobPriority,
                                bool isChildTask, bool isFuture,
@@ -75,9 +83,14 @@ inline void job_enqueue_global_with_delay(unsigned long long delay, Job *job) {}
 
 inline void job_enqueue_main_executor(Job *job) {}
 
-inline job_run_info job_run_begin(Job *job) { return {}; }
+inline job_run_info job_run_begin(Job *job) {
+  return {buffer_job_run_begin(job), 0};
+}
 
-inline void job_run_end(job_run_info info) {}
+inline void job_run_end(job_run_info info) {
+  if (info.taskId)
+    buffer_job_run_end(info.taskId);
+}
 
 } // namespace trace
 } // namespace concurrency
@@ -19,6 +19,7 @@
 #include "swift/ABI/Metadata.h"
 #include "swift/Runtime/AccessibleFunction.h"
 #include "swift/Runtime/Concurrency.h"
+#include "swift/Runtime/Heap.h"
 
 using namespace swift;
 
@@ -41,6 +42,40 @@ void *swift_distributed_getGenericEnvironment(const char *targetNameStart,
   return accessor ? accessor->GenericEnvironment.get() : nullptr;
 }
 
+/// func _invocationBufferAllocate(
+///     _ size: Int, _ alignMask: Int) -> UnsafeMutableRawPointer
+///
+/// Allocate per-invocation scratch memory for `executeDistributedTarget`.
+/// Invocation buffers live exactly for the duration of one distributed target
+/// invocation, so they are carved out of the invoking task's allocator -- a
+/// pooled, stack-disciplined slab -- instead of the malloc heap. Allocations
+/// must be deallocated in reverse allocation order, from the same task that
+/// allocated them. Over-aligned requests, and requests made outside of a
+/// task, fall back to the heap.
+SWIFT_CC(swift)
+SWIFT_EXPORT_FROM(swiftDistributed)
+void *swift_distributed_invocationBufferAllocate(size_t size,
+                                                 size_t alignMask) {
+  if (alignMask < MaximumAlignment && swift_task_getCurrent())
+    return swift_task_alloc(size);
+  return swift_slowAlloc(size, alignMask);
+}
+
+/// func _invocationBufferDeallocate(
+///     _ buffer: UnsafeMutableRawPointer, _ size: Int, _ alignMask: Int)
+///
+/// Return memory obtained from `swift_distributed_invocationBufferAllocate`.
+/// \p size and \p alignMask must match the values the buffer was allocated
+/// with.
+SWIFT_CC(swift)
+SWIFT_EXPORT_FROM(swiftDistributed)
+void swift_distributed_invocationBufferDeallocate(void *buffer, size_t size,
+                                                  size_t alignMask) {
+  if (alignMask < MaximumAlignment && swift_task_getCurrent())
+    return swift_task_dealloc(buffer);
+  swift_slowDealloc(buffer, size, alignMask);
+}
+
 /// func _executeDistributedTarget<D: DistributedTargetInvocationDecoder>(
 ///    on: AnyObject,
 ///    _ targetName: UnsafePointer<UInt8>,
@@ -445,11 +445,17 @@ extension DistributedActorSystem {
       }
 
     var substitutionsBuffer: UnsafeMutablePointer<Any.Type>? = nil
+    var substitutionsCount: Int = 0
     var witnessTablesBuffer: UnsafeRawPointer? = nil
     var numWitnessTables: Int = 0
 
     defer {
-      substitutionsBuffer?.deallocate()
+      if let substitutionsBuffer = substitutionsBuffer {
+        _invocationBufferDeallocate(
+          UnsafeMutableRawPointer(substitutionsBuffer),
+          MemoryLayout<Any.Type>.stride * substitutionsCount,
+          MemoryLayout<Any.Type>.alignment - 1)
+      }
       witnessTablesBuffer?.deallocate()
     }
 
@@ -461,7 +467,11 @@ extension DistributedActorSystem {
           errorCode: .missingGenericSubstitutions)
       }
 
-      substitutionsBuffer = .allocate(capacity: subs.count)
+      substitutionsBuffer = _invocationBufferAllocate(
+        MemoryLayout<Any.Type>.stride * subs.count,
+        MemoryLayout<Any.Type>.alignment - 1
+      ).bindMemory(to: Any.Type.self, capacity: subs.count)
+      substitutionsCount = subs.count
 
       for (offset, substitution) in subs.enumerated() {
         let element = substitutionsBuffer?.advanced(by: offset)
@@ -495,10 +505,17 @@ extension DistributedActorSystem {
     }
 
     // Prepare buffer for the parameter types to be decoded into:
-    let argumentTypesBuffer = UnsafeMutableBufferPointer<Any.Type>.allocate(capacity: Int(paramCount))
+    let argumentTypesSize = MemoryLayout<Any.Type>.stride * Int(paramCount)
+    let argumentTypesRaw = _invocationBufferAllocate(
+      argumentTypesSize, MemoryLayout<Any.Type>.alignment - 1)
     defer {
-      argumentTypesBuffer.deallocate()
+      _invocationBufferDeallocate(
+        argumentTypesRaw, argumentTypesSize,
+        MemoryLayout<Any.Type>.alignment - 1)
     }
+    let argumentTypesBuffer = UnsafeMutableBufferPointer<Any.Type>(
+      start: argumentTypesRaw.bindMemory(to: Any.Type.self, capacity: Int(paramCount)),
+      count: Int(paramCount))
 
     // Demangle and write all parameter types into the prepared buffer
     let decodedNum = targetNameUTF8.withUnsafeBufferPointer { targetNameUTF8 in
@@ -532,7 +549,9 @@ extension DistributedActorSystem {
 
     // Decode the return type
     func allocateReturnTypeBuffer<R>(_: R.Type) -> UnsafeRawPointer? {
-      return UnsafeRawPointer(UnsafeMutablePointer<R>.allocate(capacity: 1))
+      return UnsafeRawPointer(
+        _invocationBufferAllocate(
+          MemoryLayout<R>.stride, MemoryLayout<R>.alignment - 1))
     }
 
     let maybeReturnTypeFromTypeInfo =
@@ -556,7 +575,9 @@ extension DistributedActorSystem {
     }
 
     func destroyReturnTypeBuffer<R>(_: R.Type) {
-      resultBuffer.assumingMemoryBound(to: R.self).deallocate()
+      _invocationBufferDeallocate(
+        UnsafeMutableRawPointer(mutating: resultBuffer),
+        MemoryLayout<R>.stride, MemoryLayout<R>.alignment - 1)
     }
 
     defer {
@@ -632,6 +653,26 @@ public struct RemoteCallTarget: CustomStringConvertible, Hashable {
   }
 }
 
+/// Allocates per-invocation scratch memory for `executeDistributedTarget`.
+///
+/// Invocation buffers are carved out of the invoking task's allocator rather
+/// than the malloc heap, so they must be returned with
+/// `_invocationBufferDeallocate` in reverse allocation order, from the same
+/// task that allocated them.
+@available(SwiftStdlib 5.7, *)
+@_silgen_name("swift_distributed_invocationBufferAllocate")
+func _invocationBufferAllocate(
+  _ size: Int, _ alignMask: Int
+) -> UnsafeMutableRawPointer
+
+/// Returns memory obtained from `_invocationBufferAllocate`. The size and
+/// alignment mask must match the values the buffer was allocated with.
+@available(SwiftStdlib 5.7, *)
+@_silgen_name("swift_distributed_invocationBufferDeallocate")
+func _invocationBufferDeallocate(
+  _ buffer: UnsafeMutableRawPointer, _ size: Int, _ alignMask: Int
+)
+
 @available(SwiftStdlib 5.7, *)
 @_silgen_name("swift_distributed_execute_target")
 func _executeDistributedTarget<D: DistributedTargetInvocationDecoder>(
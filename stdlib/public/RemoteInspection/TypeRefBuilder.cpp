@@ -335,6 +335,14 @@ TypeRefBuilder::ReflectionTypeDescriptorFinder::getFieldTypeInfo(
   if (auto FD = getFieldDescriptorFromExternalCache(*MangledName))
     return *FD;
 
+  // A lookup that already failed against the current set of reflection infos
+  // will fail again; searching would rescan every image. Heap snapshots
+  // resolve the same descriptorless types (e.g. imported C types) repeatedly.
+  auto Negative = NegativeFieldTypeInfoCache.find(*MangledName);
+  if (Negative != NegativeFieldTypeInfoCache.end() &&
+      Negative->second == ReflectionInfos.size())
+    return nullptr;
+
   // Heuristic: find the outermost Module node available, and try to parse the
   // ReflectionInfos with a matching name first.
   auto ModuleName = FindOutermostModuleName(Node);
@@ -372,6 +380,7 @@ TypeRefBuilder::ReflectionTypeDescriptorFinder::getFieldTypeInfo(
     if (auto FD = findFieldDescriptorAtIndex(i, *MangledName))
       return *FD;
 
+  NegativeFieldTypeInfoCache[*MangledName] = ReflectionInfos.size();
   return nullptr;
 }
 
@@ -968,6 +968,11 @@ class RefCounts {
       return bits.getIsDeiniting();
   }
 
+  // Return true if the object will never be deallocated.
+  bool isImmortal(bool checkSlowRCBit) const {
+    return refCounts.load(SWIFT_MEMORY_ORDER_CONSUME).isImmortal(checkSlowRCBit);
+  }
+
   bool hasSideTable() const {
     auto bits = refCounts.load(SWIFT_MEMORY_ORDER_CONSUME);
     return bits.hasSideTable();
@@ -1331,6 +1336,12 @@ inline uint32_t RefCounts<InlineRefCountBits>::getWeakCount() const;
 template <>
 inline uint32_t RefCounts<SideTableRefCountBits>::getWeakCount() const;
 
+// Return a side table entry's memory to the sharded side table pool.
+// Entries are allocated by RefCounts<InlineRefCountBits>::allocateSideTable()
+// and both live in RefCount.cpp.
+extern "C" SWIFT_RUNTIME_STDLIB_INTERNAL
+void _swift_sideTableEntryFree(void *entry);
+
 class HeapObjectSideTableEntry {
   // FIXME: does object need to be atomic?
   std::atomic<HeapObject*> object;
@@ -1466,6 +1477,11 @@ class HeapObjectSideTableEntry {
     // The check here is merely an optimization.
     if (refCounts.isDeiniting())
       return nullptr;
+    // An immortal object never deallocates, so its side table is never
+    // cleaned up. Leave the weak refcount saturated instead of contending
+    // on it for every weak reference to a hot immortal object.
+    if (refCounts.isImmortal(false))
+      return this;
     refCounts.incrementWeak();
     return this;
   }
@@ -1473,6 +1489,8 @@ class HeapObjectSideTableEntry {
   void decrementWeak() {
     // FIXME: assertions
     // FIXME: optimize barriers
+    if (refCounts.isImmortal(false))
+      return;
     bool cleanup = refCounts.decrementWeakShouldCleanUp();
     if (!cleanup)
       return;
@@ -1480,12 +1498,15 @@ class HeapObjectSideTableEntry {
     // Weak ref count is now zero. Delete the side table entry.
     // FREED -> DEAD
     assert(refCounts.getUnownedCount() == 0);
-    swift_cxx_deleteObject(this);
+    this->~HeapObjectSideTableEntry();
+    _swift_sideTableEntryFree(this);
   }
 
   void decrementWeakNonAtomic() {
     // FIXME: assertions
     // FIXME: optimize barriers
+    if (refCounts.isImmortal(false))
+      return;
     bool cleanup = refCounts.decrementWeakShouldCleanUpNonAtomic();
     if (!cleanup)
       return;
@@ -1493,7 +1514,8 @@ class HeapObjectSideTableEntry {
     // Weak ref count is now zero. Delete the side table entry.
     // FREED -> DEAD
     assert(refCounts.getUnownedCount() == 0);
-    swift_cxx_deleteObject(this);
+    this->~HeapObjectSideTableEntry();
+    _swift_sideTableEntryFree(this);
   }
 
   uint32_t getWeakCount() const {
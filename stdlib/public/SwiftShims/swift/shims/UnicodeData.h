@@ -54,6 +54,10 @@ SWIFT_RUNTIME_STDLIB_INTERNAL
 __swift_uint32_t _swift_stdlib_getComposition(__swift_uint32_t x,
                                               __swift_uint32_t y);
 
+SWIFT_RUNTIME_STDLIB_INTERNAL
+__swift_intptr_t _swift_stdlib_nfcFastPathLength(const __swift_uint8_t *buffer,
+                                                 __swift_intptr_t count);
+
 //===----------------------------------------------------------------------===//
 // Grapheme Breaking
 //===----------------------------------------------------------------------===//
@@ -1171,15 +1171,13 @@ extension _StringGutsSlice {
         // If our first byte is less than 0xCC, then it means we're under the
         // 0x300 scalar value and everything up to 0x300 is NFC already.
         if utf8[position] < 0xCC {
-          // If our first byte is less than 0xC0, then it means it is ASCII
-          // and only takes up a single byte.
-          if utf8[position] < 0xC0 {
-            position &+= 1
-          } else {
-            // Otherwise, this is a 2 byte < 0x300 sequence.
-            position &+= 2
-          }
-          // ASCII always has ccc of 0.
+          // Let the vectorized shim scan the whole run of such bytes at once.
+          // Any byte >= 0xCC is a lead byte, so the scan always stops on a
+          // scalar boundary.
+          position &+= _swift_stdlib_nfcFastPathLength(
+            utf8.baseAddress._unsafelyUnwrappedUnchecked + position,
+            utf8.count &- position)
+          // Scalars below 0x300 always have ccc of 0.
           prevCCC = 0
 
           continue
@@ -59,6 +59,43 @@ static void array_pod_copy(ArrayCopy copyKind, OpaqueValue *dest,
   memmove(dest, src, stride * count);
 }
 
+/// Initialize an array of native object references by copying, batching
+/// runs of identical references into a single retain-by-n. Arrays built
+/// from a repeated element collapse into one atomic operation.
+static void array_native_reference_init_with_copy(ArrayCopy copyKind,
+                                                  OpaqueValue *dest,
+                                                  OpaqueValue *src,
+                                                  size_t count) {
+  auto **srcRefs = reinterpret_cast<HeapObject **>(src);
+
+  // Retain before writing the destination in case the regions alias.
+  for (size_t i = 0; i < count;) {
+    auto *object = srcRefs[i];
+    size_t runLength = 1;
+    while (i + runLength < count && srcRefs[i + runLength] == object)
+      ++runLength;
+    swift_retain_n(object, runLength);
+    i += runLength;
+  }
+
+  array_pod_copy(copyKind, dest, src, sizeof(HeapObject *), count);
+}
+
+/// Destroy an array of native object references, batching runs of
+/// identical references into a single release-by-n.
+static void array_native_reference_destroy(OpaqueValue *begin, size_t count) {
+  auto **refs = reinterpret_cast<HeapObject **>(begin);
+
+  for (size_t i = 0; i < count;) {
+    auto *object = refs[i];
+    size_t runLength = 1;
+    while (i + runLength < count && refs[i + runLength] == object)
+      ++runLength;
+    swift_release_n(object, runLength);
+    i += runLength;
+  }
+}
+
 namespace {
 typedef OpaqueValue *(*const WitnessFunction)(OpaqueValue *, OpaqueValue *,
                                               const Metadata *);
@@ -92,6 +129,15 @@ static void array_copy_operation(OpaqueValue *dest, OpaqueValue *src,
   auto wtable = self->getValueWitnesses();
   auto stride = wtable->getStride();
 
+  // Elements that are single native object references can be copied with
+  // a memcpy plus retains, and runs of equal references amortize into a
+  // single retain-by-n.
+  if (destOp == ArrayDest::Init && srcOp == ArraySource::Copy &&
+      wtable == &VALUE_WITNESS_SYM(Bo)) {
+    array_native_reference_init_with_copy(copyKind, dest, src, count);
+    return;
+  }
+
   // If we are doing a copy we need PODness for a memcpy.
   if (srcOp == ArraySource::Copy) {
     auto isPOD = wtable->isPOD();
@@ -212,6 +258,10 @@ void swift_arrayDestroy(OpaqueValue *begin, size_t count, const Metadata *self)
   if (wtable->isPOD())
     return;
 
+  // Batch runs of equal native references into a single release-by-n.
+  if (wtable == &VALUE_WITNESS_SYM(Bo))
+    return array_native_reference_destroy(begin, count);
+
   auto stride = wtable->getStride();
   if (self->hasLayoutString()) {
       return swift_generic_arrayDestroy(begin, count, stride, self);
@@ -22,9 +22,11 @@
 #include "WeakReference.h"
 #include "swift/ABI/MetadataValues.h"
 #include "swift/ABI/System.h"
+#include "swift/Runtime/EnvironmentVariables.h"
 #include "swift/Runtime/Error.h"
 #include "swift/Runtime/HeapObject.h"
 #include "llvm/Support/SwapByteOrder.h"
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <limits>
@@ -40,6 +42,49 @@
 
 using namespace swift;
 
+// The direct-threaded dispatch loop relies on clang's address-of-label
+// extension and the nomerge attribute to keep one indirect branch per
+// opcode. It is a measured win on arm64-class cores; other targets use the
+// table-driven interpreter loop below.
+#if defined(__clang__) && (defined(__arm64__) || defined(__aarch64__))
+#define SWIFT_LAYOUT_STRING_THREADED_DISPATCH 1
+#else
+#define SWIFT_LAYOUT_STRING_THREADED_DISPATCH 0
+#endif
+
+// Per-path call counters for the layout string witnesses, used by the
+// benchmark suite and by performance investigations to confirm which values
+// actually go through the bytecode interpreter. Counting is off unless
+// SWIFT_DEBUG_ENABLE_LAYOUT_STRING_STATS is set so the hot paths only pay
+// for a load and a well-predicted branch.
+static struct {
+  std::atomic<uint64_t> destroy{0};
+  std::atomic<uint64_t> initWithCopy{0};
+  std::atomic<uint64_t> initWithTake{0};
+  std::atomic<uint64_t> assignWithCopy{0};
+  std::atomic<uint64_t> assignWithTake{0};
+} layoutStringWitnessCounters;
+
+static inline void countWitnessCall(std::atomic<uint64_t> &counter) {
+  if (SWIFT_UNLIKELY(
+          runtime::environment::SWIFT_DEBUG_ENABLE_LAYOUT_STRING_STATS()))
+    counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+extern "C" void
+swift_generic_readLayoutStringWitnessStats(LayoutStringWitnessStats *result) {
+  result->destroy =
+      layoutStringWitnessCounters.destroy.load(std::memory_order_relaxed);
+  result->initWithCopy =
+      layoutStringWitnessCounters.initWithCopy.load(std::memory_order_relaxed);
+  result->initWithTake =
+      layoutStringWitnessCounters.initWithTake.load(std::memory_order_relaxed);
+  result->assignWithCopy = layoutStringWitnessCounters.assignWithCopy.load(
+      std::memory_order_relaxed);
+  result->assignWithTake = layoutStringWitnessCounters.assignWithTake.load(
+      std::memory_order_relaxed);
+}
+
 static Metadata *getExistentialTypeMetadata(OpaqueValue *object) {
   return reinterpret_cast<Metadata**>(object)[NumWords_ValueBuffer];
 }
@@ -97,7 +142,7 @@ static uint64_t readTagBytes(const uint8_t *addr, uint8_t byteCount) {
   }
 }
 
-#if defined(__APPLE__) && defined(__arm64__)
+#if SWIFT_LAYOUT_STRING_THREADED_DISPATCH
 
 #define CONTINUE_WITH_COPY(METADATA, READER, ADDR_OFFSET, DEST, SRC)           \
   do {                                                                         \
@@ -259,9 +304,23 @@ static void errorDestroy(const Metadata *metadata, LayoutStringReader1 &reader,
 static void nativeStrongDestroy(const Metadata *metadata,
                                 LayoutStringReader1 &reader,
                                 uintptr_t &addrOffset, uint8_t *addr) {
-  HeapObject *object = (HeapObject*)((*(uintptr_t *)(addr + addrOffset)) & ~_swift_abi_SwiftSpareBitsMask);
-  addrOffset += sizeof(HeapObject*);
-  swift_release(object);
+  uintptr_t _addrOffset = addrOffset;
+  // Fuse runs of strong references into a single loop instead of going
+  // through the dispatcher for every pointer. Aggregates of class references
+  // are common enough that this pays for the peek at the next opcode.
+  while (true) {
+    HeapObject *object = (HeapObject *)((*(uintptr_t *)(addr + _addrOffset)) &
+                                        ~_swift_abi_SwiftSpareBitsMask);
+    _addrOffset += sizeof(HeapObject *);
+    swift_release(object);
+
+    uint64_t nextTag = reader.peekBytes<uint64_t>();
+    if ((nextTag >> 56) != (uint64_t)RefCountingKind::NativeStrong)
+      break;
+    reader.skip(sizeof(uint64_t));
+    _addrOffset += (nextTag & ~(0xFFULL << 56));
+  }
+  addrOffset = _addrOffset;
 }
 
 static void unownedDestroy(const Metadata *metadata,
@@ -872,12 +931,13 @@ static void handleRefCountsDestroy(const Metadata *metadata,
 
 extern "C" void
 swift_generic_destroy(swift::OpaqueValue *address, const Metadata *metadata) {
+  countWitnessCall(layoutStringWitnessCounters.destroy);
   const uint8_t *layoutStr = metadata->getLayoutString();
   LayoutStringReader1 reader{layoutStr + layoutStringHeaderSize};
   uintptr_t addrOffset = 0;
   uint8_t *addr = (uint8_t *)address;
 
-#if defined(__APPLE__) && defined(__arm64__)
+#if SWIFT_LAYOUT_STRING_THREADED_DISPATCH
   handleRefCounts(destroyTable, CONTINUE_NO_COPY, metadata, reader, addrOffset,
                   addr);
 #else
@@ -886,13 +946,14 @@ swift_generic_destroy(swift::OpaqueValue *address, const Metadata *metadata) {
 }
 
 void swift::swift_generic_arrayDestroy(swift::OpaqueValue *address, size_t count, size_t stride, const Metadata *metadata) {
+  countWitnessCall(layoutStringWitnessCounters.destroy);
   const uint8_t *layoutStr = metadata->getLayoutString();
   uint8_t *addr = (uint8_t *)address;
   for (size_t i = 0; i < count; i++) {
     LayoutStringReader1 reader{layoutStr + layoutStringHeaderSize};
     uintptr_t addrOffset = i * stride;
 
-#if defined(__APPLE__) && defined(__arm64__)
+#if SWIFT_LAYOUT_STRING_THREADED_DISPATCH
     handleRefCounts(destroyTable, CONTINUE_NO_COPY, metadata, reader,
                     addrOffset, addr);
 #else
@@ -924,11 +985,25 @@ static void nativeStrongRetain(const Metadata *metadata,
                                uintptr_t &addrOffset, uint8_t *dest,
                                uint8_t *src) {
   uintptr_t _addrOffset = addrOffset;
-  uintptr_t object = *(uintptr_t *)(src + _addrOffset);
-  memcpy(dest + _addrOffset, &object, sizeof(HeapObject*));
-  object &= ~_swift_abi_SwiftSpareBitsMask;
-  addrOffset = _addrOffset + sizeof(HeapObject *);
-  swift_retain((HeapObject *)object);
+  // Fuse runs of strong references, copying any padding between them, so a
+  // struct full of class references needs just one dispatch.
+  while (true) {
+    uintptr_t object = *(uintptr_t *)(src + _addrOffset);
+    memcpy(dest + _addrOffset, &object, sizeof(HeapObject*));
+    object &= ~_swift_abi_SwiftSpareBitsMask;
+    _addrOffset += sizeof(HeapObject *);
+    swift_retain((HeapObject *)object);
+
+    uint64_t nextTag = reader.peekBytes<uint64_t>();
+    if ((nextTag >> 56) != (uint64_t)RefCountingKind::NativeStrong)
+      break;
+    reader.skip(sizeof(uint64_t));
+    uintptr_t skip = (uintptr_t)(nextTag & ~(0xFFULL << 56));
+    if (skip)
+      memcpy(dest + _addrOffset, src + _addrOffset, skip);
+    _addrOffset += skip;
+  }
+  addrOffset = _addrOffset;
 }
 
 static void unownedRetain(const Metadata *metadata, LayoutStringReader1 &reader,
@@ -1112,13 +1187,14 @@ static void handleRefCountsInitWithCopy(const Metadata *metadata,
 extern "C" swift::OpaqueValue *
 swift_generic_initWithCopy(swift::OpaqueValue *_dest, swift::OpaqueValue *_src,
                            const Metadata *metadata) {
+  countWitnessCall(layoutStringWitnessCounters.initWithCopy);
   const uint8_t *layoutStr = metadata->getLayoutString();
   LayoutStringReader1 reader{layoutStr + layoutStringHeaderSize};
   uintptr_t addrOffset = 0;
   uint8_t *dest = (uint8_t *)_dest;
   uint8_t *src = (uint8_t *)_src;
 
-#if defined(__APPLE__) && defined(__arm64__)
+#if SWIFT_LAYOUT_STRING_THREADED_DISPATCH
   handleRefCounts(initWithCopyTable, CONTINUE_WITH_COPY, metadata, reader,
                   addrOffset, dest, src);
 #else
@@ -1134,13 +1210,14 @@ void swift::swift_generic_arrayInitWithCopy(swift::OpaqueValue *_dest,
                                             swift::OpaqueValue *_src,
                                             size_t count, size_t stride,
                                             const Metadata *metadata) {
+  countWitnessCall(layoutStringWitnessCounters.initWithCopy);
   const uint8_t *layoutStr = metadata->getLayoutString();
   uint8_t *dest = (uint8_t *)_dest;
   uint8_t *src = (uint8_t *)_src;
   for (size_t i = 0; i < count; i++) {
     LayoutStringReader1 reader{layoutStr + layoutStringHeaderSize};
     uintptr_t addrOffset = i * stride;
-#if defined(__APPLE__) && defined(__arm64__)
+#if SWIFT_LAYOUT_STRING_THREADED_DISPATCH
     handleRefCounts(initWithCopyTable, CONTINUE_WITH_COPY, metadata, reader,
                     addrOffset, dest, src);
 #else
@@ -1270,6 +1347,7 @@ static void handleRefCountsInitWithTake(const Metadata *metadata,
 extern "C" swift::OpaqueValue *
 swift_generic_initWithTake(swift::OpaqueValue *_dest, swift::OpaqueValue *_src,
                            const Metadata *metadata) {
+  countWitnessCall(layoutStringWitnessCounters.initWithTake);
   if (SWIFT_LIKELY(metadata->getValueWitnesses()->isBitwiseTakable())) {
     size_t size = metadata->vw_size();
     memcpy(_dest, _src, size);
@@ -1283,7 +1361,7 @@ swift_generic_initWithTake(swift::OpaqueValue *_dest, swift::OpaqueValue *_src,
   LayoutStringReader1 reader{layoutStr + layoutStringHeaderSize};
   uintptr_t addrOffset = 0;
 
-#if defined(__APPLE__) && defined(__arm64__)
+#if SWIFT_LAYOUT_STRING_THREADED_DISPATCH
   handleRefCounts(initWithTakeTable, CONTINUE_WITH_COPY, metadata, reader,
                   addrOffset, dest, src);
 #else
@@ -1896,7 +1974,7 @@ constexpr InitFn assignWithCopyTable[] = {
     &multiPayloadEnumGenericAssignWithCopy,
 };
 
-#if !(defined(__APPLE__) && defined(__arm64__))
+#if !SWIFT_LAYOUT_STRING_THREADED_DISPATCH
 static void handleRefCountsAssignWithCopy(const Metadata *metadata,
                                           LayoutStringReader1 &reader,
                                           uintptr_t &addrOffset, uint8_t *dest,
@@ -1917,7 +1995,7 @@ static void handleRefCountsAssignWithCopy(const Metadata *metadata,
     assignWithCopyTable[tag](metadata, reader, addrOffset, dest, src);
   }
 }
-#endif // !(defined(__APPLE__) && defined(__arm64__))
+#endif // !SWIFT_LAYOUT_STRING_THREADED_DISPATCH
 
 static void multiPayloadEnumFNAssignWithCopy(const Metadata *metadata,
                                              LayoutStringReader1 &reader,
@@ -1949,7 +2027,7 @@ static void multiPayloadEnumFNAssignWithCopy(const Metadata *metadata,
 
     if (srcTag == destTag) {
       nestedReader.skip((numPayloads * sizeof(size_t)) + srcRefCountOffset);
-#if defined(__APPLE__) && defined(__arm64__)
+#if SWIFT_LAYOUT_STRING_THREADED_DISPATCH
       auto nestedAddrOffsetDest = nestedAddrOffset;
       LayoutStringReader1 nestedReaderDest = nestedReader;
 
@@ -2001,13 +2079,14 @@ extern "C" swift::OpaqueValue *
 swift_generic_assignWithCopy(swift::OpaqueValue *_dest,
                              swift::OpaqueValue *_src,
                              const Metadata *metadata) {
+  countWitnessCall(layoutStringWitnessCounters.assignWithCopy);
   uint8_t *dest = (uint8_t *)_dest;
   uint8_t *src = (uint8_t *)_src;
   const uint8_t *layoutStr = metadata->getLayoutString();
   LayoutStringReader1 reader{layoutStr + layoutStringHeaderSize};
   uintptr_t addrOffset = 0;
 
-#if defined(__APPLE__) && defined(__arm64__)
+#if SWIFT_LAYOUT_STRING_THREADED_DISPATCH
   handleRefCounts(assignWithCopyTable, CONTINUE_WITH_COPY, metadata, reader,
                   addrOffset, dest, src);
 #else
@@ -2023,6 +2102,7 @@ void swift::swift_generic_arrayAssignWithCopy(swift::OpaqueValue *_dest,
                                               swift::OpaqueValue *_src,
                                               size_t count, size_t stride,
                                               const Metadata *metadata) {
+  countWitnessCall(layoutStringWitnessCounters.assignWithCopy);
   uint8_t *dest = (uint8_t *)_dest;
   uint8_t *src = (uint8_t *)_src;
   const uint8_t *layoutStr = metadata->getLayoutString();
@@ -2030,7 +2110,7 @@ void swift::swift_generic_arrayAssignWithCopy(swift::OpaqueValue *_dest,
     LayoutStringReader1 reader{layoutStr + layoutStringHeaderSize};
     uintptr_t addrOffset = i * stride;
 
-#if defined(__APPLE__) && defined(__arm64__)
+#if SWIFT_LAYOUT_STRING_THREADED_DISPATCH
     handleRefCounts(assignWithCopyTable, CONTINUE_WITH_COPY, metadata, reader,
                     addrOffset, dest, src);
 #else
@@ -2042,6 +2122,7 @@ void swift::swift_generic_arrayAssignWithCopy(swift::OpaqueValue *_dest,
 extern "C" swift::OpaqueValue *
 swift_generic_assignWithTake(swift::OpaqueValue *dest, swift::OpaqueValue *src,
                              const Metadata *metadata) {
+  countWitnessCall(layoutStringWitnessCounters.assignWithTake);
   swift_generic_destroy(dest, metadata);
   return swift_generic_initWithTake(dest, src, metadata);
 }
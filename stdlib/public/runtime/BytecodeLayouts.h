@@ -229,6 +229,22 @@ SWIFT_RUNTIME_EXPORT
 void swift_generic_instantiateLayoutString(const uint8_t *layoutStr,
                                            Metadata *type);
 
+/// Counts of entries into the layout string based value witnesses. The
+/// counters are only maintained when the SWIFT_DEBUG_ENABLE_LAYOUT_STRING_STATS
+/// environment variable is set; otherwise they stay zero. Array entry points
+/// count once per call, not once per element.
+struct LayoutStringWitnessStats {
+  uint64_t destroy;
+  uint64_t initWithCopy;
+  uint64_t initWithTake;
+  uint64_t assignWithCopy;
+  uint64_t assignWithTake;
+};
+
+SWIFT_RUNTIME_EXPORT
+void swift_generic_readLayoutStringWitnessStats(
+    LayoutStringWitnessStats *result);
+
 void swift_resolve_resilientAccessors(uint8_t *layoutStr,
                                       size_t layoutStrOffset,
                                       const uint8_t *fieldLayoutStr,
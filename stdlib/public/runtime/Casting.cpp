@@ -24,6 +24,7 @@
 #include "swift/Basic/Lazy.h"
 #include "swift/Basic/Unreachable.h"
 #include "swift/Demangling/Demangler.h"
+#include "swift/Runtime/Concurrent.h"
 #include "swift/Runtime/Config.h"
 #include "swift/Runtime/Debug.h"
 #include "swift/Runtime/Enum.h"
@@ -34,13 +35,13 @@
 #include "swift/shims/RuntimeShims.h"
 #include "swift/Threading/Mutex.h"
 #include "llvm/ADT/DenseMap.h"
-#include "llvm/ADT/PointerIntPair.h"
 #if SWIFT_OBJC_INTEROP
 #include "swift/Runtime/ObjCBridge.h"
 #include "SwiftObject.h"
 #include "SwiftValue.h"
 #endif
 
+#include <atomic>
 #include <cstddef>
 #include <cstring>
 #include <type_traits>
@@ -160,15 +161,58 @@ enum class TypeNameKind {
   Mangled,
 };
 
-using TypeNameCacheKey = llvm::PointerIntPair<const Metadata *, 2, TypeNameKind>;
+struct TypeNameCacheKey {
+  const Metadata *Type;
+  TypeNameKind Kind;
+
+  friend llvm::hash_code hash_value(const TypeNameCacheKey &key) {
+    return llvm::hash_combine(key.Type, static_cast<unsigned>(key.Kind));
+  }
+};
 
-static LazyMutex TypeNameCacheLock;
 static LazyMutex MangledToPrettyFunctionNameCacheLock;
 
-/// Cache containing rendered names for Metadata.
-/// Access MUST be protected using `TypeNameCacheLock`.
-static Lazy<llvm::DenseMap<TypeNameCacheKey, std::pair<const char *, size_t>>>
-  TypeNameCache;
+namespace {
+/// A cache entry for `TypeNameCache`, mapping a metadata pointer plus a
+/// rendering kind to the rendered name. The name is copied into memory
+/// which is never freed, so a looked-up entry can be returned to the
+/// caller without retaining any reference to the cache.
+struct TypeNameCacheEntry {
+private:
+  TypeNameCacheKey Key;
+  const char *Name;
+  size_t NameLength;
+
+public:
+  TypeNameCacheEntry(TypeNameCacheKey key, llvm::StringRef name) : Key(key) {
+    char *nameCopy = reinterpret_cast<char *>(malloc(name.size() + 1));
+    memcpy(nameCopy, name.data(), name.size());
+    nameCopy[name.size()] = 0;
+    Name = nameCopy;
+    NameLength = name.size();
+  }
+
+  TypeNamePair getName() const { return TypeNamePair{Name, NameLength}; }
+
+  bool matchesKey(const TypeNameCacheKey &key) {
+    return Key.Type == key.Type && Key.Kind == key.Kind;
+  }
+
+  friend llvm::hash_code hash_value(const TypeNameCacheEntry &value) {
+    return hash_value(value.Key);
+  }
+
+  template <class... T>
+  static size_t getExtraAllocationSize(T &&... ignored) {
+    return 0;
+  }
+};
+} // end anonymous namespace
+
+/// Cache containing rendered names for Metadata. Readers take a snapshot
+/// of the map and run lock-free; only inserts on a cache miss take the
+/// writer lock.
+static ConcurrentReadableHashMap<TypeNameCacheEntry> TypeNameCache;
 
 /// Cache containing rendered human-readable names for incoming mangled names.
 static Lazy<llvm::DenseMap<llvm::StringRef, std::pair<const char *, size_t>>>
@@ -177,96 +221,65 @@ static Lazy<llvm::DenseMap<llvm::StringRef, std::pair<const char *, size_t>>>
 
 TypeNamePair
 swift::swift_getTypeName(const Metadata *type, bool qualified) {
-  TypeNameCacheKey key = TypeNameCacheKey(type, qualified ? TypeNameKind::Qualified: TypeNameKind::NotQualified);
-  auto &cache = TypeNameCache.get();
-
-  // Attempt read-only lookup of cache entry.
-  {
-    LazyMutex::ScopedLock guard(TypeNameCacheLock);
+  TypeNameCacheKey key{
+      type, qualified ? TypeNameKind::Qualified : TypeNameKind::NotQualified};
 
-    auto found = cache.find(key);
-    if (found != cache.end()) {
-      auto result = found->second;
-      return TypeNamePair{result.first, result.second};
-    }
-  }
-
-  // Read-only lookup failed to find item, we may need to create it.
+  // Check the cache first. This is lock-free and is the common case.
   {
-    LazyMutex::ScopedLock guard(TypeNameCacheLock);
-
-    // Do lookup again just to make sure it wasn't created by another
-    // thread before we acquired the write lock.
-    auto found = cache.find(key);
-    if (found != cache.end()) {
-      auto result = found->second;
-      return TypeNamePair{result.first, result.second};
-    }
-
-    // Build the metadata name.
-    auto name = nameForMetadata(type, qualified);
-    // Copy it to memory we can reference forever.
-    auto size = name.size();
-    auto result = (char *)malloc(size + 1);
-    memcpy(result, name.data(), size);
-    result[size] = 0;
-
-    cache.insert({key, {result, size}});
-    return TypeNamePair{result, size};
-  }
+    auto snapshot = TypeNameCache.snapshot();
+    if (const TypeNameCacheEntry *entry = snapshot.find(key))
+      return entry->getName();
+  }
+
+  // Build the metadata name before taking the cache's writer lock.
+  auto name = nameForMetadata(type, qualified);
+
+  TypeNamePair result{nullptr, 0};
+  TypeNameCache.getOrInsert(key, [&](TypeNameCacheEntry *entry, bool created) {
+    // Another thread may have raced us to create the entry; use whichever
+    // copy ended up in the cache.
+    if (created)
+      ::new (entry) TypeNameCacheEntry(key, name);
+    result = entry->getName();
+    return true; // Keep the new entry.
+  });
+  return result;
 }
 
 /// Return mangled name for the given type.
 TypeNamePair
 swift::swift_getMangledTypeName(const Metadata *type) {
-  TypeNameCacheKey key(type, TypeNameKind::Mangled);
-  auto &cache = TypeNameCache.get();
+  TypeNameCacheKey key{type, TypeNameKind::Mangled};
 
-  // Attempt read-only lookup of cache entry.
+  // Check the cache first. This is lock-free and is the common case.
   {
-    LazyMutex::ScopedLock guard(TypeNameCacheLock);
-
-    auto found = cache.find(key);
-    if (found != cache.end()) {
-      auto result = found->second;
-      return TypeNamePair{result.first, result.second};
-    }
+    auto snapshot = TypeNameCache.snapshot();
+    if (const TypeNameCacheEntry *entry = snapshot.find(key))
+      return entry->getName();
   }
 
-  // Read-only cache lookup failed, we may need to create it.
-  {
-    LazyMutex::ScopedLock guard(TypeNameCacheLock);
-
-    // Do lookup again just to make sure it wasn't created by another
-    // thread before we acquired the write lock.
-    auto found = cache.find(key);
-    if (found != cache.end()) {
-      auto result = found->second;
-      return TypeNamePair{result.first, result.second};
-    }
-
-    // Build the mangled name.
-    Demangle::Demangler Dem;
-    auto demangling = _swift_buildDemanglingForMetadata(type, Dem);
-
-    if (demangling == nullptr) {
-      return TypeNamePair{NULL, 0};
-    }
-    auto mangling = Demangle::mangleNode(demangling);
-    if (!mangling.isSuccess())
-      return TypeNamePair{NULL, 0};
-    std::string name = mangling.result();
-
-    // Copy it to memory we can reference forever.
-    auto size = name.size();
-    auto result = (char *)malloc(size + 1);
-    memcpy(result, name.data(), size);
-    result[size] = 0;
-
-    cache.insert({key, {result, size}});
+  // Build the mangled name before taking the cache's writer lock.
+  Demangle::Demangler Dem;
+  auto demangling = _swift_buildDemanglingForMetadata(type, Dem);
 
-    return TypeNamePair{result, size};
-  }
+  if (demangling == nullptr) {
+    return TypeNamePair{NULL, 0};
+  }
+  auto mangling = Demangle::mangleNode(demangling);
+  if (!mangling.isSuccess())
+    return TypeNamePair{NULL, 0};
+  std::string name = mangling.result();
+
+  TypeNamePair result{nullptr, 0};
+  TypeNameCache.getOrInsert(key, [&](TypeNameCacheEntry *entry, bool created) {
+    // Another thread may have raced us to create the entry; use whichever
+    // copy ended up in the cache.
+    if (created)
+      ::new (entry) TypeNameCacheEntry(key, name);
+    result = entry->getName();
+    return true; // Keep the new entry.
+  });
+  return result;
 }
 
 
@@ -472,18 +485,69 @@ namespace {
 static const _ObjectiveCBridgeableWitnessTable *
 findBridgeWitness(const Metadata *T);
 
+namespace {
+
+/// A small shared cache of class-to-class cast feasibility, in the spirit
+/// of Objective-C method caches. Class metadata is immortal and superclass
+/// chains never change, so entries never need to be invalidated. Each slot
+/// is filled at most once and never replaced; a colliding pair simply falls
+/// back to walking the superclass chain.
+struct ClassCastCacheEntry {
+  const ClassMetadata *Source;
+  const ClassMetadata *Target;
+  bool CastSucceeds;
+};
+
+constexpr size_t ClassCastCacheSize = 128;  // Must be a power of two.
+
+std::atomic<ClassCastCacheEntry *> ClassCastCache[ClassCastCacheSize] = {};
+
+size_t classCastCacheSlot(const ClassMetadata *sourceType,
+                          const ClassMetadata *targetType) {
+  auto source = reinterpret_cast<uintptr_t>(sourceType);
+  auto target = reinterpret_cast<uintptr_t>(targetType);
+  // Discard the always-zero alignment bits and mix the two pointers so
+  // that distinct pairs with a common source or target spread out.
+  return ((source >> 4) ^ (target >> 9)) & (ClassCastCacheSize - 1);
+}
+
+} // end anonymous namespace
+
 /// Dynamically cast a class metatype to a Swift class metatype.
 static const ClassMetadata *
 _dynamicCastClassMetatype(const ClassMetadata *sourceType,
                           const ClassMetadata *targetType) {
-  do {
-    if (sourceType == targetType) {
-      return sourceType;
+  // An exact match needs neither the cache nor the walk.
+  if (sourceType == targetType)
+    return sourceType;
+
+  size_t slot = classCastCacheSlot(sourceType, targetType);
+  auto *entry = ClassCastCache[slot].load(std::memory_order_acquire);
+  if (entry && entry->Source == sourceType && entry->Target == targetType)
+    return entry->CastSucceeds ? targetType : nullptr;
+
+  auto *cursor = sourceType->Superclass;
+  while (cursor && cursor != targetType)
+    cursor = cursor->Superclass;
+
+  if (!entry) {
+    auto *newEntry = reinterpret_cast<ClassCastCacheEntry *>(
+        malloc(sizeof(ClassCastCacheEntry)));
+    newEntry->Source = sourceType;
+    newEntry->Target = targetType;
+    newEntry->CastSucceeds = (cursor != nullptr);
+
+    ClassCastCacheEntry *expected = nullptr;
+    if (!ClassCastCache[slot].compare_exchange_strong(
+            expected, newEntry, std::memory_order_release,
+            std::memory_order_relaxed)) {
+      // Another thread claimed the slot first; its entry is immortal,
+      // ours is not needed.
+      free(newEntry);
     }
-    sourceType = sourceType->Superclass;
-  } while (sourceType);
-  
-  return nullptr;
+  }
+
+  return cursor;
 }
 
 #if !SWIFT_OBJC_INTEROP // __SwiftValue is a native class
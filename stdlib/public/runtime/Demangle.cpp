@@ -17,8 +17,10 @@
 #include "swift/Runtime/Portability.h"
 #include "swift/Strings.h"
 
+#include <atomic>
 #include <vector>
 #include <inttypes.h>
+#include <string.h>
 
 #if SWIFT_OBJC_INTEROP
 #include <objc/runtime.h>
@@ -866,6 +868,88 @@ swift::_buildDemanglingForGenericType(const TypeContextDescriptor *description,
   return _buildDemanglingForContext(description, demangledGenerics, Dem);
 }
 
+#if SWIFT_STDLIB_HAS_TYPE_PRINTING
+
+namespace {
+
+/// A fixed-size, lock-free memoization cache for swift_demangle.
+///
+/// Symbolication clients (backtracers, crash reporters) demangle the same
+/// hot symbols over and over; re-running the demangler parser for each
+/// duplicate is pure waste. The cache is direct-mapped by a hash of the
+/// mangled name. Each slot is filled at most once and entries are immortal,
+/// which keeps readers lock-free without hazard pointers -- the same
+/// trade-off the runtime's other caches make.
+struct DemangleCacheEntry {
+  uint64_t Hash;
+  uint32_t MangledLength;
+  // Layout: mangled name (NUL-terminated), then demangled name
+  // (NUL-terminated).
+  char Data[1];
+
+  const char *getMangled() const { return Data; }
+  const char *getDemangled() const { return Data + MangledLength + 1; }
+};
+
+constexpr size_t DemangleCacheSize = 512;
+
+// Don't memoize pathologically long symbols; entries are never freed.
+constexpr size_t DemangleCacheMaxKeyLength = 4096;
+
+std::atomic<DemangleCacheEntry *> DemangleCache[DemangleCacheSize] = {};
+
+uint64_t hashMangledName(const char *name, size_t length) {
+  // FNV-1a; cheap and good enough for a direct-mapped cache.
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (size_t i = 0; i < length; ++i) {
+    hash ^= (unsigned char)name[i];
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+const char *lookupDemangleCache(const char *mangledName,
+                                size_t mangledNameLength,
+                                uint64_t hash) {
+  auto *entry =
+      DemangleCache[hash % DemangleCacheSize].load(std::memory_order_acquire);
+  if (entry && entry->Hash == hash &&
+      entry->MangledLength == mangledNameLength &&
+      memcmp(entry->getMangled(), mangledName, mangledNameLength) == 0)
+    return entry->getDemangled();
+  return nullptr;
+}
+
+void populateDemangleCache(const char *mangledName, size_t mangledNameLength,
+                           uint64_t hash, const std::string &demangled) {
+  if (mangledNameLength > DemangleCacheMaxKeyLength)
+    return;
+  size_t size = sizeof(DemangleCacheEntry) + mangledNameLength + 1 +
+                demangled.size() + 1;
+  auto *entry = (DemangleCacheEntry *)malloc(size);
+  if (!entry)
+    return;
+  entry->Hash = hash;
+  entry->MangledLength = mangledNameLength;
+  memcpy(entry->Data, mangledName, mangledNameLength);
+  entry->Data[mangledNameLength] = '\0';
+  memcpy(entry->Data + mangledNameLength + 1, demangled.c_str(),
+         demangled.size() + 1);
+
+  DemangleCacheEntry *expected = nullptr;
+  if (!DemangleCache[hash % DemangleCacheSize].compare_exchange_strong(
+          expected, entry, std::memory_order_release,
+          std::memory_order_relaxed)) {
+    // Another thread (or an earlier symbol that hashes to the same slot)
+    // got here first; keep the established entry.
+    free(entry);
+  }
+}
+
+} // end anonymous namespace
+
+#endif // SWIFT_STDLIB_HAS_TYPE_PRINTING
+
 // NB: This function is not used directly in the Swift codebase, but is
 // exported for Xcode support and is used by the sanitizers. Please coordinate
 // before changing.
@@ -906,6 +990,30 @@ char *swift_demangle(const char *mangledName,
 #if !SWIFT_STDLIB_HAS_TYPE_PRINTING
   return nullptr;
 #else
+  // Copies \p demangled out through the caller-provided buffer, or mallocs
+  // a fresh copy if no buffer was given.
+  auto copyOutResult = [&](const char *demangled) -> char * {
+    size_t length = strlen(demangled);
+    if (outputBuffer == nullptr || *outputBufferSize == 0) {
+      return strdup(demangled);
+    }
+    _swift_strlcpy(outputBuffer, demangled, *outputBufferSize);
+
+    // Indicate a failure if the result did not fit and was truncated
+    // by setting the required outputBufferSize.
+    if (*outputBufferSize < length + 1) {
+      *outputBufferSize = length + 1;
+    }
+    return outputBuffer;
+  };
+
+  // Fast path: this exact symbol has been demangled before.
+  uint64_t hash = hashMangledName(mangledName, mangledNameLength);
+  if (const char *cached =
+          lookupDemangleCache(mangledName, mangledNameLength, hash)) {
+    return copyOutResult(cached);
+  }
+
   // Demangle the name.
   auto options = Demangle::DemangleOptions();
   options.DisplayDebuggerGeneratedModule = false;
@@ -914,20 +1022,8 @@ char *swift_demangle(const char *mangledName,
                                        mangledNameLength,
                                        options);
 
-  // If the output buffer is not provided, malloc memory ourselves.
-  if (outputBuffer == nullptr || *outputBufferSize == 0) {
-    return strdup(result.c_str());
-  }
-
-  // Copy into the provided buffer.
-  _swift_strlcpy(outputBuffer, result.c_str(), *outputBufferSize);
-
-  // Indicate a failure if the result did not fit and was truncated
-  // by setting the required outputBufferSize.
-  if (*outputBufferSize < result.length() + 1) {
-    *outputBufferSize = result.length() + 1;
-  }
+  populateDemangleCache(mangledName, mangledNameLength, hash, result);
 
-  return outputBuffer;
+  return copyOutResult(result.c_str());
 #endif
 }
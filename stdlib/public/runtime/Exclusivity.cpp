@@ -163,21 +163,25 @@ bool AccessSet::insert(Access *access, void *pc, void *pointer,
 #endif
   auto action = getAccessAction(flags);
 
-  for (Access *cur = Head; cur != nullptr; cur = cur->getNext()) {
-    // Ignore accesses to different values.
-    if (cur->Pointer != pointer)
-      continue;
-
-    // If both accesses are reads, it's not a conflict.
-    if (action == ExclusivityFlags::Read && action == cur->getAccessAction())
-      continue;
-
-    // Otherwise, it's a conflict.
-    reportExclusivityConflict(cur->getAccessAction(), cur->PC, flags, pc,
-                              pointer);
-
-    // 0 means no backtrace will be printed.
-    fatalError(0, "Fatal access conflict detected.\n");
+  // If the summary filter proves that no tracked access uses this pointer,
+  // there is no conflict to scan for.
+  if (mayContain(pointer)) {
+    for (Access *cur = Head; cur != nullptr; cur = cur->getNext()) {
+      // Ignore accesses to different values.
+      if (cur->Pointer != pointer)
+        continue;
+
+      // If both accesses are reads, it's not a conflict.
+      if (action == ExclusivityFlags::Read && action == cur->getAccessAction())
+        continue;
+
+      // Otherwise, it's a conflict.
+      reportExclusivityConflict(cur->getAccessAction(), cur->PC, flags, pc,
+                                pointer);
+
+      // 0 means no backtrace will be printed.
+      fatalError(0, "Fatal access conflict detected.\n");
+    }
   }
   if (!isTracking(flags)) {
 #ifndef NDEBUG
@@ -191,6 +195,7 @@ bool AccessSet::insert(Access *access, void *pc, void *pointer,
   // Insert to the front of the array so that remove tends to find it faster.
   access->initialize(pc, pointer, Head, action);
   Head = access;
+  PointerSummary |= pointerSummaryBit(pointer);
 #ifndef NDEBUG
   if (isExclusivityLoggingEnabled()) {
     withLoggingLock([&]() {
@@ -214,6 +219,10 @@ void AccessSet::remove(Access *access) {
   // Fast path: stack discipline.
   if (cur == access) {
     Head = cur->getNext();
+    // The summary filter only ever shrinks back to empty; stale bits for
+    // removed accesses are harmless.
+    if (!Head)
+      PointerSummary = 0;
     return;
   }
 
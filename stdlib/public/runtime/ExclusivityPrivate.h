@@ -88,13 +88,42 @@ static_assert(sizeof(Access) <= sizeof(ValueBuffer) &&
 class AccessSet {
   Access *Head = nullptr;
 
+  /// A one-word Bloom filter over the pointers of all tracked accesses: if a
+  /// pointer's bit is clear, the set cannot contain an access to that pointer
+  /// and conflict scanning can be skipped. The filter is a superset of the
+  /// pointers in the list; bits accumulate as accesses are inserted or spliced
+  /// in and are only discarded when the set becomes empty.
+  uintptr_t PointerSummary = 0;
+
+  /// Accessed addresses are at least word-aligned, so drop the low bits
+  /// before selecting a filter bit.
+  static uintptr_t pointerSummaryBit(void *pointer) {
+    return uintptr_t(1) << ((reinterpret_cast<uintptr_t>(pointer) >> 3) %
+                            (sizeof(uintptr_t) * 8));
+  }
+
+  bool mayContain(void *pointer) const {
+    return (PointerSummary & pointerSummaryBit(pointer)) != 0;
+  }
+
 public:
   constexpr AccessSet() {}
-  constexpr AccessSet(Access *Head) : Head(Head) {}
 
   constexpr operator bool() const { return bool(Head); }
   constexpr Access *getHead() const { return Head; }
-  void setHead(Access *newHead) { Head = newHead; }
+
+  void setHead(Access *newHead) {
+    Head = newHead;
+    if (!Head) {
+      PointerSummary = 0;
+      return;
+    }
+    // The new list may contain accesses this set has never seen, e.g. when a
+    // task's accesses are spliced onto a thread; fold them into the summary.
+    for (Access *cur = Head; cur != nullptr; cur = cur->getNext())
+      PointerSummary |= pointerSummaryBit(cur->Pointer);
+  }
+
   constexpr bool isHead(Access *access) const { return Head == access; }
 
   bool insert(Access *access, void *pc, void *pointer, ExclusivityFlags flags);
@@ -26,10 +26,12 @@
 #include "WeakReference.h"
 #include "swift/Runtime/Debug.h"
 #include "swift/Runtime/CustomRRABI.h"
+#include "swift/Runtime/EnvironmentVariables.h"
 #include "swift/Runtime/InstrumentsSupport.h"
 #include "swift/shims/GlobalObjects.h"
 #include "swift/shims/RuntimeShims.h"
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstring>
 #include <cstdio>
@@ -235,6 +237,80 @@ static malloc_type_id_t getMallocTypeId(const HeapMetadata *heapMetadata) {
 }
 #endif // SWIFT_STDLIB_HAS_MALLOC_TYPE
 
+namespace {
+
+/// Per-type allocation statistics, maintained when
+/// SWIFT_DEBUG_ENABLE_ALLOCATION_STATISTICS is set. The entries have
+/// stable addresses, so heap tools can walk the map remotely through
+/// _swift_debug_allocationStatisticsPointer and read the counters from
+/// a live process without a heap dump.
+class AllocationStatsEntry {
+public:
+  const HeapMetadata *Metadata;
+
+  std::atomic<size_t> Count{0};
+  std::atomic<size_t> TotalBytes{0};
+  std::atomic<size_t> LiveBytes{0};
+  std::atomic<size_t> HighWaterBytes{0};
+
+  AllocationStatsEntry(const HeapMetadata *metadata) : Metadata(metadata) {}
+
+  void recordAllocation(size_t bytes) {
+    Count.fetch_add(1, std::memory_order_relaxed);
+    TotalBytes.fetch_add(bytes, std::memory_order_relaxed);
+    size_t live = LiveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+
+    auto highWater = HighWaterBytes.load(std::memory_order_relaxed);
+    while (live > highWater &&
+           !HighWaterBytes.compare_exchange_weak(highWater, live,
+                                                 std::memory_order_relaxed)) {
+    }
+  }
+
+  void recordDeallocation(size_t bytes) {
+    LiveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+  }
+
+  intptr_t getKeyIntValueForDump() {
+    return reinterpret_cast<intptr_t>(Metadata);
+  }
+
+  bool matchesKey(const HeapMetadata *metadata) const {
+    return metadata == Metadata;
+  }
+
+  friend llvm::hash_code hash_value(const AllocationStatsEntry &entry) {
+    return llvm::hash_value(entry.Metadata);
+  }
+
+  static size_t getExtraAllocationSize(const HeapMetadata *key) { return 0; }
+  size_t getExtraAllocationSize() const { return 0; }
+};
+
+} // end anonymous namespace
+
+static SimpleGlobalCache<AllocationStatsEntry, AllocationStatisticsTag>
+    AllocationStats;
+
+const void *const swift::_swift_debug_allocationStatisticsPointer =
+    &AllocationStats;
+
+static bool allocationStatisticsEnabled() {
+  return SWIFT_UNLIKELY(
+      runtime::environment::SWIFT_DEBUG_ENABLE_ALLOCATION_STATISTICS());
+}
+
+static void recordAllocationStatistics(const HeapMetadata *metadata,
+                                       size_t bytes) {
+  AllocationStats.getOrInsert(metadata).first->recordAllocation(bytes);
+}
+
+static void recordDeallocationStatistics(const HeapMetadata *metadata,
+                                         size_t bytes) {
+  if (auto *entry = AllocationStats.find(metadata))
+    entry->recordDeallocation(bytes);
+}
+
 #ifdef SWIFT_STDLIB_OVERRIDABLE_RETAIN_RELEASE
 
 SWIFT_RUNTIME_EXPORT
@@ -289,6 +365,9 @@ static HeapObject *_swift_allocObject_(HeapMetadata const *metadata,
 
   SWIFT_RT_TRACK_INVOCATION(object, swift_allocObject);
 
+  if (allocationStatisticsEnabled())
+    recordAllocationStatistics(metadata, requiredSize);
+
   return object;
 }
 
@@ -410,6 +489,15 @@ public:
 
 static SimpleGlobalCache<BoxCacheEntry, BoxesTag> Boxes;
 
+/// A small direct-mapped cache in front of Boxes. Boxing hot paths (such as
+/// large existentials flowing into collections) allocate boxes of the same
+/// handful of types over and over, and the per-type box metadata is immortal
+/// once created, so slots never need invalidation and can be overwritten
+/// freely on collision.
+static constexpr size_t BoxMetadataCacheSize = 64; // Must be a power of two.
+static std::atomic<FullMetadata<GenericBoxHeapMetadata> *>
+    BoxMetadataCache[BoxMetadataCacheSize] = {};
+
 BoxPair swift::swift_makeBoxUnique(OpaqueValue *buffer, const Metadata *type,
                                     size_t alignMask) {
   auto *inlineBuffer = reinterpret_cast<ValueBuffer*>(buffer);
@@ -436,8 +524,15 @@ BoxPair swift::swift_makeBoxUnique(OpaqueValue *buffer, const Metadata *type,
 }
 
 BoxPair swift::swift_allocBox(const Metadata *type) {
-  // Get the heap metadata for the box.
-  auto metadata = &Boxes.getOrInsert(type).first->Data;
+  // Get the heap metadata for the box, probing the direct-mapped cache
+  // before the global hash table.
+  size_t slot =
+      (reinterpret_cast<uintptr_t>(type) >> 4) & (BoxMetadataCacheSize - 1);
+  auto *metadata = BoxMetadataCache[slot].load(std::memory_order_acquire);
+  if (!metadata || metadata->BoxedType != type) {
+    metadata = &Boxes.getOrInsert(type).first->Data;
+    BoxMetadataCache[slot].store(metadata, std::memory_order_release);
+  }
 
   // Allocate and project the box.
   auto allocation = swift_allocObject(metadata, metadata->getAllocSize(),
@@ -976,6 +1071,9 @@ static inline void swift_deallocObjectImpl(HeapObject *object,
   // If we are tracking leaks, stop tracking this object.
   SWIFT_LEAKS_STOP_TRACKING_OBJECT(object);
 
+  if (allocationStatisticsEnabled())
+    recordDeallocationStatistics(object->metadata, allocatedSize);
+
 
   // Drop the initial weak retain of the object.
   //
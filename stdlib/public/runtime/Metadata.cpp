@@ -43,6 +43,7 @@
 #include "swift/Threading/Mutex.h"
 #include "llvm/ADT/StringExtras.h"
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <cinttypes>
 #include <condition_variable>
@@ -3532,15 +3533,24 @@ static void initClassFieldOffsetVector(ClassMetadata *self,
       continue;
     auto offset = roundUpToAlignMask(size,
                                      eltLayout->flags.getAlignmentMask());
-    fieldOffsets[i] = offset;
+    // For a statically-emitted class on the update path, the field offset
+    // vector already holds the compiler's optimistic offsets, and it lives
+    // in the binary's data segment. Only write if the computed offset
+    // actually differs, so that we don't dirty the page when the layout
+    // didn't drift.
+    if (fieldOffsets[i] != offset)
+      fieldOffsets[i] = offset;
     size = offset + eltLayout->size;
     alignMask = std::max(alignMask, eltLayout->flags.getAlignmentMask());
   }
 
-  // Save the final size and alignment into the metadata record.
+  // Save the final size and alignment into the metadata record, unless
+  // the statically-emitted values were already correct.
   assert(self->isTypeMetadata());
-  self->setInstanceSize(size);
-  self->setInstanceAlignMask(alignMask);
+  if (self->getInstanceSize() != size)
+    self->setInstanceSize(size);
+  if (self->getInstanceAlignMask() != alignMask)
+    self->setInstanceAlignMask(alignMask);
 
 #if SWIFT_OBJC_INTEROP
   // Save the size into the Objective-C metadata as well.
@@ -6441,6 +6451,49 @@ swift::swift_getWitnessTableRelative(const ProtocolConformanceDescriptor *confor
                                                  (uintptr_t)0x1);
 }
 
+const WitnessTable *
+swift::_getCachedWitnessTable(const ProtocolConformanceDescriptor *conformance,
+                              const Metadata *type) {
+  // Foreign witness tables must be uniqued through the full path.
+  if (conformance->isSynthesizedNonUnique())
+    return nullptr;
+
+  // When there is no generic table, or the pattern can be used directly,
+  // there is no instantiation cache to probe.
+  auto genericTable = conformance->getGenericWitnessTable();
+  if (!genericTable || doesNotRequireInstantiation(conformance, genericTable))
+    return nullptr;
+
+#if SWIFT_STDLIB_USE_RELATIVE_PROTOCOL_WITNESS_TABLES
+  auto *entry = getCacheForRelativeWitness(genericTable).find(type);
+  if (!entry)
+    return nullptr;
+  auto *table = entry->getCompletedValue();
+  if (!table)
+    return nullptr;
+
+  // Mark this as a dynamic (conditional conformance) protocol witness table,
+  // matching swift_getWitnessTableRelative.
+  return reinterpret_cast<const WitnessTable *>(((uintptr_t)table) |
+                                                (uintptr_t)0x1);
+#else
+  // A nondependent conformance stores its unique instantiation in a single
+  // atomic slot in the private data rather than in a cache.
+  auto typeDescription = conformance->getTypeDescriptor();
+  if (typeDescription && !typeDescription->isGeneric() &&
+      genericTable->PrivateData != nullptr) {
+    auto tablePtr = reinterpret_cast<std::atomic<WitnessTable *> *>(
+        genericTable->PrivateData.get());
+    return tablePtr->load(SWIFT_MEMORY_ORDER_CONSUME);
+  }
+
+  auto *entry = getCache(genericTable).find(type);
+  if (!entry)
+    return nullptr;
+  return entry->getCompletedValue();
+#endif
+}
+
 /// Find the name of the associated type with the given descriptor.
 static StringRef findAssociatedTypeName(const ProtocolDescriptor *protocol,
                                         const ProtocolRequirement *assocType) {
@@ -7523,6 +7576,11 @@ static swift::atomic<PoolRange>
 AllocationPool{PoolRange{InitialAllocationPool.Pool,
                          sizeof(InitialAllocationPool.Pool)}};
 
+/// A single spare page stashed by a thread whose page-installing
+/// compare-exchange lost a race, so that the next page allocation can
+/// recycle it instead of going back to the system allocator.
+static std::atomic<char *> SpareAllocationPage{nullptr};
+
 std::tuple<const void *, size_t> MetadataAllocator::InitialPoolLocation() {
   return {InitialAllocationPool.Pool, sizeof(InitialAllocationPool.Pool)};
 }
@@ -7646,8 +7704,11 @@ void *MetadataAllocator::Allocate(size_t size, size_t alignment) {
       if (SWIFT_UNLIKELY(_swift_debug_metadataAllocationIterationEnabled))
         poolSize -= sizeof(PoolTrailer);
       allocatedNewPage = true;
-      allocation = reinterpret_cast<char *>(swift_slowAlloc(PoolRange::PageSize,
-                                                            alignof(char) - 1));
+      allocation = SpareAllocationPage.exchange(nullptr,
+                                                std::memory_order_relaxed);
+      if (!allocation)
+        allocation = reinterpret_cast<char *>(
+            swift_slowAlloc(PoolRange::PageSize, alignof(char) - 1));
       memsetScribble(allocation, PoolRange::PageSize);
 
       if (SWIFT_UNLIKELY(_swift_debug_metadataAllocationIterationEnabled)) {
@@ -7703,9 +7764,18 @@ void *MetadataAllocator::Allocate(size_t size, size_t alignment) {
       }
     }
 
-    // If it failed, go back to a neutral state and try again.
+    // If it failed, go back to a neutral state and try again. Stash the
+    // freshly-allocated page for the next attempt if the spare slot is
+    // empty; under contention every thread that loses the race would
+    // otherwise free a page only to allocate another one immediately.
     if (allocatedNewPage) {
-      swift_slowDealloc(allocation, PoolRange::PageSize, alignof(char) - 1);
+      __asan_unpoison_memory_region(allocation, PoolRange::PageSize);
+      char *expectedSpare = nullptr;
+      if (!SpareAllocationPage.compare_exchange_strong(
+              expectedSpare, allocation, std::memory_order_relaxed,
+              std::memory_order_relaxed)) {
+        swift_slowDealloc(allocation, PoolRange::PageSize, alignof(char) - 1);
+      }
     }
   }
 }
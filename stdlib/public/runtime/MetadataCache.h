@@ -366,6 +366,15 @@ protected:
 public:
   using Status = ValueType;
 
+  /// Return the value if initialization has already completed, or null if
+  /// it is still in progress. Never blocks.
+  ValueType getCompletedValue() const {
+    auto value = Value.load(std::memory_order_acquire);
+    if (getAsWaitQueue(value))
+      return nullptr;
+    return castAsValue(value);
+  }
+
   template <class... ArgTys>
   Status await(ConcurrencyControl &concurrency, ArgTys &&...args) {
     WaitQueue::Waiter waiter(concurrency.Lock);
@@ -514,7 +523,7 @@ struct GenericSignatureLayout {
 class MetadataCacheKey {
   const void * const *Data;
   GenericSignatureLayout<InProcess> Layout;
-  uint32_t Hash;
+  uint64_t Hash;
 
 public:
   /// Compare two witness tables, which may involving checking the
@@ -608,7 +617,7 @@ public:
       : Data(data), Layout(layout), Hash(computeHash()) {}
 
   MetadataCacheKey(const GenericSignatureLayout<InProcess> &layout,
-                   const void *const *data, uint32_t hash)
+                   const void *const *data, uint64_t hash)
       : Data(data), Layout(layout), Hash(hash) {}
 
   bool operator==(const MetadataCacheKey &rhs) const {
@@ -703,7 +712,7 @@ public:
     return true;
   }
 
-  uint32_t hash() const {
+  uint64_t hash() const {
     return Hash;
   }
 
@@ -726,19 +735,22 @@ public:
   }
 
 private:
-  uint32_t computeHash() const {
-    size_t H = 0x56ba80d1u * Layout.NumKeyParameters;
+  uint64_t computeHash() const {
+    uint64_t H = 0x56ba80d1u * Layout.NumKeyParameters;
 
     auto *packs = Layout.PackShapeDescriptors;
     unsigned packIdx = 0;
 
     auto update = [&H](uintptr_t value) {
-      H = (H >> 10) | (H << ((sizeof(uintptr_t) * 8) - 10));
+      H = (H >> 10) | (H << ((sizeof(uint64_t) * 8) - 10));
       H ^= (value ^ (value >> 19));
     };
 
-    // FIXME: The first NumShapeClasses entries are pack counts;
-    // incorporate them into the hash
+    // The first NumShapeClasses entries are pack counts. Equal keys always
+    // have equal pack counts, so they can be mixed into the hash.
+    for (unsigned i = 0; i != Layout.NumShapeClasses; ++i)
+      update(reinterpret_cast<uintptr_t>(Data[i]));
+
     for (unsigned i = Layout.NumShapeClasses,
                   e = Layout.NumShapeClasses + Layout.NumKeyParameters;
          i != e; ++i) {
@@ -762,8 +774,8 @@ private:
 
     H *= 0x27d4eb2d;
 
-    // Rotate right by 10 and then truncate to 32 bits.
-    return uint32_t((H >> 10) | (H << ((sizeof(uintptr_t) * 8) - 10)));
+    // Rotate right by 10 for a final mix.
+    return (H >> 10) | (H << ((sizeof(uint64_t) * 8) - 10));
   }
 };
 
@@ -1567,7 +1579,7 @@ protected:
 private:
   /// These are set during construction and never changed.
   const GenericSignatureLayout<InProcess> Layout;
-  const uint32_t Hash;
+  const uint64_t Hash;
 
   /// Valid if TrackingInfo.getState() >= PrivateMetadataState::Abstract.
   ValueType Value;
@@ -1601,7 +1613,7 @@ public:
   }
 
   intptr_t getKeyIntValueForDump() const {
-    return Hash;
+    return (intptr_t)Hash;
   }
 
   friend llvm::hash_code hash_value(const VariadicMetadataCacheEntryBase<Impl, Objects...> &value) {
@@ -677,6 +677,18 @@ public:
   const Metadata *
   _getSimpleProtocolTypeMetadata(const ProtocolDescriptor *protocol);
 
+  /// Probe for a witness table that has already been instantiated for the
+  /// given conformance and type, without blocking and without doing any
+  /// instantiation work.
+  ///
+  /// Returns null if the table has not been fully instantiated yet, or if
+  /// the conformance is of a kind for which the probe cannot cheaply answer
+  /// the question; callers must fall back to swift_getWitnessTable in that
+  /// case.
+  const WitnessTable *
+  _getCachedWitnessTable(const ProtocolConformanceDescriptor *conformance,
+                         const Metadata *type);
+
   /// Given a type that we know can be used with the given conformance, find
   /// the superclass that introduced the conformance.
   const Metadata *findConformingSuperclass(
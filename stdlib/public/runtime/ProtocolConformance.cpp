@@ -326,6 +326,15 @@ ProtocolConformanceDescriptor::getCanonicalTypeMetadata() const {
 template<>
 const WitnessTable *
 ProtocolConformanceDescriptor::getWitnessTable(const Metadata *type) const {
+  // Repeated lookups for the same (conformance, type) pair are common when
+  // operating on homogeneous collections of generic values. If the witness
+  // table has already been instantiated, return it without re-checking the
+  // conditional requirements: they were satisfied when the cached table was
+  // instantiated, and registering more conformances can never invalidate
+  // them.
+  if (auto *cached = _getCachedWitnessTable(this, type))
+    return cached;
+
   // If needed, check the conditional requirements.
   llvm::SmallVector<const void *, 8> conditionalArgs;
 
@@ -396,11 +405,31 @@ namespace {
   struct ConformanceCacheEntry {
   private:
     ConformanceCacheKey Key;
-    const WitnessTable *Witness;
+
+    /// The cached witness table, or null if failure was cached. Atomic
+    /// because stale entries are refreshed in place (under the Cache's
+    /// writer lock) while readers search the map without locking.
+    std::atomic<const WitnessTable *> Witness;
+
+    /// The number of conformance sections this entry was validated against,
+    /// or 0 if the entry is unconditionally authoritative (an exact-type
+    /// match or a dyld result). Entries validated against fewer sections
+    /// than are currently registered are stale: the sections they were
+    /// validated against are known not to contain a match, but sections
+    /// registered later might.
+    std::atomic<size_t> SectionsCount;
 
   public:
-    ConformanceCacheEntry(ConformanceCacheKey key, const WitnessTable *witness)
-        : Key(key), Witness(witness) {}
+    ConformanceCacheEntry(ConformanceCacheKey key, const WitnessTable *witness,
+                          size_t sectionsCount)
+        : Key(key), Witness(witness), SectionsCount(sectionsCount) {}
+
+    // Copy construction is needed when the map's element storage is resized.
+    // It runs under the writer lock, so relaxed ordering suffices.
+    ConformanceCacheEntry(const ConformanceCacheEntry &other)
+        : Key(other.Key),
+          Witness(other.Witness.load(std::memory_order_relaxed)),
+          SectionsCount(other.SectionsCount.load(std::memory_order_relaxed)) {}
 
     bool matchesKey(const ConformanceCacheKey &key) const {
       return Key.Type == key.Type && Key.Proto == key.Proto;
@@ -415,9 +444,31 @@ namespace {
       return 0;
     }
 
-    /// Get the cached witness table, or null if we cached failure.
+    /// Get the cached witness table, or null if we cached failure. Read
+    /// SectionsCount first: the release store in updateResult then
+    /// guarantees the witness observed is at least as new as that count.
     const WitnessTable *getWitnessTable() const {
-      return Witness;
+      return Witness.load(std::memory_order_relaxed);
+    }
+
+    /// Get the number of sections this entry was validated against, or 0 if
+    /// it is unconditionally authoritative.
+    size_t getSectionsCount() const {
+      return SectionsCount.load(std::memory_order_acquire);
+    }
+
+    /// Refresh a stale entry with a result validated against more sections.
+    /// Must be called with the Cache's writer lock held. Never downgrades:
+    /// an unconditionally authoritative entry is left alone, and an entry
+    /// validated against more sections than \p sectionsCount wins.
+    void updateResult(const WitnessTable *witness, size_t sectionsCount) {
+      size_t oldCount = SectionsCount.load(std::memory_order_relaxed);
+      if (oldCount == 0)
+        return;
+      if (sectionsCount != 0 && sectionsCount <= oldCount)
+        return;
+      Witness.store(witness, std::memory_order_relaxed);
+      SectionsCount.store(sectionsCount, std::memory_order_release);
     }
   };
 } // end anonymous namespace
@@ -426,6 +477,7 @@ namespace {
 struct ConformanceState {
   ConcurrentReadableHashMap<ConformanceCacheEntry> Cache;
   ConcurrentReadableArray<ConformanceSection> SectionsToScan;
+
   bool scanSectionsBackwards;
 
 #if USE_DYLD_SHARED_CACHE_CONFORMANCE_TABLES
@@ -485,36 +537,28 @@ struct ConformanceState {
     initializeProtocolConformanceLookup();
   }
 
+  /// Record a lookup result. \p sectionsCount is the number of conformance
+  /// sections the result was validated against, or 0 if the result is
+  /// unconditionally authoritative (an exact-type match or a dyld result).
+  /// The count is stored in the entry, so results recorded while another
+  /// thread concurrently registers a section stay correct: they are simply
+  /// authoritative for fewer sections than are then registered.
   void cacheResult(const Metadata *type, const ProtocolDescriptor *proto,
                    const WitnessTable *witness, size_t sectionsCount) {
     Cache.getOrInsert(ConformanceCacheKey(type, proto),
                       [&](ConformanceCacheEntry *entry, bool created) {
-                        // Create the entry if needed. If it already exists,
-                        // we're done.
-                        if (!created)
+                        // If the entry already exists, it may be stale:
+                        // refresh it in place with the new result. We hold
+                        // the writer lock here, so updates don't race with
+                        // each other, only with lock-free readers.
+                        if (!created) {
+                          entry->updateResult(witness, sectionsCount);
                           return false;
-
-                        // Check the current sections count against what was
-                        // passed in. If a section count was passed in and they
-                        // don't match, then this is not an authoritative entry
-                        // and it may have been obsoleted, because the new
-                        // sections could contain a conformance in a more
-                        // specific type.
-                        //
-                        // If they DO match, then we can safely add. Another
-                        // thread might be adding new sections at this point,
-                        // but we will not race with them. That other thread
-                        // will add the new sections, then clear the cache. When
-                        // it clears the cache, it will block waiting for this
-                        // code to complete and relinquish Cache's writer lock.
-                        // If we cache a stale entry, it will be immediately
-                        // cleared.
-                        if (sectionsCount > 0 &&
-                            SectionsToScan.snapshot().count() != sectionsCount)
-                          return false; // abandon the new entry
+                        }
 
                         ::new (entry) ConformanceCacheEntry(
-                            ConformanceCacheKey(type, proto), witness);
+                            ConformanceCacheKey(type, proto), witness,
+                            sectionsCount);
                         return true; // keep the new entry
                       });
   }
@@ -546,9 +590,11 @@ static void _registerProtocolConformances(ConformanceState &C,
                                           ConformanceSection section) {
   C.SectionsToScan.push_back(section);
 
-  // Blow away the conformances cache to get rid of any negative entries that
-  // may now be obsolete.
-  C.Cache.clear();
+  // There is nothing to invalidate: cache entries record the number of
+  // sections they were validated against, so entries recorded before this
+  // registration are simply no longer authoritative. Exact-type entries stay
+  // valid forever, and a stale negative entry still tells the next lookup
+  // which sections it can skip rescanning.
 }
 
 void swift::addImageProtocolConformanceBlockCallbackUnsafe(
@@ -624,29 +670,56 @@ swift::swift_registerProtocolConformances(const ProtocolConformanceRecord *begin
   _registerProtocolConformances(C, ConformanceSection{begin, end});
 }
 
+/// The result of a conformance cache lookup.
+struct ConformanceCacheResult {
+  /// Whether the result is authoritative, i.e. for the type itself and not a
+  /// superclass, and validated against all currently registered sections. A
+  /// non-authoritative cached conformance may be overridden by a scan.
+  bool isAuthoritative;
+
+  /// The cached witness table, or null if failure was cached (or nothing).
+  const WitnessTable *witness;
+
+  /// When a stale negative entry for the queried type itself was found, the
+  /// number of conformance sections it was validated against. Those sections
+  /// are known to contain no conformance of the type (or any superclass) to
+  /// the protocol, so a scan can skip them. Zero otherwise.
+  size_t validatedNegativeSections;
+};
+
 /// Search for a conformance descriptor in the ConformanceCache.
-/// First element of the return value is `true` if the result is authoritative
-/// i.e. the result is for the type itself and not a superclass. If `false`
-/// then we cached a conformance on a superclass, but that may be overridden.
-/// A return value of `{ false, nullptr }` indicates nothing was cached.
-static std::pair<bool, const WitnessTable *>
+static ConformanceCacheResult
 searchInConformanceCache(const Metadata *type,
                          const ProtocolDescriptor *protocol,
                          bool instantiateSuperclassMetadata) {
   auto &C = Conformances.get();
   auto origType = type;
   auto snapshot = C.Cache.snapshot();
+  size_t sectionsCount = C.SectionsToScan.count();
+  size_t validatedNegativeSections = 0;
 
   MaybeIncompleteSuperclassIterator superclassIterator{
       type, instantiateSuperclassMetadata};
   for (; auto type = superclassIterator.metadata; ++superclassIterator) {
     if (auto *Value = snapshot.find(ConformanceCacheKey(type, protocol))) {
-      return {type == origType, Value->getWitnessTable()};
+      size_t validated = Value->getSectionsCount();
+      if (validated != 0 && validated != sectionsCount) {
+        // The entry was recorded before the most recently registered
+        // sections, so it is not authoritative: the new sections could
+        // contain a conformance in a more specific type. A stale negative
+        // entry for the queried type still proves that the sections it was
+        // validated against contain nothing; report that so the scan can
+        // skip them.
+        if (type == origType && !Value->getWitnessTable())
+          validatedNegativeSections = validated;
+        continue;
+      }
+      return {type == origType, Value->getWitnessTable(), 0};
     }
   }
 
-  // We did not find a cache entry.
-  return {false, nullptr};
+  // We did not find an up-to-date cache entry.
+  return {false, nullptr, validatedNegativeSections};
 }
 
 /// Get the appropriate context descriptor for a type. If the descriptor is a
@@ -1042,13 +1115,13 @@ swift_conformsToProtocolMaybeInstantiateSuperclasses(
   // concurrently without locking.
   auto found =
       searchInConformanceCache(type, protocol, instantiateSuperclassMetadata);
-  if (found.first) {
+  if (found.isAuthoritative) {
     // An authoritative negative result can be overridden by a result from dyld.
-    if (!found.second) {
+    if (!found.witness) {
       if (dyldCachedWitnessTable)
         return {dyldCachedWitnessTable, false};
     }
-    return {found.second, false};
+    return {found.witness, false};
   }
 
   if (dyldCachedConformanceDescriptor) {
@@ -1100,13 +1173,21 @@ swift_conformsToProtocolMaybeInstantiateSuperclasses(
   auto traceState =
       runtime::trace::protocol_conformance_scan_begin(type, protocol);
 
+  // If a stale negative entry was cached for this type, the sections it was
+  // validated against are known to contain no conformance of this type (or
+  // any superclass) to the protocol; only scan the sections registered since.
+  // Sections are append-only, so they are the leading entries of the
+  // snapshot. Scan direction does not matter for skipped sections, since
+  // they contain no match to prioritize.
   auto snapshot = C.SectionsToScan.snapshot();
+  size_t firstUnscanned = found.validatedNegativeSections;
+  assert(firstUnscanned <= snapshot.count());
   if (C.scanSectionsBackwards) {
-    for (auto &section : llvm::reverse(snapshot))
-      processSection(section);
+    for (size_t i = snapshot.count(); i > firstUnscanned; --i)
+      processSection(snapshot.begin()[i - 1]);
   } else {
-    for (auto &section : snapshot)
-      processSection(section);
+    for (size_t i = firstUnscanned, e = snapshot.count(); i < e; ++i)
+      processSection(snapshot.begin()[i]);
   }
 
   // Find the most specific conformance that was scanned.
@@ -1957,5 +2038,23 @@ const Metadata *swift::findConformingSuperclass(
   return conformingType;
 }
 
+bool swift::swift_prewarmMetadataCaches(const char *typeNameStart,
+                                        size_t typeNameLength,
+                                        const ProtocolDescriptor *protocol) {
+  llvm::StringRef typeName(typeNameStart, typeNameLength);
+  auto result = swift_getTypeByMangledName(MetadataState::Complete, typeName,
+                                           /*arguments=*/nullptr,
+                                           /*substGenericParam=*/{},
+                                           /*substWitnessTable=*/{});
+  if (result.isError())
+    return false;
+  auto *type = result.getType().getMetadata();
+  if (!type)
+    return false;
+  if (protocol)
+    swift_conformsToProtocol(type, protocol);
+  return true;
+}
+
 #define OVERRIDE_PROTOCOLCONFORMANCE COMPATIBILITY_OVERRIDE
 #include COMPATIBILITY_OVERRIDE_INCLUDE_PATH
@@ -11,11 +11,88 @@
 //===----------------------------------------------------------------------===//
 
 #include <cstdio>
+#include <new>
 
+#include "swift/Runtime/Heap.h"
 #include "swift/Runtime/HeapObject.h"
+#include "swift/Threading/Mutex.h"
 
 namespace swift {
 
+// Side table entries are allocated from a sharded pool with per-shard free
+// lists. Side tables are created on the first weak (or overflowing unowned)
+// reference to an object, and weak-heavy workloads create and destroy them
+// fast enough that funneling every entry through the general allocator is
+// visible as allocator lock contention in profiles. Sharding by address
+// spreads concurrent allocation and recycling over independent locks; slabs
+// are carved in bulk so the general allocator is only consulted once per
+// EntriesPerSlab entries.
+namespace {
+
+struct SideTableEntrySlot {
+  SideTableEntrySlot *next;
+};
+
+static_assert(sizeof(HeapObjectSideTableEntry) >= sizeof(SideTableEntrySlot),
+              "free list link must fit in a recycled side table entry");
+
+class SideTableShard {
+  LazyMutex lock;
+  SideTableEntrySlot *freeList = nullptr;
+
+  static constexpr size_t EntriesPerSlab = 32;
+
+public:
+  void *allocate() {
+    {
+      LazyMutex::ScopedLock guard(lock);
+      if (auto *slot = freeList) {
+        freeList = slot->next;
+        return slot;
+      }
+    }
+
+    // Carve a fresh slab outside the lock and donate all but the first
+    // entry to the free list. Slabs are never returned to the general
+    // allocator; recycled entries satisfy future demand.
+    auto size = sizeof(HeapObjectSideTableEntry);
+    auto *slab = reinterpret_cast<char *>(swift_slowAlloc(
+        size * EntriesPerSlab, alignof(HeapObjectSideTableEntry) - 1));
+
+    LazyMutex::ScopedLock guard(lock);
+    for (size_t i = 1; i < EntriesPerSlab; ++i) {
+      auto *slot = reinterpret_cast<SideTableEntrySlot *>(slab + i * size);
+      slot->next = freeList;
+      freeList = slot;
+    }
+    return slab;
+  }
+
+  void deallocate(void *entry) {
+    auto *slot = reinterpret_cast<SideTableEntrySlot *>(entry);
+    LazyMutex::ScopedLock guard(lock);
+    slot->next = freeList;
+    freeList = slot;
+  }
+};
+
+constexpr size_t NumSideTableShards = 16;
+SideTableShard SideTableShards[NumSideTableShards];
+
+SideTableShard &sideTableShard(const void *ptr) {
+  // Discard the alignment bits; neighboring entries then map to different
+  // shards, so frees of entries from one slab spread out as well.
+  auto value = reinterpret_cast<uintptr_t>(ptr);
+  return SideTableShards[(value / sizeof(HeapObjectSideTableEntry)) %
+                         NumSideTableShards];
+}
+
+} // end anonymous namespace
+
+extern "C" void _swift_sideTableEntryFree(void *entry) {
+  sideTableShard(entry).deallocate(entry);
+}
+
 // Return an object's side table, allocating it if necessary.
 // Returns null if the object is deiniting.
 // SideTableRefCountBits specialization intentionally does not exist.
@@ -34,10 +111,9 @@ HeapObjectSideTableEntry* RefCounts<InlineRefCountBits>::allocateSideTable(bool
     return nullptr;
   }
 
-  // Preflight passed. Allocate a side table.
-
-  // FIXME: custom side table allocator
-  auto side = swift_cxx_newObject<HeapObjectSideTableEntry>(getHeapObject());
+  // Preflight passed. Allocate a side table from the sharded pool.
+  auto side = ::new (sideTableShard(getHeapObject()).allocate())
+      HeapObjectSideTableEntry(getHeapObject());
 
   auto newbits = InlineRefCountBits(side);
 
@@ -46,7 +122,8 @@ HeapObjectSideTableEntry* RefCounts<InlineRefCountBits>::allocateSideTable(bool
       // Already have a side table. Return it and delete ours.
       // Read before delete to streamline barriers.
       auto result = oldbits.getSideTable();
-      swift_cxx_deleteObject(side);
+      side->~HeapObjectSideTableEntry();
+      _swift_sideTableEntryFree(side);
       return result;
     }
     else if (failIfDeiniting && oldbits.getIsDeiniting()) {
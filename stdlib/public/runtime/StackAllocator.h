@@ -24,6 +24,7 @@
 #include "swift/ABI/MetadataValues.h"
 #include "swift/Runtime/Debug.h"
 #include "llvm/Support/Alignment.h"
+#include <atomic>
 #include <cstddef>
 #include <new>
 
@@ -226,6 +227,51 @@ private:
     }
   };
 
+  /// A small process-wide cache of freed standard-capacity slabs.
+  ///
+  /// Allocators with a stack discipline tend to churn the same slab sizes:
+  /// every short-lived task allocates a slab at its high-water mark and
+  /// frees it at teardown. Routing standard-capacity slabs through this
+  /// cache keeps tight spawn loops from contending on the global malloc.
+  ///
+  /// The cache is a fixed array of slots operated on only with atomic
+  /// exchanges, which keeps it lock-free without any ABA hazard. A slot
+  /// scan either finds a slab or falls back to malloc/free, so the cache
+  /// is purely an optimization and bounds its retained memory to
+  /// \c cacheSlots slabs.
+  struct SlabCache {
+    static constexpr unsigned cacheSlots = 16;
+    std::atomic<Slab *> slots[cacheSlots] = {};
+
+    /// Take a cached slab, or return null if the cache is empty.
+    Slab *tryPop() {
+      for (auto &slot : slots) {
+        if (slot.load(std::memory_order_relaxed)) {
+          if (Slab *slab = slot.exchange(nullptr, std::memory_order_acquire))
+            return slab;
+        }
+      }
+      return nullptr;
+    }
+
+    /// Cache \p slab, or return false if all slots are occupied.
+    bool tryPush(Slab *slab) {
+      for (auto &slot : slots) {
+        if (!slot.load(std::memory_order_relaxed)) {
+          Slab *expected = nullptr;
+          if (slot.compare_exchange_strong(expected, slab,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed))
+            return true;
+        }
+      }
+      return false;
+    }
+  };
+
+  /// The slab cache shared by all allocators of this instantiation.
+  static SlabCache sharedSlabCache;
+
   // Return a slab which is suitable to allocate \p size memory.
   Slab *getSlabForAllocation(size_t size) {
     Slab *slab = (lastAllocation ? lastAllocation->slab : firstSlab);
@@ -251,8 +297,15 @@ private:
     }
     size_t capacity = std::max(SlabCapacity,
                                Allocation::includingHeader(size));
-    void *slabBuffer = malloc(Slab::includingHeader(capacity));
-    Slab *newSlab = ::new (slabBuffer) Slab(capacity);
+    Slab *newSlab = nullptr;
+    if (capacity == SlabCapacity)
+      newSlab = sharedSlabCache.tryPop();
+    if (newSlab) {
+      assert(newSlab->isEmpty() && !newSlab->next);
+    } else {
+      void *slabBuffer = malloc(Slab::includingHeader(capacity));
+      newSlab = ::new (slabBuffer) Slab(capacity);
+    }
     if (slab)
       slab->next = newSlab;
     else
@@ -269,9 +322,19 @@ private:
     while (slab) {
       Slab *next = slab->next;
       freedCapacity += slab->capacity;
+      numAllocatedSlabs--;
+      // All freed slabs are empty; standard-capacity ones go back into the
+      // shared cache for reuse by other allocators.
+      assert(slab->isEmpty());
+      if (slab->capacity == SlabCapacity) {
+        slab->next = nullptr;
+        if (sharedSlabCache.tryPush(slab)) {
+          slab = next;
+          continue;
+        }
+      }
       slab->clearMetadata();
       free(slab);
-      numAllocatedSlabs--;
       slab = next;
     }
     return freedCapacity;
@@ -337,7 +400,20 @@ public:
 
   /// For unit testing.
   int getNumAllocatedSlabs() { return numAllocatedSlabs; }
+
+  /// Return the total payload capacity of all slabs, including a
+  /// pre-allocated first slab. For statistics and unit testing.
+  size_t getTotalSlabCapacity() const {
+    size_t capacity = 0;
+    for (Slab *slab = firstSlab; slab; slab = slab->next)
+      capacity += slab->capacity;
+    return capacity;
+  }
 };
 
+template <size_t SlabCapacity, Metadata *SlabMetadataPtr>
+typename StackAllocator<SlabCapacity, SlabMetadataPtr>::SlabCache
+    StackAllocator<SlabCapacity, SlabMetadataPtr>::sharedSlabCache;
+
 } // namespace swift
 
@@ -24,6 +24,7 @@
 
 #include "swift/shims/UnicodeData.h"
 #include <stdint.h>
+#include <string.h>
 
 SWIFT_RUNTIME_STDLIB_INTERNAL
 __swift_uint16_t _swift_stdlib_getNormData(__swift_uint32_t scalar) {
@@ -59,6 +60,43 @@ SWIFT_RUNTIME_STDLIB_INTERNAL
 const __swift_uint8_t * const _swift_stdlib_nfd_decompositions = nullptr;
 #endif
 
+SWIFT_RUNTIME_STDLIB_INTERNAL
+__swift_intptr_t _swift_stdlib_nfcFastPathLength(const __swift_uint8_t *buffer,
+                                                 __swift_intptr_t count) {
+  // Returns the length of the prefix of 'buffer' containing only bytes less
+  // than 0xCC. Starting from a scalar boundary, every such byte belongs to a
+  // scalar below U+0300, which is always NFC and has a canonical combining
+  // class of 0, so callers can skip the whole prefix without consulting the
+  // normalization data. Any byte >= 0xCC is necessarily a lead byte
+  // (continuation bytes are <= 0xBF), so the scan always stops on a scalar
+  // boundary.
+  __swift_intptr_t index = 0;
+
+  // Scan a word at a time. A byte is >= 0xCC exactly when its high bit is
+  // set and its low seven bits are >= 0x4C, which the addition below carries
+  // into the high bit of each byte lane.
+  const uintptr_t ones = (uintptr_t)-1 / 0xFF;
+  const __swift_intptr_t wordSize = (__swift_intptr_t)sizeof(uintptr_t);
+  while (count - index >= wordSize) {
+    uintptr_t word;
+    memcpy(&word, buffer + index, sizeof(word));
+
+    uintptr_t found =
+        (((word & (ones * 0x7F)) + (ones * 0x34)) & word) & (ones * 0x80);
+    if (found != 0) {
+      break;
+    }
+
+    index += wordSize;
+  }
+
+  while (index < count && buffer[index] < 0xCC) {
+    index += 1;
+  }
+
+  return index;
+}
+
 SWIFT_RUNTIME_STDLIB_INTERNAL
 __swift_uint32_t _swift_stdlib_getDecompositionEntry(__swift_uint32_t scalar) {
 #if !SWIFT_STDLIB_ENABLE_UNICODE_DATA
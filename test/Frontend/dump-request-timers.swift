@@ -0,0 +1,6 @@
+// RUN: %target-swift-frontend -typecheck -dump-request-timers %s 2>&1 | %FileCheck %s
+
+func f() -> Int { return 0 }
+
+// CHECK: ===REQUEST TIMERS===
+// CHECK: TypeCheckSourceFileRequest
@@ -0,0 +1,7 @@
+// RUN: %target-swift-frontend -module-name someModule -embed-sil -emit-ir -o - %s | %FileCheck %s
+
+// CHECK: @llvm.embedded.swift.sil = private constant [{{[0-9]+}} x i8] c"{{.*}}", section "__LLVM,__swift_sil"
+// CHECK: @llvm.compiler.used = appending global {{.*}}@llvm.embedded.swift.sil
+
+func test() {
+}
@@ -0,0 +1,5 @@
+// RUN: %target-swift-frontend -typecheck -enable-filesystem-stat-cache %s
+
+import Swift
+
+func f() -> Int { return 42 }
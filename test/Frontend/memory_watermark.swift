@@ -0,0 +1,7 @@
+// RUN: %target-swift-frontend -typecheck -memory-watermark-mb=1 %s 2>&1 | %FileCheck %s
+// RUN: not %target-swift-frontend -typecheck -memory-watermark-mb=nonsense %s 2>&1 | %FileCheck -check-prefix=INVALID %s
+
+// CHECK: warning: compilation is retaining {{[0-9]+}} MB of memory, exceeding the configured watermark of 1 MB
+// INVALID: error: invalid value 'nonsense' in '-memory-watermark-mb=nonsense'
+
+func watermarked() {}
@@ -0,0 +1,18 @@
+// RUN: %target-swift-frontend -module-name builtins -parse-stdlib -primary-file %s -emit-ir -o - | %FileCheck %s
+
+// REQUIRES: CPU=arm64 || CPU=arm64e
+
+import Swift
+
+// Target-specific intrinsics resolve through the same Builtin.int_* surface
+// as target-independent ones when compiling for a matching target.
+
+func neon_addp(_ a: Builtin.Vec4xInt32, _ b: Builtin.Vec4xInt32) -> Builtin.Vec4xInt32 {
+  // CHECK: call <4 x i32> @llvm.aarch64.neon.addp.v4i32
+  return Builtin.int_aarch64_neon_addp_Vec4xInt32(a, b)
+}
+
+func neon_sqadd(_ a: Builtin.Vec8xInt16, _ b: Builtin.Vec8xInt16) -> Builtin.Vec8xInt16 {
+  // CHECK: call <8 x i16> @llvm.aarch64.neon.sqadd.v8i16
+  return Builtin.int_aarch64_neon_sqadd_Vec8xInt16(a, b)
+}
@@ -0,0 +1,49 @@
+// RUN: %empty-directory(%t)
+// RUN: echo '# profile of observed runtime instantiations' > %t/prespecialize.list
+// RUN: echo '$s4main5ValueVySiGD' >> %t/prespecialize.list
+// RUN: %swift -prespecialize-generic-metadata-list=%t/prespecialize.list -target %module-target-future -emit-ir %s | %FileCheck %s -DINT=i%target-ptrsize -DALIGNMENT=%target-alignment
+
+// REQUIRES: VENDOR=apple || OS=linux-gnu
+// UNSUPPORTED: CPU=i386 && OS=ios
+// UNSUPPORTED: CPU=armv7 && OS=ios
+// UNSUPPORTED: CPU=armv7s && OS=ios
+
+// Although no specialization of Value appears in source, the record for the
+// listed specialization is emitted, canonically, as if it had been used.
+
+// CHECK: @"$s4main5ValueVySiGMf" = linkonce_odr hidden constant <{
+// CHECK-SAME:    ptr,
+// CHECK-SAME:    [[INT]],
+// CHECK-SAME:    ptr,
+// CHECK-SAME:    ptr,
+// CHECK-SAME:    i32,
+// CHECK-SAME:    i64
+// CHECK-SAME: }> <{
+//                ptr @"$sB[[INT]]_WV",
+//                ptr {{[^@]*}}@"$s4main5ValueVySiGWV"{{[^,]*}},
+// CHECK-SAME:    [[INT]] 512,
+// CHECK-SAME:    $s4main5ValueVMn
+// CHECK-SAME:    $sSiN
+// CHECK-SAME:    i32 0,
+// CHECK-SAME:    i64 3
+// CHECK-SAME: }>, align [[ALIGNMENT]]
+
+struct Value<First> {
+  let first: First
+}
+
+func doit() {
+}
+doit()
+
+// CHECK: ; Function Attrs: noinline nounwind memory(none)
+// CHECK: define hidden swiftcc %swift.metadata_response @"$s4main5ValueVMa"([[INT]] %0, ptr %1) #{{[0-9]+}} {{(section)?.*}}{
+// CHECK:      call swiftcc %swift.metadata_response @__swift_instantiateCanonicalPrespecializedGenericMetadata(
+// CHECK-SAME:    [[INT]] %0,
+// CHECK-SAME:   ptr %1,
+// CHECK-SAME:   ptr undef,
+// CHECK-SAME:   ptr undef,
+// CHECK-SAME:   $s4main5ValueVMn
+// CHECK-SAME:   $s4main5ValueVMz
+// CHECK:   ret %swift.metadata_response {{%[0-9]+}}
+// CHECK: }
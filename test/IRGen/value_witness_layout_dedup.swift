@@ -0,0 +1,25 @@
+// RUN: %target-swift-frontend -parse-as-library -module-name test -enable-type-layouts -force-struct-type-layouts -emit-ir %s | %FileCheck %s
+
+// REQUIRES: swift_in_compiler
+
+class C {}
+
+struct First {
+  var ref: C
+  var count: Int
+}
+
+struct Second {
+  var other: C
+  var total: Int
+}
+
+// Both structs unique to the same type layout entry, so Second's value
+// witness table reuses the copy/destroy witnesses emitted for First.
+
+// CHECK: @"$s4test6SecondVWV" = {{.*}} @"$s4test5FirstVwCP"{{.*}} @"$s4test5FirstVwxx"{{.*}} @"$s4test5FirstVwcp"{{.*}} @"$s4test5FirstVwca"{{.*}} @"$s4test5FirstVwta"
+
+// CHECK: define internal ptr @"$s4test5FirstVwCP"
+// CHECK: define internal void @"$s4test5FirstVwxx"
+
+// CHECK-NOT: define internal void @"$s4test6SecondVwxx"
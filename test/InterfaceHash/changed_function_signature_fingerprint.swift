@@ -0,0 +1,42 @@
+// When a top-level function's signature changes, its fingerprint should
+// change, but the fingerprints of the other declarations in the file should
+// not, so only the edited function's dependents get invalidated.
+
+// RUN: %empty-directory(%t)
+// RUN: %{python} %utils/split_file.py -o %t %s
+// RUN: cp %t/{a,x}.swift
+// RUN: %target-swift-frontend -typecheck -primary-file %t/x.swift -emit-reference-dependencies-path %t/x.swiftdeps -module-name main
+// RUN: %{python} %S/../Inputs/process_fine_grained_swiftdeps_with_fingerprints.py %swift-dependency-tool %t/x.swiftdeps > %t/a-processed.swiftdeps
+// RUN: cp %t/{b,x}.swift
+// RUN: %target-swift-frontend -typecheck -primary-file %t/x.swift -emit-reference-dependencies-path %t/x.swiftdeps -module-name main
+// RUN: %{python} %S/../Inputs/process_fine_grained_swiftdeps_with_fingerprints.py %swift-dependency-tool %t/x.swiftdeps > %t/b-processed.swiftdeps
+
+// RUN: not diff -u %t/a-processed.swiftdeps %t/b-processed.swiftdeps > %t/diffs
+
+// BEGIN a.swift
+func f(_ x: Int = 0) -> Int {
+    return x
+}
+
+func g() -> Int {
+    return 0
+}
+
+// BEGIN b.swift
+func f(_ x: Int = 1) -> Int {
+    return x
+}
+
+func g() -> Int {
+    return 0
+}
+
+// RUN: %FileCheck %s <%t/diffs -check-prefix=CHECK-DIFFERENT-FUNCTION-FINGERPRINT
+// RUN: %FileCheck %s <%t/diffs -check-prefix=CHECK-SAME-OTHER-FUNCTION
+
+// CHECK-DIFFERENT-FUNCTION-FINGERPRINT-DAG: -topLevel implementation '' f true
+// CHECK-DIFFERENT-FUNCTION-FINGERPRINT-DAG: -topLevel interface      '' f true
+// CHECK-DIFFERENT-FUNCTION-FINGERPRINT-DAG: +topLevel implementation '' f true
+// CHECK-DIFFERENT-FUNCTION-FINGERPRINT-DAG: +topLevel interface      '' f true
+
+// CHECK-SAME-OTHER-FUNCTION-NOT: {{^[+-]}}topLevel {{.*}} g true
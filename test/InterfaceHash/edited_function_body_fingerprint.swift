@@ -0,0 +1,24 @@
+// When a top-level function body is edited, neither the interface hash nor
+// the function's fingerprint should change, so the emitted swiftdeps should
+// be identical and no dependents get invalidated.
+
+// RUN: %empty-directory(%t)
+// RUN: %{python} %utils/split_file.py -o %t %s
+// RUN: cp %t/{a,x}.swift
+// RUN: %target-swift-frontend -typecheck -primary-file %t/x.swift -emit-reference-dependencies-path %t/x.swiftdeps -module-name main
+// RUN: %{python} %S/../Inputs/process_fine_grained_swiftdeps_with_fingerprints.py %swift-dependency-tool %t/x.swiftdeps > %t/a-processed.swiftdeps
+// RUN: cp %t/{b,x}.swift
+// RUN: %target-swift-frontend -typecheck -primary-file %t/x.swift -emit-reference-dependencies-path %t/x.swiftdeps -module-name main
+// RUN: %{python} %S/../Inputs/process_fine_grained_swiftdeps_with_fingerprints.py %swift-dependency-tool %t/x.swiftdeps > %t/b-processed.swiftdeps
+
+// RUN: diff %t/a-processed.swiftdeps %t/b-processed.swiftdeps
+
+// BEGIN a.swift
+func f() -> Int {
+    return 0
+}
+
+// BEGIN b.swift
+func f() -> Int {
+    return 1
+}
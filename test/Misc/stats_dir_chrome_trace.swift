@@ -0,0 +1,14 @@
+// RUN: %empty-directory(%t)
+// RUN: %target-swiftc_driver -o %t/main -module-name main -stats-output-dir %t %s -trace-stats-chrome
+// RUN: %FileCheck -input-file %t/chrometrace-*.json %s
+
+// Spans are complete ("ph": "X") trace events with microsecond start and
+// duration, so viewers can rebuild the phase hierarchy.
+// CHECK: [
+// CHECK-DAG: {"name": "perform-sema", "cat": "swift", "ph": "X", "ts": {{[0-9]+}}, "dur": {{[0-9]+}}, "pid": {{[0-9]+}}, "tid": 0}
+// CHECK-DAG: {"name": "typecheck-expr{{.*}}", "cat": "swift", "ph": "X", "ts": {{[0-9]+}}, "dur": {{[0-9]+}}, "pid": {{[0-9]+}}, "tid": 0}
+// CHECK: ]
+
+public func foo() {
+    print("hello")
+}
@@ -0,0 +1,12 @@
+// RUN: %empty-directory(%t)
+// RUN: %target-swiftc_driver -o %t/main -module-name main -stats-output-dir %t %s -stream-stats-events
+// RUN: %{python} %utils/follow-stats-stream.py %t/stats.swiftstats | %FileCheck %s
+
+// The stream contains the schema columns and at least one final record for
+// this process.
+// CHECK: time_usec,pid,final,aux{{.*}}Frontend.NumProcessFailures
+// CHECK: {{[0-9]+,[0-9]+,1,main-stats_dir_stream.swift.*}}
+
+public func foo() {
+    print("hello")
+}
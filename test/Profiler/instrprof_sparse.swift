@@ -0,0 +1,45 @@
+// RUN: %target-swift-frontend -parse-as-library -emit-silgen -module-name instrprof_sparse -profile-generate -profile-coverage-mapping -profile-sparse-coverage %s | %FileCheck %s
+// RUN: %target-swift-frontend -parse-as-library -profile-generate -profile-coverage-mapping -profile-sparse-coverage -emit-ir %s
+
+enum SomeErr : Error {
+  case Err1
+}
+
+func throwingFn() throws {}
+
+// With sparse instrumentation only the function entry counter is incremented,
+// but the counter slots for the other regions are still reserved so the
+// coverage mapping is unchanged.
+
+// CHECK-LABEL: sil hidden [ossa] @[[F_BRANCHES:.*branches.*]] :
+// CHECK: increment_profiler_counter 0, "{{.*}}instrprof_sparse.swift:[[F_BRANCHES]]", num_counters 4, hash
+// CHECK-NOT: increment_profiler_counter
+// CHECK-LABEL: sil hidden [ossa] @[[F_THROWING:.*throwing.*]] :
+func branches(a : Int32) {
+  if a == 0 {
+  }
+
+  if a != 0 {
+  } else {
+  }
+
+  while a == 0 {
+  }
+}
+
+// Error branches are still instrumented; the only other counter incremented
+// is the function entry counter.
+
+// CHECK: increment_profiler_counter 0, "{{.*}}instrprof_sparse.swift:[[F_THROWING]]", num_counters 2, hash
+// CHECK: increment_profiler_counter 1, "{{.*}}instrprof_sparse.swift:[[F_THROWING]]", num_counters 2, hash
+func throwing(a : Int32) throws {
+  try throwingFn()
+}
+
+// The coverage mapping still references the unincremented counters.
+
+// CHECK-LABEL: sil_coverage_map {{.*}}// instrprof_sparse.branches
+// CHECK: : 0
+// CHECK: : 1
+// CHECK: : 2
+// CHECK: : 3
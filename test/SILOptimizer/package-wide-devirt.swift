@@ -0,0 +1,50 @@
+/// Tests devirtualization of class methods defined in a co-built module of
+/// the same package under -experimental-package-wide-devirtualization.
+///
+// RUN: %empty-directory(%t)
+// RUN: split-file %s %t
+
+// RUN: %target-build-swift %t/Lib.swift \
+// RUN: -module-name=Lib -package-name Pkg \
+// RUN: -parse-as-library -emit-module -emit-module-path %t/Lib.swiftmodule -I%t \
+// RUN: -Xfrontend -experimental-package-cmo -Xfrontend -experimental-allow-non-resilient-access \
+// RUN: -enable-library-evolution -wmo
+
+// RUN: %target-build-swift -module-name=Main -package-name Pkg -I%t -O -wmo \
+// RUN: -Xfrontend -experimental-package-wide-devirtualization \
+// RUN: -emit-sil %t/main.swift -o %t/Main.sil
+// RUN: %FileCheck %s --check-prefix=CHECK-DEVIRT < %t/Main.sil
+
+// RUN: %target-build-swift -module-name=Main -package-name Pkg -I%t -O -wmo \
+// RUN: -emit-sil %t/main.swift -o %t/Main-base.sil
+// RUN: %FileCheck %s --check-prefix=CHECK-BASE < %t/Main-base.sil
+
+// REQUIRES: swift_in_compiler
+
+//--- main.swift
+
+import Lib
+
+// `k` has a static but not exact type, so the call can only be made direct
+// if PkgKlass.pkgFunc is known to have no overrides anywhere in the package.
+// CHECK-DEVIRT-LABEL: sil {{.*}}@$s4Main8callFuncySi3Lib8PkgKlassCF :
+// CHECK-DEVIRT-NOT: class_method
+// CHECK-DEVIRT: } // end sil function '$s4Main8callFuncySi3Lib8PkgKlassCF'
+
+// CHECK-BASE-LABEL: sil {{.*}}@$s4Main8callFuncySi3Lib8PkgKlassCF :
+// CHECK-BASE: class_method
+package func callFunc(_ k: PkgKlass) -> Int {
+  return k.pkgFunc()
+}
+
+//--- Lib.swift
+
+package class PkgKlass {
+  package var value: Int
+  package init(_ arg: Int) {
+    value = arg
+  }
+  package func pkgFunc() -> Int {
+    return value
+  }
+}
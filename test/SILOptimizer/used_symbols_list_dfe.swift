@@ -0,0 +1,31 @@
+// RUN: %empty-directory(%t)
+// RUN: split-file %s %t
+// RUN: %target-swift-frontend %t/main.swift -parse-as-library -module-name main -O -emit-sil -used-symbols-list=%t/used.txt | %FileCheck %s
+// RUN: %target-swift-frontend %t/main.swift -parse-as-library -module-name main -O -emit-sil | %FileCheck %s --check-prefix=CHECK-NOLIST
+
+// REQUIRES: swift_in_compiler
+
+//--- used.txt
+# Symbols referenced from outside the module, as resolved by the build
+# system over the whole program.
+$s4main7usedPubyyF
+
+//--- main.swift
+
+// CHECK-LABEL: sil @$s4main7usedPubyyF
+// CHECK-NOLIST: sil @$s4main7usedPubyyF
+public func usedPub() {
+  calledFromUsed()
+}
+
+// Kept alive as a callee of usedPub even though it is not in the list.
+// CHECK: sil {{.*}}@$s4main14calledFromUsedyyF
+@inline(never)
+public func calledFromUsed() {
+}
+
+// Not in the list and not referenced within the module, so it can go away.
+// CHECK-NOT: deadPub
+// CHECK-NOLIST: sil @$s4main7deadPubyyF
+public func deadPub() {
+}
@@ -0,0 +1,21 @@
+/// Adds two numbers.
+func add(_ x: Int, _ y: Int) -> Int { return x + y }
+
+// RUN: %sourcekitd-test -req=cursor -pos=%(line + 2):7 %s -- %s == -req=cursor -pos=%(line + 3):7 %s -- %s | %FileCheck %s
+func foo() {
+  _ = add(1, 2)
+  _ = add(3, 4)
+}
+
+// The second request reuses the memoized declaration rendering and must
+// produce the same annotated declaration and doc comment as the first.
+
+// CHECK: source.lang.swift.ref.function.free
+// CHECK-NEXT: add(_:_:)
+// CHECK: <Declaration>func add{{.*}}</Declaration>
+// CHECK: Adds two numbers.
+
+// CHECK: source.lang.swift.ref.function.free
+// CHECK-NEXT: add(_:_:)
+// CHECK: <Declaration>func add{{.*}}</Declaration>
+// CHECK: Adds two numbers.
@@ -0,0 +1,14 @@
+func refX() -> Int {
+  let x = 1
+  return x
+}
+
+func refY() -> Int {
+  let y = 2
+  return y
+}
+
+// REQUIRES: swift_swift_parser
+// RUN: %empty-directory(%t.result)
+// RUN: %refactor -find-local-rename-ranges -source-filename %s -pos=2:7 -pos=7:7 > %t.result/batch.swift
+// RUN: diff -u %S/Outputs/batchLocal/batch.swift.expected %t.result/batch.swift
@@ -353,6 +353,12 @@ class ASTBuildOperation
   /// building. When this vector is empty, the AST build can be cancelled.
   SmallVector<SwiftASTConsumerRef, 4> Consumers = {};
 
+  /// The highest priority of any consumer that has been added to this
+  /// operation. Used to pick the next operation to run when the AST build
+  /// slot becomes free.
+  /// Must only be accessed if \c ConsumersAndResultMtx has been claimed.
+  SwiftASTConsumer::Priority Priority = SwiftASTConsumer::Priority::Background;
+
   /// Once the build operation has finished, its result, which can be an AST, an
   /// error or the fact that it has been cancelled.
   ASTBuildResult Result;
@@ -373,6 +379,11 @@ class ASTBuildOperation
   /// depends on the severity of the error.
   ASTUnitRef buildASTUnit(std::string &Error);
 
+  /// Build the AST and inform all consumers about the result, synchronously
+  /// on the current thread. This is the body of a scheduled build operation
+  /// and must only be called from \c schedule's dispatched job.
+  void run();
+
   /// Transition the build operation to \p NewState, asserting that the current
   /// state is \p ExpectedOldState.
   void transitionToState(State NewState, State ExpectedOldState) {
@@ -417,6 +428,12 @@ public:
            CancellationFlag->load(std::memory_order_relaxed);
   }
 
+  /// The highest priority among this operation's consumers.
+  SwiftASTConsumer::Priority getPriority() {
+    llvm::sys::ScopedLock L(ConsumersAndResultMtx);
+    return Priority;
+  }
+
   size_t getMemoryCost() {
     size_t Cost = sizeof(*this) + getVectorMemoryCost(FileContents) +
                   Result.getMemoryCost();
@@ -426,7 +443,10 @@ public:
     return Cost;
   }
 
-  /// Schedule building this AST on the given \p Queue.
+  /// Schedule building this AST on the given \p Queue. The operation joins
+  /// the manager's list of pending builds; when \p Queue gets to execute the
+  /// dispatched job, the pending operation with the highest consumer priority
+  /// runs, which is not necessarily this one.
   void schedule(WorkQueue Queue);
 
   /// Inform the given \p Consumer when the AST has been built. If the build
@@ -619,6 +639,14 @@ struct SwiftASTManager::Implementation {
   WorkQueue ASTBuildQueue{ WorkQueue::Dequeuing::Serial,
                            "sourcekit.swift.ASTBuilding" };
 
+  /// Build operations that are waiting for the AST build slot on \c
+  /// ASTBuildQueue. When the slot becomes free, the waiting operation with
+  /// the highest consumer priority runs next (FIFO within one priority), so
+  /// interactive requests are not stuck behind background indexing.
+  /// Must only be accessed if \c PendingASTBuildsMtx has been claimed.
+  llvm::sys::Mutex PendingASTBuildsMtx;
+  std::vector<ASTBuildOperationRef> PendingASTBuilds;
+
   /// Queue on which consumers may be notified about results and cancellation.
   /// This is essentially just a background queue to which we can jump to inform
   /// consumers while making sure that no locks are currently claimed.
@@ -1233,55 +1261,80 @@ ASTUnitRef ASTBuildOperation::buildASTUnit(std::string &Error) {
 
 void ASTBuildOperation::schedule(WorkQueue Queue) {
   transitionToState(State::Queued, /*ExpectedOldState=*/State::Created);
-  auto SharedThis = shared_from_this();
-  // Capture `SharedThis` in the dispatched lambda to keep `this` alive.
-  // Capture `this` for a more convenient access of members.
+  // Keep the manager alive in the dispatched job; it owns the pending list.
+  SwiftASTManagerRef Mgr = ASTManager;
+  {
+    llvm::sys::ScopedLock L(Mgr->Impl.PendingASTBuildsMtx);
+    Mgr->Impl.PendingASTBuilds.push_back(shared_from_this());
+  }
+  // Each dispatched job runs exactly one pending build operation: the one
+  // with the highest consumer priority at the time the job starts, which is
+  // not necessarily the operation that was enqueued along with the job.
+  // Every enqueued operation is matched by one dispatched job, so the
+  // pending list can never be empty here.
   Queue.dispatch(
-      [this, SharedThis] {
-        transitionToState(State::Running, /*ExpectedOldState=*/State::Queued);
-
-        SWIFT_DEFER {
-          transitionToState(State::Finished,
-                            /*ExpectedOldState=*/State::Running);
-        };
-
-        SmallVector<SwiftASTConsumerRef, 4> ConsumersToCancel;
+      [Mgr] {
+        ASTBuildOperationRef BuildOp;
         {
-          llvm::sys::ScopedLock L(ConsumersAndResultMtx);
-          if (Consumers.empty()) {
-            // There are no consumers - no point creating the AST anymore.
-            Result.emplace(/*AST=*/nullptr, /*Error=*/"", /*Cancelled=*/true);
-            return;
-          }
-          if (CancellationFlag->load(std::memory_order_relaxed)) {
-            assert(false && "We should only set the cancellation flag if there "
-                            "are no more consumers");
-            ConsumersToCancel = Consumers;
+          llvm::sys::ScopedLock L(Mgr->Impl.PendingASTBuildsMtx);
+          auto &Pending = Mgr->Impl.PendingASTBuilds;
+          assert(!Pending.empty() && "dispatched job without a pending build");
+          auto Best = Pending.begin();
+          for (auto I = std::next(Best), E = Pending.end(); I != E; ++I) {
+            if ((*I)->getPriority() < (*Best)->getPriority())
+              Best = I;
           }
+          BuildOp = *Best;
+          Pending.erase(Best);
         }
-        for (auto &Consumer : ConsumersToCancel) {
-          Consumer->cancelled();
-        }
-
-        std::string Error;
-        assert(!Result && "We should only be producing a result once");
-        ASTUnitRef AST = buildASTUnit(Error);
-        SmallVector<SwiftASTConsumerRef, 4> ConsumersToInform;
-        {
-          llvm::sys::ScopedLock L(ConsumersAndResultMtx);
-          bool WasCancelled = CancellationFlag->load(std::memory_order_relaxed);
-          Result.emplace(AST, Error, WasCancelled);
-          ConsumersToInform = Consumers;
-          Consumers = {};
-        }
-        for (auto &Consumer : ConsumersToInform) {
-          informConsumer(Consumer);
-        }
-        DidFinishCallback();
+        BuildOp->run();
       },
       /*isStackDeep=*/true);
 }
 
+void ASTBuildOperation::run() {
+  transitionToState(State::Running, /*ExpectedOldState=*/State::Queued);
+
+  SWIFT_DEFER {
+    transitionToState(State::Finished,
+                      /*ExpectedOldState=*/State::Running);
+  };
+
+  SmallVector<SwiftASTConsumerRef, 4> ConsumersToCancel;
+  {
+    llvm::sys::ScopedLock L(ConsumersAndResultMtx);
+    if (Consumers.empty()) {
+      // There are no consumers - no point creating the AST anymore.
+      Result.emplace(/*AST=*/nullptr, /*Error=*/"", /*Cancelled=*/true);
+      return;
+    }
+    if (CancellationFlag->load(std::memory_order_relaxed)) {
+      assert(false && "We should only set the cancellation flag if there "
+                      "are no more consumers");
+      ConsumersToCancel = Consumers;
+    }
+  }
+  for (auto &Consumer : ConsumersToCancel) {
+    Consumer->cancelled();
+  }
+
+  std::string Error;
+  assert(!Result && "We should only be producing a result once");
+  ASTUnitRef AST = buildASTUnit(Error);
+  SmallVector<SwiftASTConsumerRef, 4> ConsumersToInform;
+  {
+    llvm::sys::ScopedLock L(ConsumersAndResultMtx);
+    bool WasCancelled = CancellationFlag->load(std::memory_order_relaxed);
+    Result.emplace(AST, Error, WasCancelled);
+    ConsumersToInform = Consumers;
+    Consumers = {};
+  }
+  for (auto &Consumer : ConsumersToInform) {
+    informConsumer(Consumer);
+  }
+  DidFinishCallback();
+}
+
 bool ASTBuildOperation::addConsumer(SwiftASTConsumerRef Consumer) {
   {
     llvm::sys::ScopedLock L(ConsumersAndResultMtx);
@@ -1294,6 +1347,8 @@ bool ASTBuildOperation::addConsumer(SwiftASTConsumerRef Consumer) {
     }
     assert(OperationState != State::Finished);
     Consumers.push_back(Consumer);
+    if (Consumer->getPriority() < Priority)
+      Priority = Consumer->getPriority();
   }
   auto WeakThis = std::weak_ptr<ASTBuildOperation>(shared_from_this());
   Consumer->setCancellationRequestCallback(
@@ -162,6 +162,27 @@ public:
   /// work that might require more stack size, such as invoking SwiftParser.
   virtual bool requiresDeepStack() { return false; }
 
+  // MARK: Scheduling priority
+
+  /// The urgency with which this consumer needs its AST. Only one AST is
+  /// built at a time; when multiple build operations are waiting for that
+  /// slot, the operation serving the highest-priority consumer runs next,
+  /// independently of the order in which the requests arrived.
+  ///
+  /// Lower numeric values are more urgent.
+  enum class Priority {
+    /// The result is blocking user interaction in the editor, e.g. semantic
+    /// annotations and diagnostics for an open document.
+    Interactive,
+    /// Ordinary semantic requests like cursor info.
+    Default,
+    /// The result is not immediately user-visible, e.g. background indexing.
+    Background,
+  };
+
+  /// The priority with which the AST for this consumer should be built.
+  virtual Priority getPriority() { return Priority::Default; }
+
   // MARK: Cancellation
 
   /// The result of this consumer is no longer of interest to the SourceKit
@@ -730,6 +730,10 @@ class SwiftDocumentSyntaxInfo {
   unsigned BufferID;
   std::vector<std::string> Args;
   std::string PrimaryFile;
+  /// The document snapshot this syntax info was built from. Held so that
+  /// the source buffer below, which references the snapshot's storage
+  /// without copying it, stays valid for the life of the parse.
+  ImmutableTextSnapshotRef Snapshot;
   bool IsParsed;
 
 public:
@@ -737,13 +741,16 @@ public:
                           ImmutableTextSnapshotRef Snapshot,
                           std::vector<std::string> &Args,
                           StringRef FilePath)
-        : Args(Args), PrimaryFile(FilePath) {
+        : Args(Args), PrimaryFile(FilePath), Snapshot(Snapshot) {
 
-    std::unique_ptr<llvm::MemoryBuffer> BufCopy =
-      llvm::MemoryBuffer::getMemBufferCopy(
+    // Snapshots are immutable and their text is backed by a null-terminated
+    // MemoryBuffer, so the parser can read straight out of the snapshot
+    // instead of copying the whole document on every edit.
+    std::unique_ptr<llvm::MemoryBuffer> Buf =
+      llvm::MemoryBuffer::getMemBuffer(
         Snapshot->getBuffer()->getText(), FilePath);
 
-    BufferID = SM.addNewSourceBuffer(std::move(BufCopy));
+    BufferID = SM.addNewSourceBuffer(std::move(Buf));
 
     Parser.reset(new ParserUnit(
         SM, SourceFileKind::Main, BufferID, CompInv.getLangOptions(),
@@ -1066,6 +1073,8 @@ public:
     LOG_WARN_FUNC("sema annotations failed: " << Error);
   }
 
+  Priority getPriority() override { return Priority::Interactive; }
+
   void handlePrimaryAST(ASTUnitRef AstUnit) override {
     auto Generation = AstUnit->getGeneration();
     auto &CompIns = AstUnit->getCompilerInstance();
@@ -1170,8 +1179,18 @@ struct SwiftEditorDocument::Implementation {
 
   std::shared_ptr<SwiftDocumentSyntaxInfo> SyntaxInfo;
 
+  /// The snapshot the next lazily-built SyntaxInfo should parse. Updated on
+  /// every edit; the SyntaxInfo itself is only built when a consumer asks for
+  /// syntactic information.
+  ImmutableTextSnapshotRef SyntaxInfoSnapshot;
+
+  /// Build SyntaxInfo for SyntaxInfoSnapshot if it has not been built yet.
+  /// Must be called with AccessMtx held.
+  void ensureSyntaxInfo();
+
   std::shared_ptr<SwiftDocumentSyntaxInfo> getSyntaxInfo() {
     llvm::sys::ScopedLock L(AccessMtx);
+    ensureSyntaxInfo();
     SyntaxInfo->parseIfNeeded();
     return SyntaxInfo;
   }
@@ -2090,36 +2109,47 @@ void SwiftEditorDocument::updateSemaInfo(
   ::updateSemaInfo(SemanticInfo, EditableBuffer, CancellationToken);
 }
 
-void SwiftEditorDocument::resetSyntaxInfo(ImmutableTextSnapshotRef Snapshot,
-                                          SwiftLangSupport &Lang) {
-  llvm::sys::ScopedLock L(Impl.AccessMtx);
-
-  assert(Impl.SemanticInfo && "Impl.SemanticInfo must be set");
+void SwiftEditorDocument::Implementation::ensureSyntaxInfo() {
+  if (SyntaxInfo || !SyntaxInfoSnapshot)
+    return;
 
   std::vector<std::string> Args;
-  std::string PrimaryFile; // Ignored, Impl.FilePath will be used
+  std::string PrimaryFile; // Ignored, FilePath will be used
 
   CompilerInvocation CompInv;
-  if (Impl.SemanticInfo->getInvocation()) {
-    Impl.SemanticInfo->getInvocation()->applyTo(CompInv);
-    Impl.SemanticInfo->getInvocation()->raw(Args, PrimaryFile);
-  } else {
+  if (SemanticInfo->getInvocation()) {
+    SemanticInfo->getInvocation()->applyTo(CompInv);
+    SemanticInfo->getInvocation()->raw(Args, PrimaryFile);
+  } else if (auto ASTMgrRef = ASTMgr.lock()) {
     // Use stdin as a .swift input to satisfy the driver. Note that we don't
-    // use Impl.FilePath here because it may be invalid filename for driver
+    // use FilePath here because it may be invalid filename for driver
     // like "" or "-foobar".
-    SmallVector<const char *, 1> Args;
-    Args.push_back("-");
+    SmallVector<const char *, 1> InitArgs;
+    InitArgs.push_back("-");
     std::string Error;
     // Ignore possible error(s)
-    Lang.getASTManager()->initCompilerInvocation(
-        CompInv, Args, FrontendOptions::ActionType::Parse, StringRef(), Error);
+    ASTMgrRef->initCompilerInvocation(CompInv, InitArgs,
+                                      FrontendOptions::ActionType::Parse,
+                                      StringRef(), Error);
   }
   // When reuse parts of the syntax tree from a SyntaxParsingCache, not
   // all tokens are visited and thus token collection is invalid
   CompInv.getLangOptions().CollectParsedToken = true;
-  // Access to Impl.SyntaxInfo is guarded by Impl.AccessMtx
-  Impl.SyntaxInfo.reset(
-    new SwiftDocumentSyntaxInfo(CompInv, Snapshot, Args, Impl.FilePath));
+  SyntaxInfo.reset(
+      new SwiftDocumentSyntaxInfo(CompInv, SyntaxInfoSnapshot, Args, FilePath));
+}
+
+void SwiftEditorDocument::resetSyntaxInfo(ImmutableTextSnapshotRef Snapshot) {
+  llvm::sys::ScopedLock L(Impl.AccessMtx);
+
+  assert(Impl.SemanticInfo && "Impl.SemanticInfo must be set");
+
+  // Constructing a SwiftDocumentSyntaxInfo allocates a fresh ASTContext and
+  // is most of the cost of a syntactic update. Only record the snapshot here
+  // and defer the construction until a consumer asks for syntactic
+  // information, so clients that merely push edits never pay for it.
+  Impl.SyntaxInfoSnapshot = Snapshot;
+  Impl.SyntaxInfo = nullptr;
 }
 
 static UIdent SemaDiagStage("source.diagnostic.stage.swift.sema");
@@ -2127,6 +2157,7 @@ static UIdent ParseDiagStage("source.diagnostic.stage.swift.parse");
 
 void SwiftEditorDocument::readSyntaxInfo(EditorConsumer &Consumer, bool ReportDiags) {
   llvm::sys::ScopedLock L(Impl.AccessMtx);
+  Impl.ensureSyntaxInfo();
   Impl.SyntaxInfo->parseIfNeeded();
 
   Impl.ParserDiagnostics = Impl.SyntaxInfo->getDiagnostics();
@@ -2427,7 +2458,7 @@ void SwiftLangSupport::editorOpen(StringRef Name, llvm::MemoryBuffer *Buf,
     EditorDoc = new SwiftEditorDocument(Name, *this, fileSystem);
     Snapshot = EditorDoc->initializeText(
         Buf, Args, Consumer.needsSemanticInfo(), fileSystem);
-    EditorDoc->resetSyntaxInfo(Snapshot, *this);
+    EditorDoc->resetSyntaxInfo(Snapshot);
     if (EditorDocuments->getOrUpdate(Name, *this, EditorDoc)) {
       // Document already exists, re-initialize it. This should only happen
       // if we get OPEN request while the previous document is not closed.
@@ -2441,7 +2472,7 @@ void SwiftLangSupport::editorOpen(StringRef Name, llvm::MemoryBuffer *Buf,
   if (!Snapshot) {
     Snapshot = EditorDoc->initializeText(
         Buf, Args, Consumer.needsSemanticInfo(), fileSystem);
-    EditorDoc->resetSyntaxInfo(Snapshot, *this);
+    EditorDoc->resetSyntaxInfo(Snapshot);
   }
 
   if (Consumer.needsSemanticInfo()) {
@@ -2507,7 +2538,7 @@ void SwiftLangSupport::editorReplaceText(StringRef Name,
       return;
     }
 
-    EditorDoc->resetSyntaxInfo(Snapshot, *this);
+    EditorDoc->resetSyntaxInfo(Snapshot);
 
     // If client doesn't need any information, we doesn't need to parse it.
     if (!Consumer.documentStructureEnabled() &&
@@ -437,6 +437,8 @@ void SwiftLangSupport::indexToStore(
     void failed(StringRef Error) override {
       Receiver(RequestResult<IndexStoreInfo>::fromError(Error));
     }
+
+    Priority getPriority() override { return Priority::Background; }
   };
 
   auto ASTConsumer = std::make_shared<IndexStoreASTConsumer>(std::move(Receiver), std::move(Opts));
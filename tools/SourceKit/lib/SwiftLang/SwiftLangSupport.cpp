@@ -321,6 +321,31 @@ void SwiftLangSupport::globalConfigurationUpdated(
 
 void SwiftLangSupport::dependencyUpdated() {
   IDEInspectionInst->markCachedCompilerInstanceShouldBeInvalidated();
+  // Renderings of declarations from other modules are keyed on fingerprints
+  // that only cover source files; drop them when a dependency changes.
+  CursorRenderCache.clear();
+}
+
+std::shared_ptr<CursorInfoRendering>
+CursorInfoRenderCache::get(StringRef Key) {
+  llvm::sys::ScopedLock L(Mtx);
+  auto It = Entries.find(Key);
+  if (It == Entries.end())
+    return nullptr;
+  return It->second;
+}
+
+void CursorInfoRenderCache::set(
+    StringRef Key, std::shared_ptr<CursorInfoRendering> Rendering) {
+  llvm::sys::ScopedLock L(Mtx);
+  if (Entries.size() >= MaxEntries)
+    Entries.clear();
+  Entries[Key] = std::move(Rendering);
+}
+
+void CursorInfoRenderCache::clear() {
+  llvm::sys::ScopedLock L(Mtx);
+  Entries.clear();
 }
 
 UIdent SwiftLangSupport::getUIDForDeclLanguage(const swift::Decl *D) {
@@ -33,8 +33,10 @@
 #include "swift/Refactoring/Refactoring.h"
 #include "llvm/ADT/IntrusiveRefCntPtr.h"
 #include "llvm/ADT/StringMap.h"
+#include "llvm/Support/Allocator.h"
 #include "llvm/Support/Mutex.h"
 #include <map>
+#include <memory>
 #include <string>
 
 namespace swift {
@@ -111,8 +113,7 @@ public:
 
   ImmutableTextSnapshotRef getLatestSnapshot() const;
 
-  void resetSyntaxInfo(ImmutableTextSnapshotRef Snapshot,
-                       SwiftLangSupport &Lang);
+  void resetSyntaxInfo(ImmutableTextSnapshotRef Snapshot);
   void readSyntaxInfo(EditorConsumer &consumer, bool ReportDiags);
   void readSemanticInfo(ImmutableTextSnapshotRef Snapshot,
                         EditorConsumer& Consumer);
@@ -258,6 +259,39 @@ struct SwiftPopularAPI : public ThreadSafeRefCountedBase<SwiftPopularAPI> {
   llvm::StringMap<CodeCompletion::PopularityFactor> nameToFactor;
 };
 
+/// The position-independent parts of a cursor-info symbol rendering. All
+/// strings and arrays are owned by the entry's allocator.
+struct CursorInfoRendering {
+  llvm::BumpPtrAllocator Allocator;
+  llvm::StringRef DocCommentAsXML;
+  llvm::StringRef AnnotatedDeclaration;
+  llvm::StringRef FullyAnnotatedDeclaration;
+  llvm::StringRef SymbolGraph;
+  llvm::ArrayRef<ParentInfo> ParentContexts;
+  llvm::ArrayRef<ReferencedDeclInfo> ReferencedSymbols;
+};
+
+/// Memoizes the expensive declaration renderings produced for cursor info
+/// across requests. Most cursor-info traffic consists of repeated hovers over
+/// the same few symbols, so reusing the rendering avoids re-running the AST
+/// printer, doc-comment conversion, and symbol graph generation every time.
+/// Keys embed the USR and the fingerprints that invalidate an entry (see
+/// \c fillSymbolInfo); entries are immutable once inserted.
+class CursorInfoRenderCache {
+  llvm::sys::Mutex Mtx;
+  llvm::StringMap<std::shared_ptr<CursorInfoRendering>> Entries;
+
+  /// Bound the cache's footprint; entries are cheap enough to recompute
+  /// after a flush.
+  static const size_t MaxEntries = 512;
+
+public:
+  std::shared_ptr<CursorInfoRendering> get(llvm::StringRef Key);
+  void set(llvm::StringRef Key,
+           std::shared_ptr<CursorInfoRendering> Rendering);
+  void clear();
+};
+
 struct SwiftCustomCompletions
     : public ThreadSafeRefCountedBase<SwiftCustomCompletions> {
   std::vector<CustomCompletionInfo> customCompletions;
@@ -350,6 +384,7 @@ class SwiftLangSupport : public LangSupport {
   ThreadSafeRefCntPtr<SwiftCompletionCache> CCCache;
   ThreadSafeRefCntPtr<SwiftPopularAPI> PopularAPI;
   CodeCompletion::SessionCacheMap CCSessions;
+  CursorInfoRenderCache CursorRenderCache;
   ThreadSafeRefCntPtr<SwiftCustomCompletions> CustomCompletions;
   std::shared_ptr<SwiftStatistics> Stats;
   llvm::StringMap<std::unique_ptr<FileSystemProvider>> FileSystemProviders;
@@ -378,6 +413,10 @@ public:
     return CCCache;
   }
 
+  CursorInfoRenderCache &getCursorInfoRenderCache() {
+    return CursorRenderCache;
+  }
+
   std::shared_ptr<swift::ide::IDEInspectionInstance>
   getIDEInspectionInstance() {
     return IDEInspectionInst;
@@ -25,6 +25,7 @@
 #include "swift/AST/LookupKinds.h"
 #include "swift/AST/ModuleNameLookup.h"
 #include "swift/AST/NameLookup.h"
+#include "swift/AST/SourceFile.h"
 #include "swift/AST/SwiftNameTranslation.h"
 #include "swift/Basic/SourceManager.h"
 #include "swift/Frontend/Frontend.h"
@@ -48,6 +49,7 @@
 #include "clang/Index/USRGeneration.h"
 #include "clang/Lex/Lexer.h"
 
+#include "llvm/ADT/Hashing.h"
 #include "llvm/Support/MemoryBuffer.h"
 
 #include <numeric>
@@ -842,6 +844,32 @@ static ArrayRef<T> copyAndClearArray(llvm::BumpPtrAllocator &Allocator,
   return Ref;
 }
 
+static ArrayRef<ParentInfo>
+copyParentInfoArray(llvm::BumpPtrAllocator &Allocator,
+                    ArrayRef<ParentInfo> Parents) {
+  SmallVector<ParentInfo, 4> Copies;
+  for (const auto &Parent : Parents) {
+    Copies.emplace_back(Parent.Title.copy(Allocator),
+                        Parent.KindName.copy(Allocator),
+                        Parent.USR.copy(Allocator));
+  }
+  return copyArray(Allocator, llvm::ArrayRef(Copies));
+}
+
+static ArrayRef<ReferencedDeclInfo>
+copyReferencedDeclInfoArray(llvm::BumpPtrAllocator &Allocator,
+                            ArrayRef<ReferencedDeclInfo> Referenced) {
+  SmallVector<ReferencedDeclInfo, 8> Copies;
+  for (const auto &Ref : Referenced) {
+    Copies.emplace_back(Ref.USR.copy(Allocator), Ref.DeclarationLang,
+                        Ref.AccessLevel.copy(Allocator),
+                        Ref.FilePath.copy(Allocator),
+                        Ref.ModuleName.copy(Allocator), Ref.IsSystem, Ref.IsSPI,
+                        copyParentInfoArray(Allocator, Ref.ParentContexts));
+  }
+  return copyArray(Allocator, llvm::ArrayRef(Copies));
+}
+
 static void setLocationInfoForClangNode(ClangNode ClangNode,
                                         ClangImporter *Importer,
                                         LocationInfo &Location) {
@@ -1010,8 +1038,43 @@ fillSymbolInfo(CursorSymbolInfo &Symbol, const DeclInfo &DInfo,
   ide::getRawDocumentationComment(DInfo.OriginalProperty, OS);
   Symbol.DocComment = copyAndClearString(Allocator, Buffer);
 
-  ide::getDocumentationCommentAsXML(DInfo.OriginalProperty, OS);
-  Symbol.DocCommentAsXML = copyAndClearString(Allocator, Buffer);
+  // The doc comment XML, annotated declarations, and symbol graph do not
+  // depend on the cursor position, so repeated hovers over the same symbol
+  // can reuse a previous rendering. Renderings specialized on the occurrence
+  // (substituted base types, solution-specific interface types, synthesized
+  // extensions) are not memoized. The key embeds everything whose change
+  // must invalidate an entry: the interface hash covers interface edits in
+  // the containing file, the body fingerprint edits within the containing
+  // type, and the raw doc comment hash comment-only edits that neither of
+  // the former reflects.
+  std::shared_ptr<CursorInfoRendering> Rendering;
+  SmallString<128> RenderingKey;
+  bool CanMemoizeRendering = !DInfo.SolutionSpecificInterfaceType &&
+                             !DInfo.BaseType && !DInfo.InSynthesizedExtension;
+  if (CanMemoizeRendering) {
+    llvm::raw_svector_ostream KeyOS(RenderingKey);
+    KeyOS << Symbol.USR << ':' << AddSymbolGraph;
+    if (auto *SF = DInfo.VD->getDeclContext()->getParentSourceFile())
+      KeyOS << ':' << SF->getInterfaceHash();
+    for (auto *DC = DInfo.VD->getInnermostDeclContext(); DC;
+         DC = DC->getParent()) {
+      auto *IDC = dyn_cast_or_null<IterableDeclContext>(DC->getAsDecl());
+      if (!IDC)
+        continue;
+      if (auto Fp = IDC->getBodyFingerprint())
+        KeyOS << ':' << *Fp;
+      break;
+    }
+    KeyOS << ':' << llvm::hash_value(Symbol.DocComment);
+    Rendering = Lang.getCursorInfoRenderCache().get(RenderingKey);
+  }
+
+  if (Rendering) {
+    Symbol.DocCommentAsXML = Rendering->DocCommentAsXML.copy(Allocator);
+  } else {
+    ide::getDocumentationCommentAsXML(DInfo.OriginalProperty, OS);
+    Symbol.DocCommentAsXML = copyAndClearString(Allocator, Buffer);
+  }
 
   {
     auto *Group = DInfo.InSynthesizedExtension ? DInfo.BaseType->getAnyNominal()
@@ -1023,14 +1086,27 @@ fillSymbolInfo(CursorSymbolInfo &Symbol, const DeclInfo &DInfo,
   ide::getLocalizationKey(DInfo.VD, OS);
   Symbol.LocalizationKey = copyAndClearString(Allocator, Buffer);
 
-  printAnnotatedDeclaration(DInfo.VD, DInfo.BaseType, OS);
-  Symbol.AnnotatedDeclaration = copyAndClearString(Allocator, Buffer);
+  if (Rendering) {
+    Symbol.AnnotatedDeclaration =
+        Rendering->AnnotatedDeclaration.copy(Allocator);
+    Symbol.FullyAnnotatedDeclaration =
+        Rendering->FullyAnnotatedDeclaration.copy(Allocator);
+  } else {
+    printAnnotatedDeclaration(DInfo.VD, DInfo.BaseType, OS);
+    Symbol.AnnotatedDeclaration = copyAndClearString(Allocator, Buffer);
 
-  SwiftLangSupport::printFullyAnnotatedDeclaration(DInfo.VD, DInfo.BaseType,
-                                                   OS);
-  Symbol.FullyAnnotatedDeclaration = copyAndClearString(Allocator, Buffer);
+    SwiftLangSupport::printFullyAnnotatedDeclaration(DInfo.VD, DInfo.BaseType,
+                                                     OS);
+    Symbol.FullyAnnotatedDeclaration = copyAndClearString(Allocator, Buffer);
+  }
 
-  if (AddSymbolGraph) {
+  if (AddSymbolGraph && Rendering) {
+    Symbol.SymbolGraph = Rendering->SymbolGraph.copy(Allocator);
+    Symbol.ParentContexts =
+        copyParentInfoArray(Allocator, Rendering->ParentContexts);
+    Symbol.ReferencedSymbols =
+        copyReferencedDeclInfoArray(Allocator, Rendering->ReferencedSymbols);
+  } else if (AddSymbolGraph) {
     SmallVector<symbolgraphgen::PathComponent, 4> PathComponents;
     SmallVector<symbolgraphgen::FragmentInfo, 8> FragmentInfos;
 
@@ -1092,6 +1168,22 @@ fillSymbolInfo(CursorSymbolInfo &Symbol, const DeclInfo &DInfo,
         copyArray(Allocator, llvm::ArrayRef(ReferencedDecls));
   }
 
+  if (CanMemoizeRendering && !Rendering) {
+    auto NewRendering = std::make_shared<CursorInfoRendering>();
+    auto &EntryAlloc = NewRendering->Allocator;
+    NewRendering->DocCommentAsXML = Symbol.DocCommentAsXML.copy(EntryAlloc);
+    NewRendering->AnnotatedDeclaration =
+        Symbol.AnnotatedDeclaration.copy(EntryAlloc);
+    NewRendering->FullyAnnotatedDeclaration =
+        Symbol.FullyAnnotatedDeclaration.copy(EntryAlloc);
+    NewRendering->SymbolGraph = Symbol.SymbolGraph.copy(EntryAlloc);
+    NewRendering->ParentContexts =
+        copyParentInfoArray(EntryAlloc, Symbol.ParentContexts);
+    NewRendering->ReferencedSymbols =
+        copyReferencedDeclInfoArray(EntryAlloc, Symbol.ReferencedSymbols);
+    Lang.getCursorInfoRenderCache().set(RenderingKey, std::move(NewRendering));
+  }
+
   Symbol.ModuleName = getModuleName(DInfo.VD, Allocator);
   if (auto IFaceGenRef =
           Lang.getIFaceGenContexts().find(Symbol.ModuleName, Invoc))
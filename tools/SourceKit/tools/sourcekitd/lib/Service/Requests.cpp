@@ -36,6 +36,7 @@
 #include "swift/Basic/Version.h"
 
 #include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/IntrusiveRefCntPtr.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/SmallString.h"
@@ -46,6 +47,7 @@
 #include "llvm/Support/PrettyStackTrace.h"
 #include "llvm/Support/VirtualFileSystem.h"
 #include "llvm/Support/raw_ostream.h"
+#include <chrono>
 #include <mutex>
 #include <optional>
 
@@ -108,6 +110,69 @@ static Statistic numRequests(UIdentFromSKDUID(KindStatNumRequests),
 static Statistic numSemaRequests(UIdentFromSKDUID(KindStatNumSemaRequests),
                                  "# of semantic requests");
 
+namespace {
+/// Bookkeeping for a request that is currently executing, so that the
+/// watchdog can name it when it stalls and 'source.request.active_requests'
+/// can report it on demand.
+struct ActiveRequest {
+  sourcekitd_uid_t ReqUID;
+  std::chrono::steady_clock::time_point StartTime;
+  /// Whether the watchdog has already logged this request as stuck, to avoid
+  /// re-logging it on every sampling tick.
+  bool ReportedStuck = false;
+};
+} // anonymous namespace
+
+static std::mutex activeRequestsMtx;
+static uint64_t nextActiveRequestID = 0;
+static llvm::DenseMap<uint64_t, ActiveRequest> activeRequests;
+
+/// How long a request may run, in seconds, before the watchdog logs it.
+/// Overridable with SOURCEKIT_REQUEST_WATCHDOG_SECONDS; 0 disables the
+/// watchdog entirely.
+static uint64_t requestWatchdogThreshold = 30;
+
+/// Start the periodic timer that scans 'activeRequests' for requests that
+/// have exceeded the watchdog threshold and logs them. This gives us a
+/// trace of what a hung service process was doing without attaching a
+/// debugger in the field.
+static void startRequestWatchdog() {
+  if (const char *EnvOpt = ::getenv("SOURCEKIT_REQUEST_WATCHDOG_SECONDS")) {
+    if (StringRef(EnvOpt).getAsInteger(10, requestWatchdogThreshold))
+      requestWatchdogThreshold = 30;
+  }
+  if (requestWatchdogThreshold == 0)
+    return;
+
+  dispatch_queue_t queue =
+      dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_BACKGROUND, 0);
+  dispatch_source_t timer =
+      dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, queue);
+  // Sample a few times per threshold so a stuck request is reported at most
+  // a fraction of the threshold late.
+  uint64_t interval = NSEC_PER_SEC * requestWatchdogThreshold / 4;
+  dispatch_source_set_timer(timer, dispatch_time(DISPATCH_TIME_NOW, interval),
+                            interval, NSEC_PER_SEC);
+  dispatch_source_set_event_handler(timer, ^{
+    auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(activeRequestsMtx);
+    for (auto &entry : activeRequests) {
+      ActiveRequest &active = entry.second;
+      auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(
+                         now - active.StartTime)
+                         .count();
+      if (uint64_t(elapsed) < requestWatchdogThreshold ||
+          active.ReportedStuck)
+        continue;
+      active.ReportedStuck = true;
+      LOG_WARN_FUNC("request '" << UIdentFromSKDUID(active.ReqUID).getName()
+                                << "' has been running for " << elapsed
+                                << " seconds");
+    }
+  });
+  dispatch_resume(timer);
+}
+
 void sourcekitd::initializeService(
     llvm::StringRef swiftExecutablePath, StringRef runtimeLibPath,
     StringRef diagnosticDocumentationPath,
@@ -118,6 +183,7 @@ void sourcekitd::initializeService(
   GlobalCtx = new SourceKit::Context(swiftExecutablePath, runtimeLibPath,
                                      diagnosticDocumentationPath,
                                      SourceKit::createSwiftLangSupport);
+  startRequestWatchdog();
   auto noteCenter = GlobalCtx->getNotificationCenter();
 
   noteCenter->addDocumentUpdateNotificationReceiver([postNotification](StringRef DocumentName) {
@@ -1232,6 +1298,28 @@ handleRequestStatistics(const RequestDict &Req,
   }
 }
 
+static void
+handleRequestActiveRequests(const RequestDict &Req,
+                            SourceKitCancellationToken CancellationToken,
+                            ResponseReceiver Rec) {
+  ResponseBuilder builder;
+  auto results = builder.getDictionary().setArray(KeyResults);
+  auto now = std::chrono::steady_clock::now();
+  {
+    std::lock_guard<std::mutex> lock(activeRequestsMtx);
+    for (const auto &entry : activeRequests) {
+      const ActiveRequest &active = entry.second;
+      auto dict = results.appendDictionary();
+      dict.set(KeyRequest, UIdentFromSKDUID(active.ReqUID));
+      dict.set(KeyDuration,
+               (int64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+                   now - active.StartTime)
+                   .count());
+    }
+  }
+  Rec(builder.createResponse());
+}
+
 static void handleRequestCompile(const RequestDict &Req,
                                  SourceKitCancellationToken CancellationToken,
                                  ResponseReceiver Rec) {
@@ -2071,6 +2159,24 @@ void handleRequestImpl(sourcekitd_object_t ReqObj,
     return Rec(
         createErrorRequestInvalid("missing 'key.request' with UID value"));
 
+  // Track this request for the watchdog and for
+  // 'source.request.active_requests'; the entry is removed when the response
+  // receiver runs.
+  uint64_t ActiveReqID;
+  {
+    std::lock_guard<std::mutex> lock(activeRequestsMtx);
+    ActiveReqID = nextActiveRequestID++;
+    activeRequests[ActiveReqID] =
+        ActiveRequest{ReqUID, std::chrono::steady_clock::now()};
+  }
+  Rec = [OrigRec = std::move(Rec), ActiveReqID](sourcekitd_response_t Resp) {
+    {
+      std::lock_guard<std::mutex> lock(activeRequestsMtx);
+      activeRequests.erase(ActiveReqID);
+    }
+    OrigRec(Resp);
+  };
+
 #define HANDLE_REQUEST(Kind, IMPL_FUNC)                                        \
   if (ReqUID == Kind) {                                                        \
     return IMPL_FUNC(Req, CancellationToken, Rec);                             \
@@ -2082,6 +2188,7 @@ void handleRequestImpl(sourcekitd_object_t ReqObj,
   HANDLE_REQUEST(RequestCrashWithExit, handleRequestCrashWithExit)
   HANDLE_REQUEST(RequestTestNotification, handleRequestTestNotification)
   HANDLE_REQUEST(RequestStatistics, handleRequestStatistics)
+  HANDLE_REQUEST(RequestActiveRequests, handleRequestActiveRequests)
   HANDLE_REQUEST(RequestDemangle, handleRequestDemangle)
   HANDLE_REQUEST(RequestMangleSimpleClass, handleRequestMangleSimpleClass)
 
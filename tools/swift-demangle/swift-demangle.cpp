@@ -21,6 +21,7 @@
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/PrettyStackTrace.h"
 #include "llvm/Support/Signals.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/Support/raw_ostream.h"
 
 // For std::rand, to work around a bug if main()'s first function call passes
@@ -29,7 +30,9 @@
 #include <cstdlib>
 #endif
 
+#include <future>
 #include <iostream>
+#include <vector>
 
 using namespace swift::Demangle;
 
@@ -106,6 +109,18 @@ static llvm::cl::opt<bool>
 /// \}
 
 
+static llvm::cl::opt<std::string>
+BatchFile("batch",
+          llvm::cl::desc("Demangle every line of the given file across "
+                         "multiple threads and print the results in input "
+                         "order"),
+          llvm::cl::value_desc("filename"));
+
+static llvm::cl::opt<unsigned>
+BatchThreads("batch-threads", llvm::cl::init(0),
+             llvm::cl::desc("Number of threads to use with -batch "
+                            "(0 means one per hardware thread)"));
+
 static llvm::cl::list<std::string>
 InputNames(llvm::cl::Positional, llvm::cl::desc("[mangled name...]"),
                llvm::cl::ZeroOrMore);
@@ -375,19 +390,82 @@ static bool findMaybeMangled(llvm::StringRef input, llvm::StringRef &match) {
   return false;
 }
 
+static void demangleLine(llvm::raw_ostream &os, llvm::StringRef line,
+                         swift::Demangle::Context &DCtx,
+                         const swift::Demangle::DemangleOptions &options);
+
 static int demangleSTDIN(const swift::Demangle::DemangleOptions &options) {
   swift::Demangle::Context DCtx;
   for (std::string mangled; std::getline(std::cin, mangled);) {
-    llvm::StringRef inputContents(mangled);
-    llvm::StringRef match;
+    demangleLine(llvm::outs(), mangled, DCtx, options);
+  }
+
+  return EXIT_SUCCESS;
+}
+
+/// Demangle any mangled names embedded in \p line, appending the rewritten
+/// line to \p os.
+static void demangleLine(llvm::raw_ostream &os, llvm::StringRef line,
+                         swift::Demangle::Context &DCtx,
+                         const swift::Demangle::DemangleOptions &options) {
+  llvm::StringRef match;
+  while (findMaybeMangled(line, match)) {
+    os << substrBefore(line, match);
+    demangle(os, match, DCtx, options);
+    line = substrAfter(line, match);
+  }
+  os << line << '\n';
+}
 
-    while (findMaybeMangled(inputContents, match)) {
-      llvm::outs() << substrBefore(inputContents, match);
-      demangle(llvm::outs(), match, DCtx, options);
-      inputContents = substrAfter(inputContents, match);
+static int demangleBatchFile(llvm::StringRef path,
+                             const swift::Demangle::DemangleOptions &options) {
+  // getFileOrSTDIN memory-maps large files, so huge symbol listings are not
+  // copied up front.
+  auto bufferOrErr = llvm::MemoryBuffer::getFileOrSTDIN(path);
+  if (std::error_code ec = bufferOrErr.getError()) {
+    llvm::errs() << "error: unable to read '" << path << "': " << ec.message()
+                 << '\n';
+    return EXIT_FAILURE;
+  }
+  llvm::StringRef contents = (*bufferOrErr)->getBuffer();
+
+  // Split the input into chunks of whole lines. Each chunk is demangled on
+  // its own thread with its own context, and the main thread streams the
+  // results back out in input order as they complete, so memory stays
+  // bounded by the number of in-flight chunks rather than the whole output.
+  const size_t chunkTarget = 1 << 20;
+  std::vector<llvm::StringRef> chunks;
+  while (!contents.empty()) {
+    size_t end = std::min(chunkTarget, contents.size());
+    if (end < contents.size()) {
+      size_t newline = contents.find('\n', end);
+      end = (newline == llvm::StringRef::npos) ? contents.size() : newline + 1;
     }
+    chunks.push_back(contents.take_front(end));
+    contents = contents.drop_front(end);
+  }
 
-    llvm::outs() << inputContents << '\n';
+  std::vector<std::string> results(chunks.size());
+  llvm::ThreadPool pool(llvm::hardware_concurrency(BatchThreads));
+  std::vector<std::shared_future<void>> futures;
+  futures.reserve(chunks.size());
+  for (size_t i = 0, e = chunks.size(); i != e; ++i) {
+    futures.push_back(pool.async([&, i] {
+      swift::Demangle::Context DCtx;
+      llvm::raw_string_ostream os(results[i]);
+      llvm::StringRef chunk = chunks[i];
+      while (!chunk.empty()) {
+        llvm::StringRef line;
+        std::tie(line, chunk) = chunk.split('\n');
+        demangleLine(os, line, DCtx, options);
+      }
+    }));
+  }
+
+  for (size_t i = 0, e = chunks.size(); i != e; ++i) {
+    futures[i].wait();
+    llvm::outs() << results[i];
+    std::string().swap(results[i]);
   }
 
   return EXIT_SUCCESS;
@@ -411,6 +489,20 @@ int main(int argc, char **argv) {
   options.DisplayLocalNameContexts = DisplayLocalNameContexts;
   options.ShowClosureSignature = ShowClosureSignature;
 
+  if (!BatchFile.empty()) {
+    CompactMode = true;
+    if (DemangleType) {
+      llvm::errs() << "The option -type cannot be used with -batch.\n";
+      return EXIT_FAILURE;
+    }
+    if (!InputNames.empty()) {
+      llvm::errs() << "The option -batch cannot be combined with mangled "
+                      "names on the command line.\n";
+      return EXIT_FAILURE;
+    }
+    return demangleBatchFile(BatchFile, options);
+  }
+
   if (InputNames.empty()) {
     CompactMode = true;
     if (DemangleType) {
@@ -103,8 +103,13 @@ static llvm::cl::opt<std::string>
     RewrittenOutputFile("rewritten-output-file",
                         llvm::cl::desc("Name of the rewritten output file"));
 
-static llvm::cl::opt<std::string>
-LineColumnPair("pos", llvm::cl::desc("Line:Column pair or /*label*/"));
+static llvm::cl::list<std::string>
+LineColumnPairs("pos", llvm::cl::desc("Line:Column pair or /*label*/. May be "
+                                      "given multiple times with "
+                                      "-find-local-rename-ranges to resolve a "
+                                      "batch of renames against a single "
+                                      "type-checked snapshot"),
+                llvm::cl::ZeroOrMore);
 
 static llvm::cl::opt<std::string>
 EndLineColumnPair("end-pos", llvm::cl::desc("Line:Column pair or /*label*/"));
@@ -404,7 +409,9 @@ int main(int argc, char *argv[]) {
   unsigned BufferID = SF->getBufferID().value();
   std::string Buffer = SM.getRangeForBuffer(BufferID).str().str();
 
-  auto Start = getLocsByLabelOrPosition(options::LineColumnPair, Buffer);
+  std::string FirstPos =
+      options::LineColumnPairs.empty() ? "" : options::LineColumnPairs.front();
+  auto Start = getLocsByLabelOrPosition(FirstPos, Buffer);
   if (Start.empty()) {
     llvm::errs() << "cannot parse position pair.\n";
     return 1;
@@ -424,10 +431,30 @@ int main(int argc, char *argv[]) {
 
 
   if (options::Action == RefactoringKind::FindLocalRenameRanges) {
-    RangeConfig Range = getRange(BufferID, SM, StartLoc, EndLoc);
-    auto SyntacticRenameRanges = findLocalRenameRanges(SF, Range);
-    return printSyntacticRenameRanges(SyntacticRenameRanges, SM, BufferID,
-                                      llvm::outs());
+    // Resolve every requested position against the single type-checked
+    // snapshot built above, so a batch of renames only pays for semantic
+    // setup once. The ranges are merged and printed as one rewrite.
+    std::vector<SyntacticRenameRangeDetails> AllRangeDetails;
+    for (const std::string &Pos : options::LineColumnPairs) {
+      auto Locs = getLocsByLabelOrPosition(Pos, Buffer);
+      if (Locs.empty()) {
+        llvm::errs() << "cannot parse position pair.\n";
+        return 1;
+      }
+      RangeConfig Range = getRange(BufferID, SM, Locs.front(), Locs.front());
+      auto SyntacticRenameRanges = findLocalRenameRanges(SF, Range);
+      if (SyntacticRenameRanges.getKind() != CancellableResultKind::Success)
+        return printSyntacticRenameRanges(SyntacticRenameRanges, SM, BufferID,
+                                          llvm::outs());
+      auto &RangeDetails = SyntacticRenameRanges.getResult();
+      AllRangeDetails.insert(AllRangeDetails.end(), RangeDetails.begin(),
+                             RangeDetails.end());
+    }
+    using RangeResult =
+        CancellableResult<std::vector<SyntacticRenameRangeDetails>>;
+    return printSyntacticRenameRanges(
+        RangeResult::success(std::move(AllRangeDetails)), SM, BufferID,
+        llvm::outs());
   }
 
   if (options::Action == RefactoringKind::GlobalRename ||
@@ -29,6 +29,7 @@
 #include "llvm/Object/RelocationResolver.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Error.h"
+#include "llvm/Support/ThreadPool.h"
 
 #if defined(_WIN32)
 #include <io.h>
@@ -91,29 +92,36 @@ static int doDumpReflectionSections(ArrayRef<std::string> BinaryFilenames,
                                     std::ostream &stream) {
   // Note: binaryOrError and objectOrError own the memory for our ObjectFile;
   // once they go out of scope, we can no longer do anything.
-  std::vector<OwningBinary<Binary>> BinaryOwners;
-  std::vector<std::unique_ptr<ObjectFile>> ObjectOwners;
-  std::vector<const ObjectFile *> ObjectFiles;
-
-  for (const std::string &BinaryFilename : BinaryFilenames) {
-    auto BinaryOwner = unwrap(createBinary(BinaryFilename));
-    Binary *BinaryFile = BinaryOwner.getBinary();
-
-    // The object file we are doing lookups in -- either the binary itself, or
-    // a particular slice of a universal binary.
-    std::unique_ptr<ObjectFile> ObjectOwner;
-    const ObjectFile *O = dyn_cast<ObjectFile>(BinaryFile);
-    if (!O) {
-      auto Universal = cast<MachOUniversalBinary>(BinaryFile);
-      ObjectOwner = unwrap(Universal->getMachOObjectForArch(Arch));
-      O = ObjectOwner.get();
-    }
+  std::vector<OwningBinary<Binary>> BinaryOwners(BinaryFilenames.size());
+  std::vector<std::unique_ptr<ObjectFile>> ObjectOwners(BinaryFilenames.size());
+  std::vector<const ObjectFile *> ObjectFiles(BinaryFilenames.size());
+
+  // Load and slice each image in parallel; every task writes only its own
+  // slot. All lookups afterwards go through a single merged reflection
+  // context, so only this loading phase is parallelizable.
+  llvm::ThreadPool Pool(llvm::hardware_concurrency());
+  for (unsigned Index = 0; Index < BinaryFilenames.size(); ++Index) {
+    Pool.async([&, Index] {
+      auto BinaryOwner = unwrap(createBinary(BinaryFilenames[Index]));
+      Binary *BinaryFile = BinaryOwner.getBinary();
+
+      // The object file we are doing lookups in -- either the binary itself,
+      // or a particular slice of a universal binary.
+      std::unique_ptr<ObjectFile> ObjectOwner;
+      const ObjectFile *O = dyn_cast<ObjectFile>(BinaryFile);
+      if (!O) {
+        auto Universal = cast<MachOUniversalBinary>(BinaryFile);
+        ObjectOwner = unwrap(Universal->getMachOObjectForArch(Arch));
+        O = ObjectOwner.get();
+      }
 
-    // Retain the objects that own section memory
-    BinaryOwners.push_back(std::move(BinaryOwner));
-    ObjectOwners.push_back(std::move(ObjectOwner));
-    ObjectFiles.push_back(O);
+      // Retain the objects that own section memory
+      BinaryOwners[Index] = std::move(BinaryOwner);
+      ObjectOwners[Index] = std::move(ObjectOwner);
+      ObjectFiles[Index] = O;
+    });
   }
+  Pool.wait();
 
 #if SWIFT_OBJC_INTEROP
   bool ObjCInterop = !options::DisableObjCInterop;
@@ -97,3 +97,60 @@ TEST(SourceManager, RangeContains) {
   EXPECT_TRUE(SM.rangeContains(R_ad, R_bc));
 }
 
+
+TEST(SourceManager, LineStartOffsets) {
+  SourceManager SM;
+  unsigned ID = SM.addMemBufferCopy("aaa\nbb\n\nc\n");
+
+  auto LineStarts = SM.getLineStartOffsets(ID);
+  ASSERT_EQ(5u, LineStarts.size());
+  EXPECT_EQ(0u, LineStarts[0]);
+  EXPECT_EQ(4u, LineStarts[1]);
+  EXPECT_EQ(7u, LineStarts[2]);
+  EXPECT_EQ(8u, LineStarts[3]);
+  EXPECT_EQ(10u, LineStarts[4]);
+
+  // The cached index is shared across calls.
+  EXPECT_EQ(LineStarts.data(), SM.getLineStartOffsets(ID).data());
+}
+
+TEST(SourceManager, GetLineAndColumnForOffset) {
+  SourceManager SM;
+  unsigned ID = SM.addMemBufferCopy("aaa\nbb\n\nc\n");
+
+  EXPECT_EQ(std::make_pair(1u, 1u), SM.getLineAndColumnForOffset(ID, 0));
+  EXPECT_EQ(std::make_pair(1u, 4u), SM.getLineAndColumnForOffset(ID, 3));
+  EXPECT_EQ(std::make_pair(2u, 1u), SM.getLineAndColumnForOffset(ID, 4));
+  EXPECT_EQ(std::make_pair(3u, 1u), SM.getLineAndColumnForOffset(ID, 7));
+  EXPECT_EQ(std::make_pair(4u, 2u), SM.getLineAndColumnForOffset(ID, 9));
+
+  SourceLoc Start = SM.getLocForBufferStart(ID);
+  EXPECT_EQ(std::make_pair(2u, 2u),
+            SM.getLineAndColumnInBuffer(Start.getAdvancedLoc(5), ID));
+  EXPECT_EQ(std::make_pair(2u, 2u),
+            SM.getLineAndColumnInBuffer(Start.getAdvancedLoc(5)));
+}
+
+TEST(SourceManager, GetLineAndColumnsInBuffer) {
+  SourceManager SM;
+  unsigned ID = SM.addMemBufferCopy("aaa\nbb\n\nc\n");
+  SourceLoc Start = SM.getLocForBufferStart(ID);
+
+  // A mix of in-order, same-line, next-line, and backwards queries.
+  SourceLoc Locs[] = {
+      Start,                    // 1:1
+      Start.getAdvancedLoc(2),  // 1:3
+      Start.getAdvancedLoc(4),  // 2:1
+      Start.getAdvancedLoc(8),  // 4:1
+      Start.getAdvancedLoc(1),  // 1:2
+  };
+  SmallVector<std::pair<unsigned, unsigned>, 8> Result;
+  SM.getLineAndColumnsInBuffer(ID, Locs, Result);
+
+  ASSERT_EQ(5u, Result.size());
+  EXPECT_EQ(std::make_pair(1u, 1u), Result[0]);
+  EXPECT_EQ(std::make_pair(1u, 3u), Result[1]);
+  EXPECT_EQ(std::make_pair(2u, 1u), Result[2]);
+  EXPECT_EQ(std::make_pair(4u, 1u), Result[3]);
+  EXPECT_EQ(std::make_pair(1u, 2u), Result[4]);
+}
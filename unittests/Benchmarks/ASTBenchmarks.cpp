@@ -0,0 +1,126 @@
+//===--- ASTBenchmarks.cpp ------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+#include "BenchmarkSupport.h"
+#include "swift/AST/ASTContext.h"
+#include "swift/AST/DiagnosticEngine.h"
+#include "swift/AST/Module.h"
+#include "swift/AST/ParseRequests.h"
+#include "swift/AST/SourceFile.h"
+#include "swift/AST/Types.h"
+#include "swift/Basic/LangOptions.h"
+#include "swift/Basic/SourceManager.h"
+#include "swift/Subsystems.h"
+#include "swift/SymbolGraphGen/SymbolGraphOptions.h"
+#include "llvm/TargetParser/Host.h"
+#include "gtest/gtest.h"
+
+using namespace swift;
+using namespace swift::unittest;
+
+namespace {
+
+/// A pared-down version of the TestContext fixture from unittests/AST that
+/// owns just enough state to create types and run requests.
+class BenchmarkContext {
+public:
+  LangOptions LangOpts;
+  TypeCheckerOptions TypeCheckerOpts;
+  SILOptions SILOpts;
+  SearchPathOptions SearchPathOpts;
+  ClangImporterOptions ClangImporterOpts;
+  symbolgraphgen::SymbolGraphOptions SymbolGraphOpts;
+  CASOptions CASOpts;
+  SourceManager SourceMgr;
+  DiagnosticEngine Diags;
+  ASTContext &Ctx;
+  SourceFile *File;
+
+  BenchmarkContext()
+      : Diags(SourceMgr),
+        Ctx(*([&]() -> ASTContext * {
+          LangOpts.Target = llvm::Triple(llvm::sys::getProcessTriple());
+          return ASTContext::get(LangOpts, TypeCheckerOpts, SILOpts,
+                                 SearchPathOpts, ClangImporterOpts,
+                                 SymbolGraphOpts, CASOpts, SourceMgr, Diags);
+        })()) {
+    registerParseRequestFunctions(Ctx.evaluator);
+    registerTypeCheckerRequestFunctions(Ctx.evaluator);
+    auto *module = ModuleDecl::create(Ctx.getIdentifier("benchmarks"), Ctx);
+    Ctx.addLoadedModule(module);
+    File = new (Ctx) SourceFile(*module, SourceFileKind::Library,
+                                /*buffer*/ std::nullopt);
+    module->addFile(*File);
+  }
+};
+
+} // end anonymous namespace
+
+TEST(ASTBenchmark, TypeUniquingProbe) {
+  BenchmarkContext context;
+  ASTContext &ctx = context.Ctx;
+
+  // Re-request an already uniqued tuple type: each iteration probes the
+  // ASTContext's type uniquing tables.
+  Type first = ctx.TheRawPointerType;
+  Type second = ctx.TheNativeObjectType;
+  doNotOptimizeAway(TupleType::get({first, second}, ctx).getPointer());
+
+  runBenchmark("AST.TypeUniquingProbe", [&] {
+    Type tuple = TupleType::get({first, second}, ctx);
+    doNotOptimizeAway(tuple.getPointer());
+  });
+}
+
+TEST(ASTBenchmark, GetCanonicalType) {
+  BenchmarkContext context;
+  ASTContext &ctx = context.Ctx;
+
+  // Build a chain of nested typealias sugar, so that getCanonicalType has to
+  // probe the per-node canonical type cache on a non-canonical type. This is
+  // the steady-state cost paid throughout the compiler, where almost every
+  // canonicalization after the first is a cache hit.
+  Type type = ctx.TheRawPointerType;
+  for (unsigned i = 0; i != 64; ++i) {
+    Type underlying = TupleType::get({type, ctx.TheNativeObjectType}, ctx);
+    auto *alias = new (ctx) TypeAliasDecl(
+        SourceLoc(), SourceLoc(),
+        ctx.getIdentifier("Alias" + std::to_string(i)), SourceLoc(),
+        /*GenericParams=*/nullptr, context.File);
+    alias->setUnderlyingType(underlying);
+    type = TypeAliasType::get(alias, Type(), SubstitutionMap(), underlying);
+  }
+
+  runBenchmark("AST.GetCanonicalType", [&] {
+    CanType canonical = type->getCanonicalType();
+    doNotOptimizeAway(canonical.getPointer());
+  });
+}
+
+TEST(ASTBenchmark, EvaluatorCachedRequest) {
+  BenchmarkContext context;
+  ASTContext &ctx = context.Ctx;
+
+  // Seed the result cache, then measure the steady-state cost of asking the
+  // evaluator for an already computed request.
+  SourceFileParsingResult parsingResult{/*TopLevelItems=*/{},
+                                        /*CollectedTokens=*/std::nullopt,
+                                        /*InterfaceHasher=*/std::nullopt};
+  ctx.evaluator.cacheOutput(ParseSourceFileRequest{context.File},
+                            std::move(parsingResult));
+
+  runBenchmark("AST.EvaluatorCachedRequest", [&] {
+    auto result = evaluateOrDefault(ctx.evaluator,
+                                    ParseSourceFileRequest{context.File}, {});
+    doNotOptimizeAway(result.TopLevelItems.size());
+  });
+}
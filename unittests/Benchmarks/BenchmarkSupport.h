@@ -0,0 +1,118 @@
+//===--- BenchmarkSupport.h - Microbenchmark helpers ------------*- C++ -*-===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+// A minimal harness for microbenchmarking compiler hot paths from the unit
+// test suite. Benchmarks are ordinary gtest tests that pass their measured
+// region to runBenchmark(); the harness calibrates an iteration count so that
+// one sample runs long enough to make timer resolution irrelevant, reports
+// nanoseconds per iteration on stdout, and, when the SWIFT_BENCHMARK_JSON
+// environment variable names a file, appends one JSON object per benchmark to
+// it so that runs can be diffed against a recorded baseline.
+//
+// This is deliberately not a statistics framework: a sample's time is the
+// minimum over a handful of repetitions, which is the measurement least
+// disturbed by the rest of the system.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef SWIFT_UNITTESTS_BENCHMARKS_BENCHMARKSUPPORT_H
+#define SWIFT_UNITTESTS_BENCHMARKS_BENCHMARKSUPPORT_H
+
+#include "llvm/ADT/STLFunctionalExtras.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Format.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/raw_ostream.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+namespace swift {
+namespace unittest {
+
+/// Prevent the optimizer from eliding a computed value without otherwise
+/// perturbing the measured code.
+template <typename T>
+inline void doNotOptimizeAway(T &&value) {
+#if defined(_MSC_VER) && !defined(__clang__)
+  volatile const void *sink = &value;
+  (void)sink;
+#else
+  asm volatile("" : : "g"(value) : "memory");
+#endif
+}
+
+/// The outcome of one benchmark: the calibrated number of iterations per
+/// sample and the fastest observed per-iteration time.
+struct BenchmarkResult {
+  llvm::StringRef name;
+  uint64_t iterations;
+  double nanosPerIteration;
+};
+
+inline void reportBenchmarkResult(const BenchmarkResult &result) {
+  llvm::outs() << "[benchmark] " << result.name << ": "
+               << llvm::format("%.2f", result.nanosPerIteration) << " ns/op ("
+               << result.iterations << " iterations per sample)\n";
+
+  const char *jsonPath = ::getenv("SWIFT_BENCHMARK_JSON");
+  if (!jsonPath)
+    return;
+  std::error_code errorCode;
+  llvm::raw_fd_ostream out(jsonPath, errorCode,
+                           llvm::sys::fs::OF_Append | llvm::sys::fs::OF_Text);
+  if (errorCode)
+    return;
+  llvm::json::Object line{{"name", result.name},
+                          {"ns_per_op", result.nanosPerIteration},
+                          {"iterations", int64_t(result.iterations)}};
+  out << llvm::json::Value(std::move(line)) << "\n";
+}
+
+/// Measure \p body, report the result and return it.
+inline BenchmarkResult runBenchmark(llvm::StringRef name,
+                                    llvm::function_ref<void()> body) {
+  using Clock = std::chrono::steady_clock;
+  auto timeSample = [&](uint64_t iterations) -> int64_t {
+    auto start = Clock::now();
+    for (uint64_t i = 0; i != iterations; ++i)
+      body();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() -
+                                                                start)
+        .count();
+  };
+
+  // Warm up and calibrate: grow the sample until it runs for at least 10ms.
+  const int64_t minSampleNanos = 10'000'000;
+  uint64_t iterations = 1;
+  int64_t sampleNanos = timeSample(iterations);
+  while (sampleNanos < minSampleNanos && iterations < (uint64_t(1) << 32)) {
+    iterations *= 2;
+    sampleNanos = timeSample(iterations);
+  }
+
+  // Take the fastest of a few samples as the reported time.
+  int64_t best = sampleNanos;
+  for (unsigned i = 0; i != 4; ++i)
+    best = std::min(best, timeSample(iterations));
+
+  BenchmarkResult result{name, iterations,
+                         double(best) / double(iterations)};
+  reportBenchmarkResult(result);
+  return result;
+}
+
+} // end namespace unittest
+} // end namespace swift
+
+#endif // SWIFT_UNITTESTS_BENCHMARKS_BENCHMARKSUPPORT_H
@@ -0,0 +1,50 @@
+//===--- DemangleBenchmarks.cpp -------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+#include "BenchmarkSupport.h"
+#include "swift/Demangling/Demangle.h"
+#include "gtest/gtest.h"
+
+using namespace swift;
+using namespace swift::unittest;
+
+/// A corpus of real manglings of varying complexity, taken from
+/// test/Demangle/Inputs/manglings.txt.
+static const char *const mangledNames[] = {
+    "$sSo5GizmoC11doSomethingyypSgSaySSGSgFToTembgnn_",
+    "$s20mangling_retroactive5test0yyAA1ZVy12RetroactiveB1XVSiAE1YVAG0D1A1PAA"
+    "yHCg_AiJ1QAAyHCg1_GF",
+    "$s4Test5ProtoP8IteratorV10collectionAEy_qd__Gqd___tcfc",
+    "$sSUss17FixedWidthIntegerRzrlEyxqd__cSzRd__lufCSu_SiTgm5",
+    "$s18keypaths_inlinable13KeypathStructV8computedSSvpACTKq",
+    "$s18resilient_protocol24ResilientDerivedProtocolPxAA0c4BaseE0Tn",
+    "$s3red4testyAA3ResOyxSayq_GAEs5ErrorAAq_sAFHD1__HCg_GADyxq_GsAFR_r0_lF",
+    "$s17property_wrappers10WithTuplesV9fractionsSd_S2dtvpfP",
+    "$sSo17OS_dispatch_queueC4sync7executeyyyXE_tFTOTA",
+};
+
+TEST(DemangleBenchmark, SymbolsPerSecond) {
+  auto result = runBenchmark("Demangle.SymbolsPerSecond", [] {
+    for (const char *mangledName : mangledNames) {
+      std::string demangled =
+          Demangle::demangleSymbolAsString(llvm::StringRef(mangledName));
+      doNotOptimizeAway(demangled);
+    }
+  });
+
+  // One iteration demangles the whole corpus; also report per-symbol cost.
+  constexpr unsigned corpusSize =
+      sizeof(mangledNames) / sizeof(mangledNames[0]);
+  llvm::outs() << "[benchmark] Demangle.SymbolsPerSecond: "
+               << llvm::format("%.2f", result.nanosPerIteration / corpusSize)
+               << " ns/symbol\n";
+}
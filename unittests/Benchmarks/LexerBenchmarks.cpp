@@ -0,0 +1,60 @@
+//===--- LexerBenchmarks.cpp ----------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+#include "BenchmarkSupport.h"
+#include "swift/Basic/LangOptions.h"
+#include "swift/Basic/SourceManager.h"
+#include "swift/Parse/Lexer.h"
+#include "gtest/gtest.h"
+
+using namespace swift;
+using namespace swift::unittest;
+
+/// Build a representative chunk of Swift source: identifiers, operators,
+/// numeric and string literals, interpolations and comments.
+static std::string buildLexerInput() {
+  std::string source;
+  source.reserve(1 << 17);
+  for (unsigned i = 0; i != 500; ++i) {
+    std::string index = std::to_string(i);
+    source += "/// Doc comment for function" + index + ".\n";
+    source += "func function" + index + "(argument: Int) -> String {\n";
+    source += "  let value = (argument &+ " + index + ") * 0x1p4 + 0.5\n";
+    source += "  // A line comment the lexer has to skip.\n";
+    source += "  return \"result \\(value) for #" + index + "\"\n";
+    source += "}\n";
+  }
+  return source;
+}
+
+TEST(LexerBenchmark, Throughput) {
+  LangOptions langOpts;
+  SourceManager sourceMgr;
+  std::string source = buildLexerInput();
+  unsigned bufferID = sourceMgr.addMemBufferCopy(source);
+
+  auto result = runBenchmark("Lexer.Throughput", [&] {
+    Lexer lexer(langOpts, sourceMgr, bufferID, /*Diags=*/nullptr,
+                LexerMode::Swift);
+    Token token;
+    do {
+      lexer.lex(token);
+    } while (token.isNot(tok::eof));
+    doNotOptimizeAway(token);
+  });
+
+  // One iteration lexes the whole buffer; also report throughput.
+  double megabytesPerSecond =
+      double(source.size()) * 1000.0 / result.nanosPerIteration;
+  llvm::outs() << "[benchmark] Lexer.Throughput: "
+               << llvm::format("%.1f", megabytesPerSecond) << " MB/s\n";
+}
@@ -0,0 +1,120 @@
+//===--- PagingMemoryReader.cpp - PagingMemoryReader tests ----------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2017 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+#include "swift/Remote/PagingMemoryReader.h"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace swift;
+using namespace swift::remote;
+
+namespace {
+
+/// A reader over a local buffer that counts how many underlying reads the
+/// paging layer issues.
+class CountingBufferReader final : public MemoryReader {
+  std::vector<uint8_t> Buffer;
+
+public:
+  unsigned NumReads = 0;
+
+  explicit CountingBufferReader(size_t size) : Buffer(size) {
+    for (size_t i = 0; i < size; ++i)
+      Buffer[i] = uint8_t(i);
+  }
+
+  bool queryDataLayout(DataLayoutQueryType type, void *inBuffer,
+                       void *outBuffer) override {
+    return false;
+  }
+
+  RemoteAddress getSymbolAddress(const std::string &name) override {
+    return RemoteAddress(uint64_t(0));
+  }
+
+  bool readString(RemoteAddress address, std::string &dest) override {
+    return false;
+  }
+
+  bool readBytes(RemoteAddress address, uint8_t *dest,
+                 uint64_t size) override {
+    ++NumReads;
+    uint64_t addr = address.getAddressData();
+    if (addr + size > Buffer.size())
+      return false;
+    memcpy(dest, Buffer.data() + addr, size);
+    return true;
+  }
+};
+
+} // end anonymous namespace
+
+TEST(PagingMemoryReaderTest, CoalescesReadsIntoPageFetches) {
+  auto base = std::make_shared<CountingBufferReader>(4096);
+  PagingMemoryReader reader(base, /*PageSize=*/256, /*MaxPages=*/4);
+
+  // Many small reads within one page cost a single underlying fetch.
+  for (uint64_t offset = 0; offset < 256; offset += 8) {
+    uint64_t value;
+    EXPECT_TRUE(reader.readInteger(RemoteAddress(offset), &value));
+  }
+  EXPECT_EQ(1u, base->NumReads);
+
+  // A read in another page costs exactly one more.
+  uint8_t byte;
+  EXPECT_TRUE(reader.readBytes(RemoteAddress(512), &byte, 1));
+  EXPECT_EQ(2u, base->NumReads);
+  EXPECT_EQ(uint8_t(512), byte);
+}
+
+TEST(PagingMemoryReaderTest, ReadsSpanningPages) {
+  auto base = std::make_shared<CountingBufferReader>(4096);
+  PagingMemoryReader reader(base, /*PageSize=*/256, /*MaxPages=*/4);
+
+  uint8_t bytes[16];
+  EXPECT_TRUE(reader.readBytes(RemoteAddress(248), bytes, sizeof(bytes)));
+  for (unsigned i = 0; i < sizeof(bytes); ++i)
+    EXPECT_EQ(uint8_t(248 + i), bytes[i]);
+  EXPECT_EQ(2u, base->NumReads);
+}
+
+TEST(PagingMemoryReaderTest, FallsBackWhenPageUnreadable) {
+  // A buffer smaller than one page: whole-page fetches fail, but exact
+  // reads still succeed uncached.
+  auto base = std::make_shared<CountingBufferReader>(64);
+  PagingMemoryReader reader(base, /*PageSize=*/256, /*MaxPages=*/4);
+
+  uint8_t byte;
+  EXPECT_TRUE(reader.readBytes(RemoteAddress(8), &byte, 1));
+  EXPECT_EQ(uint8_t(8), byte);
+}
+
+TEST(PagingMemoryReaderTest, EvictsLeastRecentlyUsedPage) {
+  auto base = std::make_shared<CountingBufferReader>(4096);
+  PagingMemoryReader reader(base, /*PageSize=*/256, /*MaxPages=*/2);
+
+  uint8_t byte;
+  EXPECT_TRUE(reader.readBytes(RemoteAddress(0), &byte, 1));
+  EXPECT_TRUE(reader.readBytes(RemoteAddress(256), &byte, 1));
+  EXPECT_TRUE(reader.readBytes(RemoteAddress(512), &byte, 1));
+  EXPECT_EQ(3u, base->NumReads);
+
+  // Page 0 was evicted; touching it again refetches.
+  EXPECT_TRUE(reader.readBytes(RemoteAddress(0), &byte, 1));
+  EXPECT_EQ(4u, base->NumReads);
+
+  // Invalidation drops everything.
+  reader.invalidateCache();
+  EXPECT_TRUE(reader.readBytes(RemoteAddress(512), &byte, 1));
+  EXPECT_EQ(5u, base->NumReads);
+}
@@ -30,8 +30,9 @@ TEST(ConcurrentReadableArrayTest, SingleThreaded) {
       ASSERT_EQ(element, i);
       i++;
     }
+    ASSERT_EQ(array.count(), i);
   };
-  
+
   check();
   add(1);
   check();
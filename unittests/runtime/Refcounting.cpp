@@ -272,3 +272,40 @@ TEST(RefcountingTest, immortal_retain_release) {
     EXPECT_EQ(initialBitsValue, ImmortalTestObject.refCounts.getBitsValue());
   }
 }
+
+// Weak refcounting on an immortal object's side table is a no-op: the entry
+// can never be cleaned up, so the weak count stays put and weak references
+// to a hot immortal object don't contend on it.
+TEST(RefcountingTest, immortal_weak_references) {
+  size_t value = 0;
+  auto object = allocTestObject(&value, 1);
+  object->refCounts.setIsImmortal(true);
+
+  auto *side = object->refCounts.formWeakReference();
+  ASSERT_NE(nullptr, side);
+  auto weakCount = side->getWeakCount();
+
+  EXPECT_EQ(side, side->incrementWeak());
+  EXPECT_EQ(weakCount, side->getWeakCount());
+  side->decrementWeak();
+  EXPECT_EQ(weakCount, side->getWeakCount());
+
+  EXPECT_EQ(object, side->tryRetain());
+  EXPECT_EQ(0u, value);
+}
+
+// Exercise the sharded side table pool: entries whose last weak reference
+// goes away are recycled for later side tables.
+TEST(RefcountingTest, side_table_recycling) {
+  for (unsigned i = 0; i < 100; i++) {
+    size_t value = 0;
+    auto object = allocTestObject(&value, 1);
+    auto *side = object->refCounts.formWeakReference();
+    ASSERT_NE(nullptr, side);
+    swift_release(object);
+    EXPECT_EQ(1u, value);
+    EXPECT_EQ(nullptr, side->tryRetain());
+    // Drop the last weak reference, freeing the entry back to the pool.
+    side->decrementWeak();
+  }
+}
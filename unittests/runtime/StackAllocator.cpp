@@ -70,6 +70,24 @@ TEST(StackAllocatorTest, withPreallocatedSlab) {
   allocator.dealloc(mem1);
 }
 
+TEST(StackAllocatorTest, totalSlabCapacity) {
+
+  StackAllocator<slabCapacity, &SlabMetadata> allocator;
+  EXPECT_EQ(allocator.getTotalSlabCapacity(), (size_t)0);
+
+  char *mem1 = (char *)allocator.alloc(fitsIntoSlab);
+  size_t oneSlabCapacity = allocator.getTotalSlabCapacity();
+  EXPECT_GE(oneSlabCapacity, fitsIntoSlab);
+
+  char *mem2 = (char *)allocator.alloc(exceedsSlab);
+  EXPECT_GE(allocator.getTotalSlabCapacity(), oneSlabCapacity + exceedsSlab);
+
+  // Capacity includes slabs which became free again.
+  allocator.dealloc(mem2);
+  allocator.dealloc(mem1);
+  EXPECT_GE(allocator.getTotalSlabCapacity(), oneSlabCapacity + exceedsSlab);
+}
+
 TEST(StackAllocatorTest, withoutPreallocatedSlab) {
 
   constexpr size_t slabCapacity = 256;
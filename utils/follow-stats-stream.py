@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+#
+# ==-- follow-stats-stream - tail a swiftc -stream-stats-events file ------==#
+#
+# This source file is part of the Swift.org open source project
+#
+# Copyright (c) 2014-2026 Apple Inc. and the Swift project authors
+# Licensed under Apache License v2.0 with Runtime Library Exception
+#
+# See https://swift.org/LICENSE.txt for license information
+# See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+#
+# ==------------------------------------------------------------------------==#
+#
+# This file reads the binary columnar stats.swiftstats file appended to by
+# frontends run with `-stats-output-dir <dir> -stream-stats-events`, decodes
+# its fixed-layout records and emits them as CSV rows, optionally following
+# the file as concurrent compilations append to it (like `tail -f`).
+#
+# The record layout is documented in lib/Basic/Statistic.cpp; counter names
+# come from the stats-schema.txt sidecar the first frontend writes next to
+# the stream file.
+
+import argparse
+import csv
+import os
+import struct
+import sys
+import time
+
+MAGIC = 0x31535753  # 'SWS1', little-endian
+FLAG_FINAL = 1
+
+# u32 magic, u32 schema hash, u64 usec timestamp, u32 pid, u32 flags,
+# u32 counter count, u32 auxname length.
+HEADER = struct.Struct("<IIQIIII")
+
+
+def schema_hash(names):
+    h = 2166136261
+    for name in names:
+        for b in name.encode("utf-8") + b"\n":
+            h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def load_schema(path):
+    with open(path, "r") as f:
+        return [line.strip() for line in f if line.strip()]
+
+
+def iter_records(buf, offset):
+    """Yield (record, next_offset) for each complete record in buf; stops at
+    the first incomplete record so a partially-appended tail is retried on
+    the next poll."""
+    while True:
+        if len(buf) - offset < HEADER.size:
+            return
+        (magic, schema, usec, pid, flags, num_counters,
+         aux_len) = HEADER.unpack_from(buf, offset)
+        if magic != MAGIC:
+            raise ValueError("bad record magic at offset %d" % offset)
+        payload = num_counters * 8 + aux_len
+        padded = (HEADER.size + payload + 7) & ~7
+        if len(buf) - offset < padded:
+            return
+        counters = struct.unpack_from("<%dq" % num_counters, buf,
+                                      offset + HEADER.size)
+        aux_start = offset + HEADER.size + num_counters * 8
+        aux = buf[aux_start:aux_start + aux_len].decode("utf-8", "replace")
+        offset += padded
+        yield (schema, usec, pid, flags, counters, aux), offset
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("stream", help="path to a stats.swiftstats file")
+    parser.add_argument("--schema", default=None,
+                        help="path to stats-schema.txt "
+                        "(default: next to the stream file)")
+    parser.add_argument("--follow", "-f", action="store_true",
+                        help="poll for newly appended records")
+    parser.add_argument("--poll-interval", type=float, default=0.1,
+                        help="seconds between polls with --follow")
+    parser.add_argument("--final-only", action="store_true",
+                        help="only emit each process's final record")
+    args = parser.parse_args()
+
+    schema_path = args.schema
+    if schema_path is None:
+        schema_path = os.path.join(os.path.dirname(args.stream) or ".",
+                                   "stats-schema.txt")
+    names = load_schema(schema_path)
+    expected_hash = schema_hash(names)
+
+    out = csv.writer(sys.stdout)
+    out.writerow(["time_usec", "pid", "final", "aux"] + names)
+
+    offset = 0
+    while True:
+        with open(args.stream, "rb") as f:
+            f.seek(offset)
+            buf = f.read()
+        base = offset
+        for (schema, usec, pid, flags, counters,
+             aux), next_offset in iter_records(buf, 0):
+            offset = base + next_offset
+            if schema != expected_hash:
+                sys.stderr.write("warning: record schema hash %08x does not "
+                                 "match %s\n" % (schema, schema_path))
+            if args.final_only and not (flags & FLAG_FINAL):
+                continue
+            out.writerow([usec, pid, int(bool(flags & FLAG_FINAL)), aux] +
+                         list(counters))
+        sys.stdout.flush()
+        if not args.follow:
+            break
+        time.sleep(args.poll_interval)
+
+
+if __name__ == "__main__":
+    main()
@@ -221,6 +221,7 @@ UID_KEYS = [
     KEY('IncludeSystemModules', 'key.include_system_modules'),
     KEY('IgnoreStdlib', 'key.ignore_stdlib'),
     KEY('DisableImplicitModules', 'key.disable_implicit_modules'),
+    KEY('Duration', 'key.duration'),
 
     KEY('CompilerArgs', 'key.compilerargs'),
     KEY('SourceText', 'key.sourcetext'),
@@ -299,6 +300,7 @@ UID_REQUESTS = [
     REQUEST('SyntacticMacroExpansion',
             'source.request.syntactic_macro_expansion'),
     REQUEST('IndexToStore', 'source.request.index_to_store'),
+    REQUEST('ActiveRequests', 'source.request.active_requests'),
 ]
 
 